@@ -48,12 +48,11 @@ class AskalAPI
 	}
 	
 	// Global Database API - Reload database
-	// NOTA: Este método apenas marca para reload. O loader deve ser chamado externamente
+	// Servidor: hot reload dos datasets/configs alterados (ver AskalHotReload)
 	static void Reload()
 	{
 		AskalCoreDatabaseManager dbManager = AskalCoreDatabaseManager.GetInstance();
 		dbManager.ReloadDatabase();
-		Print("[AskalAPI] Database marked for reload. You need to call AskalDatabaseLoader.LoadAllDatasets() from 5_Mission context.");
 	}
 	
 	// Get price for item
@@ -0,0 +1,216 @@
+// ==========================================
+// AskalConfigLocator - Localiza cada arquivo de configuração uma única vez
+// Cada nome lógico (MarketConfig, VirtualStoreConfig, Traders, Setup:<nome>) tem sua
+// lista de caminhos candidatos aqui; o caminho vencedor e a impressão digital do
+// conteúdo ficam em cache para os loaders e para detectar mudanças (HasChanged)
+// Enforce não expõe data de modificação: a impressão digital é tamanho + hash do texto,
+// acumulado linha a linha (FoldFingerprint) para não montar o arquivo inteiro em memória
+// ==========================================
+
+class AskalConfigLocation
+{
+	string Name;
+	string Path;          // "" = não encontrado
+	bool IsDirectory;
+	int Length;           // Caracteres lidos (0 para diretórios)
+	int Fingerprint;      // Hash do conteúdo (0 para diretórios)
+}
+
+class AskalConfigLocator
+{
+	static const string MARKET_CONFIG = "MarketConfig";
+	static const string VIRTUAL_STORE_CONFIG = "VirtualStoreConfig";
+	static const string TRADERS_DIRECTORY = "Traders";
+	static const string SETUP_PREFIX = "Setup:";
+
+	protected static ref map<string, ref AskalConfigLocation> s_Locations;
+
+	// Caminho vencedor do nome lógico (resolvido na primeira chamada); "" se nenhum existe
+	static string Resolve(string logicalName)
+	{
+		AskalConfigLocation location = GetLocation(logicalName);
+		return location.Path;
+	}
+
+	static AskalConfigLocation GetLocation(string logicalName)
+	{
+		if (!s_Locations)
+			s_Locations = new map<string, ref AskalConfigLocation>();
+
+		AskalConfigLocation location;
+		if (s_Locations.Find(logicalName, location))
+			return location;
+
+		location = new AskalConfigLocation();
+		location.Name = logicalName;
+		location.IsDirectory = logicalName == TRADERS_DIRECTORY;
+		location.Path = "";
+
+		array<string> candidatePaths = GetCandidates(logicalName);
+		foreach (string path : candidatePaths)
+		{
+			if (FileExist(path))
+			{
+				location.Path = path;
+				break;
+			}
+		}
+
+		if (location.Path != "" && !location.IsDirectory)
+			ReadFingerprint(location.Path, location.Length, location.Fingerprint);
+
+		s_Locations.Set(logicalName, location);
+		if (location.Path != "")
+			AskalLog.Info("Config", "📍 " + logicalName + " -> " + location.Path);
+		else
+			AskalLog.Debug("Config", "📍 " + logicalName + " não encontrado (" + candidatePaths.Count() + " caminhos)");
+		return location;
+	}
+
+	// Como HasChanged, mas sem atualizar a impressão digital guardada (sondagem do hot reload)
+	static bool IsStale(string logicalName)
+	{
+		AskalConfigLocation location = GetLocation(logicalName);
+		if (location.Path == "" || location.IsDirectory)
+			return false;
+
+		int length;
+		int fingerprint;
+		ReadFingerprint(location.Path, length, fingerprint);
+		return length != location.Length || fingerprint != location.Fingerprint;
+	}
+
+	// Conteúdo mudou desde a última verificação? Atualiza a impressão digital guardada
+	static bool HasChanged(string logicalName)
+	{
+		AskalConfigLocation location = GetLocation(logicalName);
+		if (location.Path == "" || location.IsDirectory)
+			return false;
+
+		int length;
+		int fingerprint;
+		ReadFingerprint(location.Path, length, fingerprint);
+		if (length == location.Length && fingerprint == location.Fingerprint)
+			return false;
+
+		location.Length = length;
+		location.Fingerprint = fingerprint;
+		return true;
+	}
+
+	// Setups (Setup:<nome>) já resolvidos para um arquivo existente
+	static void GetResolvedSetups(array<string> setupNames)
+	{
+		if (!s_Locations)
+			return;
+
+		foreach (string logicalName, AskalConfigLocation location : s_Locations)
+		{
+			if (location.Path != "" && logicalName.IndexOf(SETUP_PREFIX) == 0)
+				setupNames.Insert(logicalName);
+		}
+	}
+
+	// Esquece o caminho resolvido (arquivo criado/movido depois do boot)
+	static void Invalidate(string logicalName)
+	{
+		if (s_Locations)
+			s_Locations.Remove(logicalName);
+	}
+
+	static void InvalidateAll()
+	{
+		if (s_Locations)
+			s_Locations.Clear();
+	}
+
+	// ========================================
+	// Candidatos (ordem = prioridade)
+	// ========================================
+	static array<string> GetCandidates(string logicalName)
+	{
+		array<string> candidatePaths = new array<string>();
+
+		if (logicalName == MARKET_CONFIG)
+		{
+			AddProfileAndMission(candidatePaths, "Askal/Market/MarketConfig.json");
+		}
+		else if (logicalName == VIRTUAL_STORE_CONFIG)
+		{
+			candidatePaths.Insert("$profile:config/Askal/Market/VirtualStore_Config.json");
+			candidatePaths.Insert("$profile:config\\Askal\\Market\\VirtualStore_Config.json");
+			candidatePaths.Insert("$profile:Askal/Market/VirtualStore_Config.json");
+			candidatePaths.Insert("$profile:Askal\\Market\\VirtualStore_Config.json");
+			candidatePaths.Insert("$mission:Askal/Market/VirtualStore_Config.json");
+			candidatePaths.Insert("$mission:Askal\\Market\\VirtualStore_Config.json");
+			candidatePaths.Insert("Askal/Market/VirtualStore_Config.json");
+			candidatePaths.Insert("Askal\\Market\\VirtualStore_Config.json");
+			candidatePaths.Insert("config/Askal/Market/VirtualStore_Config.json");
+			candidatePaths.Insert("config\\Askal\\Market\\VirtualStore_Config.json");
+		}
+		else if (logicalName == TRADERS_DIRECTORY)
+		{
+			// Priorizar $mission: sobre $profile: (traders geralmente ficam na missão)
+			candidatePaths.Insert("$mission:Askal/Traders/");
+			candidatePaths.Insert("$mission:Askal\\Traders\\");
+			candidatePaths.Insert("$profile:config/Askal/Traders/");
+			candidatePaths.Insert("$profile:config\\Askal\\Traders\\");
+			candidatePaths.Insert("$profile:Askal/Traders/");
+			candidatePaths.Insert("$profile:Askal\\Traders\\");
+		}
+		else if (logicalName.IndexOf(SETUP_PREFIX) == 0)
+		{
+			string setupName = logicalName.Substring(SETUP_PREFIX.Length(), logicalName.Length() - SETUP_PREFIX.Length());
+			candidatePaths.Insert("$profile:Askal/Market/Setups/" + setupName + ".json");
+			candidatePaths.Insert("$profile:Askal/Market/Traders/" + setupName + ".json");   // Legacy
+			candidatePaths.Insert("$mission:Askal/Traders/" + setupName + ".json");
+		}
+
+		return candidatePaths;
+	}
+
+	// Ordem histórica: $profile, $profile:config, $mission e relativos
+	protected static void AddProfileAndMission(array<string> candidatePaths, string relativePath)
+	{
+		string backslashPath = relativePath;
+		backslashPath.Replace("/", "\\");
+
+		candidatePaths.Insert("$profile:" + relativePath);
+		candidatePaths.Insert("$profile:" + backslashPath);
+		candidatePaths.Insert("$profile:config/" + relativePath);
+		candidatePaths.Insert("$profile:config\\" + backslashPath);
+		candidatePaths.Insert("$mission:" + relativePath);
+		candidatePaths.Insert("$mission:" + backslashPath);
+		candidatePaths.Insert(relativePath);
+		candidatePaths.Insert(backslashPath);
+		candidatePaths.Insert("config/" + relativePath);
+		candidatePaths.Insert("config\\" + backslashPath);
+	}
+
+	// Lê o texto cru (sem parse JSON) e calcula tamanho + hash
+	// Também usado pelo AskalHotReload para datasets e arquivos de trader
+	static void ReadFingerprint(string path, out int length, out int fingerprint)
+	{
+		length = 0;
+		fingerprint = 0;
+
+		FileHandle file = OpenFile(path, FileMode.READ);
+		if (!file)
+			return;
+
+		string line;
+		while (FGets(file, line) >= 0)
+		{
+			length += line.Length() + 1;
+			fingerprint = FoldFingerprint(fingerprint, line);
+		}
+		CloseFile(file);
+	}
+
+	// Acumula uma linha no hash; quem já lê o arquivo (ex.: AskalJsonLoader) calcula a
+	// mesma impressão digital sem uma segunda leitura
+	static int FoldFingerprint(int fingerprint, string line)
+	{
+		return fingerprint * 31 + line.Hash();
+	}
+}
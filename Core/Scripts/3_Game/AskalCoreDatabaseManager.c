@@ -319,12 +319,11 @@ class AskalCoreDatabaseManager
 	}
 	
 	// Reload database
-	// NOTA: Este método apenas marca como não carregado
-	// O loader (5_Mission) deve ser chamado externamente
+	// O catálogo atual continua servindo enquanto o AskalHotReload (5_Mission)
+	// relê apenas os arquivos alterados e troca o snapshot
 	void ReloadDatabase()
 	{
-		Print("[ASKAL_CORE] Marking database for reload...");
-		m_IsLoaded = false;
-		Print("[ASKAL_CORE] Database marked for reload. Call AskalDatabaseLoader.LoadAllDatasets() from 5_Mission to reload.");
+		Print("[ASKAL_CORE] Requesting database hot reload...");
+		AskalEventBus.Publish(AskalEventBus.RELOAD_REQUESTED);
 	}
 }
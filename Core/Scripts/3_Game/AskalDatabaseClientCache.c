@@ -146,6 +146,7 @@ class AskalDatabaseClientCache
 	{
 		m_CachedDatasets.Clear();
 		m_IsSynced = false;
+		AskalSearchIndex.GetInstance().Clear();
 		Print("[AskalCache] Cache limpo");
 	}
 	
@@ -10,10 +10,11 @@ class AskalDatabaseSync
 	private static int s_ExpectedCategories = 0;
 	private static int s_ReceivedCategories = 0;
 	private static ref map<string, ref AskalDatasetSyncData> s_BuildingDatasets = new map<string, ref AskalDatasetSyncData>();
-	private static bool s_ServerWarnTextLoaded = false;
-	private static string s_ServerWarnText = "";
 	private static bool s_ClientWarnTextLoaded = false;
 	private static string s_ClientWarnText = "";
+	private static bool s_ReplayMode = false; // AskalSyncReplayer: recepção fora de uma sessão de cliente
+	private static ref map<string, ref AskalDatasetSyncData> s_ServerSyncCache = new map<string, ref AskalDatasetSyncData>(); // Servidor: datasetID -> dados de sync
+	private static int s_ServerSyncRevision = -1;
 	
 	// ========================================
 	// ESTADO E CONTROLE
@@ -27,7 +28,7 @@ class AskalDatabaseSync
 	static void MarkClientSynced()
 	{
 		s_ClientSynced = true;
-		Print("[AskalSync] ✅ Cliente marcado como sincronizado");
+		AskalLog.Info("Sync", "✅ Cliente marcado como sincronizado");
 	}
 	
 	static void ResetSyncState()
@@ -38,42 +39,21 @@ class AskalDatabaseSync
 		s_BuildingDatasets.Clear();
 		s_ClientWarnTextLoaded = false;
 		s_ClientWarnText = "";
-		Print("[AskalSync] 🔄 Estado de sincronização resetado");
+		AskalLog.Info("Sync", "🔄 Estado de sincronização resetado");
 	}
 
-	static string GetServerWarnText()
+	static void SetReplayMode(bool replaying)
 	{
-		if (s_ServerWarnTextLoaded)
-			return s_ServerWarnText;
-
-		array<string> candidatePaths = new array<string>();
-		candidatePaths.Insert("$profile:Askal/Market/MarketConfig.json");
-		candidatePaths.Insert("$profile:Askal\\Market\\MarketConfig.json");
-		candidatePaths.Insert("$profile:config/Askal/Market/MarketConfig.json");
-		candidatePaths.Insert("$profile:config\\Askal\\Market\\MarketConfig.json");
-		candidatePaths.Insert("$mission:Askal/Market/MarketConfig.json");
-		candidatePaths.Insert("$mission:Askal\\Market\\MarketConfig.json");
-		candidatePaths.Insert("Askal/Market/MarketConfig.json");
-		candidatePaths.Insert("Askal\\Market\\MarketConfig.json");
-		candidatePaths.Insert("config/Askal/Market/MarketConfig.json");
-		candidatePaths.Insert("config\\Askal\\Market\\MarketConfig.json");
-
-		foreach (string path : candidatePaths)
-		{
-			AskalMarketConfig config = new AskalMarketConfig();
-			if (AskalMarketLoader.LoadConfig(path, config))
-			{
-				if (config && config.WarnText && config.WarnText != "")
-				{
-					s_ServerWarnText = config.WarnText;
-					Print("[AskalSync] ⚙️ WarnText carregado de: " + path);
-					break;
-				}
-			}
-		}
+		s_ReplayMode = replaying;
+	}
 
-		s_ServerWarnTextLoaded = true;
-		return s_ServerWarnText;
+	// WarnText da MarketConfig já carregada (sem reler o arquivo)
+	static string GetServerWarnText()
+	{
+		AskalMarketConfig config = AskalMarketConfig.GetInstance();
+		if (!config || !config.WarnText)
+			return "";
+		return config.WarnText;
 	}
 
 	static void SetClientWarnText(string text)
@@ -97,32 +77,43 @@ class AskalDatabaseSync
 	// ========================================
 	
 	static void SendAllDatasetsToClient(PlayerIdentity identity)
+	{
+		int startTicks = TickCount(0);
+		AskalSyncRecorder.BeginSession(identity);
+		SendAllDatasetsToClientInternal(identity);
+		AskalSyncRecorder.EndSession();
+		AskalMetrics.ObserveTicks("sync.send_all_ms", startTicks);
+		AskalMetrics.Increment("sync.sessions");
+	}
+	
+	protected static void SendAllDatasetsToClientInternal(PlayerIdentity identity)
 	{
 		if (!GetGame().IsServer())
 		{
-			Print("[AskalSync] ❌ ERROR: SendAllDatasetsToClient chamado no cliente!");
+			AskalLog.Error("Sync", "❌ SendAllDatasetsToClient chamado no cliente!");
 			return;
 		}
 		
 		if (!identity)
 		{
-			Print("[AskalSync] ❌ ERROR: PlayerIdentity NULL!");
+			AskalLog.Error("Sync", "❌ PlayerIdentity NULL!");
 			return;
 		}
 		
-		Print("[AskalSync] ========================================");
-		Print("[AskalSync] 🚀 Iniciando sincronização para: " + identity.GetName());
+		AskalLog.Debug("Sync", "========================================");
+		AskalLog.Info("Sync", "🚀 Iniciando sincronização para: " + identity.GetName());
 		
 		array<string> datasetIDs = AskalDatabase.GetAllDatasetIDs();
 		
 		if (!datasetIDs || datasetIDs.Count() == 0)
 		{
-			Print("[AskalSync] ⚠️ Nenhum dataset em memória!");
+			AskalLog.Warn("Sync", "⚠️ Nenhum dataset em memória!");
 			SendSyncComplete(identity, 0);
 			return;
 		}
 		
-		Print("[AskalSync] ✅ Encontrados " + datasetIDs.Count() + " datasets");
+		if (AskalLog.IsEnabled("Sync", AskalLog.DEBUG))
+			AskalLog.Debug("Sync", "✅ Encontrados " + datasetIDs.Count() + " datasets");
 		
 		// Preparar dados de sincronização
 		array<ref AskalDatasetSyncData> allDatasets = new array<ref AskalDatasetSyncData>();
@@ -133,27 +124,29 @@ class AskalDatabaseSync
 			Dataset sourceDataset = AskalDatabase.GetDataset(datasetID);
 			if (!sourceDataset)
 			{
-				Print("[AskalSync] ⚠️ Dataset NULL: " + datasetID);
+				AskalLog.Warn("Sync", "⚠️ Dataset NULL: " + datasetID);
 				continue;
 			}
 			
-			AskalDatasetSyncData syncDataset = ConvertDatasetToSync(sourceDataset);
+			AskalDatasetSyncData syncDataset = GetServerSyncDataset(sourceDataset);
 			if (syncDataset && syncDataset.Categories)
 			{
 				allDatasets.Insert(syncDataset);
 				totalCategories += syncDataset.Categories.Count();
-				Print("[AskalSync] 📦 Dataset preparado: " + datasetID + " (" + syncDataset.Categories.Count() + " categorias)");
+				if (AskalLog.IsEnabled("Sync", AskalLog.TRACE))
+					AskalLog.Trace("Sync", "📦 Dataset preparado: " + datasetID + " (" + syncDataset.Categories.Count() + " categorias)");
 			}
 		}
 		
 		if (allDatasets.Count() == 0)
 		{
-			Print("[AskalSync] ⚠️ Nenhum dataset válido para enviar!");
+			AskalLog.Warn("Sync", "⚠️ Nenhum dataset válido para enviar!");
 			SendSyncComplete(identity, 0);
 			return;
 		}
 		
-		Print("[AskalSync] 📤 Enviando " + allDatasets.Count() + " datasets (" + totalCategories + " categorias)...");
+		if (AskalLog.IsEnabled("Sync", AskalLog.DEBUG))
+			AskalLog.Debug("Sync", "📤 Enviando " + allDatasets.Count() + " datasets (" + totalCategories + " categorias)...");
 		
 		int sentCount = 0;
 		foreach (AskalDatasetSyncData dataset : allDatasets)
@@ -195,15 +188,44 @@ class AskalDatabaseSync
 				}
 				else
 				{
-					Print("[AskalSync] ⚠️ Falha ao enviar categoria: " + catID);
+					AskalLog.Warn("Sync", "⚠️ Falha ao enviar categoria: " + catID);
 				}
 			}
 		}
 		
 		SendSyncComplete(identity, sentCount);
 		
-		Print("[AskalSync] ✅ Sincronização completa! Enviadas " + sentCount + " categorias");
-		Print("[AskalSync] ========================================");
+		AskalLog.Info("Sync", "✅ Sincronização completa! Enviadas " + sentCount + " categorias");
+		AskalLog.Debug("Sync", "========================================");
+	}
+	
+	// Servidor: dados de sync do dataset, convertidos uma vez por revisão do catálogo
+	// (o envio só lê a estrutura, então todos os clientes compartilham a mesma cópia)
+	static AskalDatasetSyncData GetServerSyncDataset(Dataset sourceDataset)
+	{
+		if (!sourceDataset) return NULL;
+		
+		int catalogRevision = AskalDatabase.GetRevision();
+		if (s_ServerSyncRevision != catalogRevision)
+		{
+			s_ServerSyncCache.Clear();
+			s_ServerSyncRevision = catalogRevision;
+		}
+		
+		AskalDatasetSyncData cachedDataset;
+		if (s_ServerSyncCache.Find(sourceDataset.DatasetID, cachedDataset))
+			return cachedDataset;
+		
+		cachedDataset = ConvertDatasetToSync(sourceDataset);
+		if (cachedDataset)
+			s_ServerSyncCache.Set(sourceDataset.DatasetID, cachedDataset);
+		return cachedDataset;
+	}
+	
+	// Boot escalonado: converte um dataset antes do primeiro RequestDatasets
+	static bool WarmServerSyncCache(string datasetID)
+	{
+		return GetServerSyncDataset(AskalDatabase.GetDataset(datasetID)) != NULL;
 	}
 	
 	// Converte Dataset para formato de sync
@@ -326,8 +348,20 @@ class AskalDatabaseSync
 
 		Param4<string, string, int, string> header = new Param4<string, string, int, string>(dsID, dsName, catCount, iconPath);
 		GetRPCManager().SendRPC("AskalCoreModule", "SendDatasetHeader", header, true, identity, NULL);
+		int headerBytes = AskalMetrics.StringBytes(dsID) + AskalMetrics.StringBytes(dsName) + AskalMetrics.NUMBER_BYTES + AskalMetrics.StringBytes(iconPath);
+		AskalMetrics.RecordRpc("SendDatasetHeader", headerBytes);
+		if (AskalSyncRecorder.IsRecording())
+		{
+			array<string> headerArgs = new array<string>();
+			headerArgs.Insert(dsID);
+			headerArgs.Insert(dsName);
+			headerArgs.Insert(catCount.ToString());
+			headerArgs.Insert(iconPath);
+			AskalSyncRecorder.Record("SendDatasetHeader", headerBytes, 0, headerArgs);
+		}
 		
-		Print("[AskalSync] 📤 Header enviado: " + dsID + " (" + catCount + " categorias)");
+		if (AskalLog.IsEnabled("Sync", AskalLog.TRACE))
+			AskalLog.Trace("Sync", "📤 Header enviado: " + dsID + " (" + catCount + " categorias)");
 	}
 	
 	// Envia categoria OTIMIZADA (divide automaticamente em batches, reduzindo tamanho se necessário)
@@ -389,7 +423,7 @@ class AskalDatabaseSync
 					if (itemsToTry == 0)
 					{
 						// Mesmo com 1 item falhou - pular e continuar
-						Print("[AskalSync] ❌ Falha ao enviar item individual: " + itemClassNames.Get(currentIdx) + " da categoria " + syncCat.CategoryID);
+						AskalLog.Error("Sync", "❌ Falha ao enviar item individual: " + itemClassNames.Get(currentIdx) + " da categoria " + syncCat.CategoryID);
 						currentIdx++;
 					}
 				}
@@ -398,15 +432,17 @@ class AskalDatabaseSync
 		
 		if (sentBatches == 0)
 		{
-			Print("[AskalSync] ❌ Nenhum batch foi enviado com sucesso para a categoria: " + syncCat.CategoryID + " (items: " + totalItems + ")");
+			AskalLog.Error("Sync", "❌ Nenhum batch foi enviado com sucesso para a categoria: " + syncCat.CategoryID + " (items: " + totalItems + ")");
 		}
 		else if (sentBatches > 1)
 		{
-			Print("[AskalSync] ✅ Categoria dividida: " + syncCat.CategoryID + " (" + sentBatches + " batches enviados, " + totalItems + " items)");
+			if (AskalLog.IsEnabled("Sync", AskalLog.TRACE))
+				AskalLog.Trace("Sync", "✅ Categoria dividida: " + syncCat.CategoryID + " (" + sentBatches + " batches enviados, " + totalItems + " items)");
 		}
 		else
 		{
-			Print("[AskalSync] ✅ Categoria enviada: " + syncCat.CategoryID + " (" + totalItems + " items)");
+			if (AskalLog.IsEnabled("Sync", AskalLog.TRACE))
+				AskalLog.Trace("Sync", "✅ Categoria enviada: " + syncCat.CategoryID + " (" + totalItems + " items)");
 		}
 		
 		return sentBatches > 0;
@@ -482,14 +518,21 @@ class AskalDatabaseSync
 		int sizeBytes = jsonData.Length();
 		if (sizeBytes > MAX_BATCH_BYTES)
 		{
-			Print("[AskalSync] ⚠️ WARN: Item muito grande mesmo reduzido: " + className + " (" + sizeBytes + " bytes)");
+			AskalLog.Warn("Sync", "⚠️ Item muito grande mesmo reduzido: " + className + " (" + sizeBytes + " bytes)");
 			return false;
 		}
 		
 		Param1<string> params = new Param1<string>(jsonData);
 		GetRPCManager().SendRPC("AskalCoreModule", "SendCategoryBatch", params, true, identity, NULL);
+		AskalMetrics.RecordRpc("SendCategoryBatch", AskalMetrics.StringBytes(jsonData));
+		if (AskalSyncRecorder.IsRecording())
+		{
+			array<string> reducedArgs = new array<string>();
+			reducedArgs.Insert(jsonData);
+			AskalSyncRecorder.Record("SendCategoryBatch", AskalMetrics.StringBytes(jsonData), 1, reducedArgs);
+		}
 		
-		Print("[AskalSync] ⚠️ WARN: Sent reduced payload for " + className + " (" + sizeBytes + " bytes)");
+		AskalLog.Warn("Sync", "⚠️ Sent reduced payload for " + className + " (" + sizeBytes + " bytes)");
 		return true;
 	}
 	
@@ -533,7 +576,7 @@ class AskalDatabaseSync
 					// Se item individual é muito grande, enviar separadamente como reduzido
 					if (itemSize > MAX_BATCH_BYTES)
 					{
-						Print("[AskalSync] ⚠️ Item muito grande detectado: " + className + " (estimado: " + itemSize + " bytes) - enviando como payload reduzido");
+						AskalLog.Warn("Sync", "⚠️ Item muito grande detectado: " + className + " (estimado: " + itemSize + " bytes) - enviando como payload reduzido");
 						SendSingleItemAsReduced(identity, dsID, syncCat, className, itemData, batchIdx);
 						continue; // Pular este item do batch normal
 					}
@@ -597,7 +640,7 @@ class AskalDatabaseSync
 		
 		if (!jsonData || jsonData == "")
 		{
-			Print("[AskalSync] ❌ Erro ao serializar batch da categoria " + syncCat.CategoryID + " (batch " + (batchIdx + 1) + "/" + totalBatches + ")");
+			AskalLog.Error("Sync", "❌ Erro ao serializar batch da categoria " + syncCat.CategoryID + " (batch " + (batchIdx + 1) + "/" + totalBatches + ")");
 			return false;
 		}
 		
@@ -605,15 +648,23 @@ class AskalDatabaseSync
 		int sizeBytes = jsonData.Length();
 		if (sizeBytes > MAX_BATCH_BYTES)
 		{
-			Print("[AskalSync] [AVISO] Batch muito grande após serialização: " + sizeBytes + " bytes (limite: " + MAX_BATCH_BYTES + ") - Categoria: " + syncCat.CategoryID + " (batch " + (batchIdx + 1) + "/" + totalBatches + ", " + batchData.ItemClassNames.Count() + " items)");
+			AskalLog.Warn("Sync", "Batch muito grande após serialização: " + sizeBytes + " bytes (limite: " + MAX_BATCH_BYTES + ") - Categoria: " + syncCat.CategoryID + " (batch " + (batchIdx + 1) + "/" + totalBatches + ", " + batchData.ItemClassNames.Count() + " items)");
 			return false;
 		}
 		
 		// Enviar via RPC
 		Param1<string> params = new Param1<string>(jsonData);
 		GetRPCManager().SendRPC("AskalCoreModule", "SendCategoryBatch", params, true, identity, NULL);
+		AskalMetrics.RecordRpc("SendCategoryBatch", AskalMetrics.StringBytes(jsonData));
+		if (AskalSyncRecorder.IsRecording())
+		{
+			array<string> batchArgs = new array<string>();
+			batchArgs.Insert(jsonData);
+			AskalSyncRecorder.Record("SendCategoryBatch", AskalMetrics.StringBytes(jsonData), batchData.ItemClassNames.Count(), batchArgs);
+		}
 		
-		Print("[AskalSync] 📤 Batch enviado: " + syncCat.CategoryID + " [" + (batchData.BatchIndex + 1) + "/" + batchData.TotalBatches + "] (" + batchData.ItemClassNames.Count() + " items, " + sizeBytes + " bytes)");
+		if (AskalLog.IsEnabled("Sync", AskalLog.TRACE))
+			AskalLog.Trace("Sync", "📤 Batch enviado: " + syncCat.CategoryID + " [" + (batchData.BatchIndex + 1) + "/" + batchData.TotalBatches + "] (" + batchData.ItemClassNames.Count() + " items, " + sizeBytes + " bytes)");
 		return true;
 	}
 	
@@ -622,10 +673,19 @@ class AskalDatabaseSync
 	{
 		if (!identity) return;
 		
-		Print("[AskalSync] 📤 Enviando conclusão (" + totalCategories + " categorias)...");
+		if (AskalLog.IsEnabled("Sync", AskalLog.DEBUG))
+			AskalLog.Debug("Sync", "📤 Enviando conclusão (" + totalCategories + " categorias)...");
 		string warnText = GetServerWarnText();
 		Param2<int, string> completeParams = new Param2<int, string>(totalCategories, warnText);
 		GetRPCManager().SendRPC("AskalCoreModule", "SendDatasetsComplete", completeParams, true, identity, NULL);
+		AskalMetrics.RecordRpc("SendDatasetsComplete", AskalMetrics.NUMBER_BYTES + AskalMetrics.StringBytes(warnText));
+		if (AskalSyncRecorder.IsRecording())
+		{
+			array<string> completeArgs = new array<string>();
+			completeArgs.Insert(totalCategories.ToString());
+			completeArgs.Insert(warnText);
+			AskalSyncRecorder.Record("SendDatasetsComplete", AskalMetrics.NUMBER_BYTES + AskalMetrics.StringBytes(warnText), 0, completeArgs);
+		}
 	}
 	
 	// ========================================
@@ -635,9 +695,10 @@ class AskalDatabaseSync
 	// Recebe header de dataset
     static void RPC_ReceiveDatasetHeader(string dsID, string dsName, int catCount, string iconPath)
 	{
-		if (!GetGame().IsClient()) return;
+		if (!GetGame().IsClient() && !s_ReplayMode) return;
 		
-		Print("[AskalSync] 📥 Header recebido: " + dsID + " (" + catCount + " categorias esperadas)");
+		if (AskalLog.IsEnabled("Sync", AskalLog.TRACE))
+			AskalLog.Trace("Sync", "📥 Header recebido: " + dsID + " (" + catCount + " categorias esperadas)");
 		
 		if (!s_BuildingDatasets.Contains(dsID))
 		{
@@ -671,24 +732,24 @@ class AskalDatabaseSync
 	// Recebe batch de categoria (dados compactos)
 	static void RPC_ReceiveCategoryBatch(string jsonData)
 	{
-		if (!GetGame().IsClient()) return;
+		if (!GetGame().IsClient() && !s_ReplayMode) return;
 		
 		if (!jsonData || jsonData == "")
 		{
-			Print("[AskalSync] ⚠️ JSON vazio recebido");
+			AskalLog.Warn("Sync", "⚠️ JSON vazio recebido");
 			return;
 		}
 		
 		AskalCategoryBatchData batchData = new AskalCategoryBatchData();
 		if (!AskalJsonLoader<AskalCategoryBatchData>.StringToObject(jsonData, batchData))
 		{
-			Print("[AskalSync] ❌ Erro ao deserializar batch!");
+			AskalLog.Error("Sync", "❌ Erro ao deserializar batch!");
 			return;
 		}
 		
 		if (!batchData || !batchData.DatasetID || !batchData.CategoryID)
 		{
-			Print("[AskalSync] ⚠️ Batch inválido");
+			AskalLog.Warn("Sync", "⚠️ Batch inválido");
 			return;
 		}
 		
@@ -856,27 +917,29 @@ class AskalDatabaseSync
 		if (batchData.BatchIndex + 1 >= batchData.TotalBatches)
 		{
 			s_ReceivedCategories++;
-			Print("[AskalSync] ✅ Categoria completa: " + batchData.CategoryID + " (" + batchCategory.Items.Count() + " items) [" + s_ReceivedCategories + "/" + s_ExpectedCategories + "]");
+			if (AskalLog.IsEnabled("Sync", AskalLog.TRACE))
+				AskalLog.Trace("Sync", "✅ Categoria completa: " + batchData.CategoryID + " (" + batchCategory.Items.Count() + " items) [" + s_ReceivedCategories + "/" + s_ExpectedCategories + "]");
 		}
 		else
 		{
-			Print("[AskalSync] 📦 Batch recebido: " + batchData.CategoryID + " [" + (batchData.BatchIndex + 1) + "/" + batchData.TotalBatches + "]");
+			if (AskalLog.IsEnabled("Sync", AskalLog.TRACE))
+				AskalLog.Trace("Sync", "📦 Batch recebido: " + batchData.CategoryID + " [" + (batchData.BatchIndex + 1) + "/" + batchData.TotalBatches + "]");
 		}
 	}
 	
 	// Recebe conclusão
 	static void RPC_ReceiveDatasetsComplete(int totalCategories, string warnText)
 	{
-		if (!GetGame().IsClient()) return;
+		if (!GetGame().IsClient() && !s_ReplayMode) return;
 		
-		Print("[AskalSync] ========================================");
-		Print("[AskalSync] 📥 Sinal de conclusão recebido");
-		Print("[AskalSync] Esperado: " + s_ExpectedCategories + " | Recebido: " + s_ReceivedCategories + " | Servidor: " + totalCategories);
+		AskalLog.Debug("Sync", "========================================");
+		AskalLog.Info("Sync", "📥 Sinal de conclusão recebido");
+		AskalLog.Info("Sync", "Esperado: " + s_ExpectedCategories + " | Recebido: " + s_ReceivedCategories + " | Servidor: " + totalCategories);
 		SetClientWarnText(warnText);
 		
 		if (s_ReceivedCategories != s_ExpectedCategories)
 		{
-			Print("[AskalSync] ⚠️ Contagem não confere!");
+			AskalLog.Warn("Sync", "⚠️ Contagem não confere!");
 		}
 		
 		// Mover para cache permanente
@@ -903,19 +966,22 @@ class AskalDatabaseSync
 							totalItems += countCat.Items.Count();
 					}
 					
-					Print("[AskalSync] ✅ Dataset: " + dsID + " (" + ds.Categories.Count() + " categorias)");
+					if (AskalLog.IsEnabled("Sync", AskalLog.TRACE))
+						AskalLog.Trace("Sync", "✅ Dataset: " + dsID + " (" + ds.Categories.Count() + " categorias)");
 				}
 			}
 		}
 		
 		s_BuildingDatasets.Clear();
 		
-		Print("[AskalSync] ✅ SINCRONIZAÇÃO COMPLETA!");
-		Print("[AskalSync] Datasets: " + dsCount + " | Categorias: " + s_ReceivedCategories + " | Itens: " + totalItems);
-		Print("[AskalSync] ========================================");
+		AskalLog.Info("Sync", "✅ SINCRONIZAÇÃO COMPLETA!");
+		AskalLog.Info("Sync", "Datasets: " + dsCount + " | Categorias: " + s_ReceivedCategories + " | Itens: " + totalItems);
+		AskalLog.Debug("Sync", "========================================");
 		
 		cache.SetSynced(true);
+		AskalSearchIndex.GetInstance().Build(cache);
 		MarkClientSynced();
+		AskalEventBus.Publish(AskalEventBus.CATALOG_SYNCED);
 		cache.PrintCache();
 	}
 	
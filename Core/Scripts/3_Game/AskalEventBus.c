@@ -0,0 +1,47 @@
+// ==========================================
+// AskalEventBus - Barramento de eventos do cliente (3_Game)
+// Módulos 3_Game/4_World publicam; o menu 5_Mission assina em vez de
+// verificar o estado a cada frame
+// Handlers: void Handler(Param payload)
+// ==========================================
+
+class AskalEventBus
+{
+	static const string CATALOG_SYNCED = "CatalogSynced";              // payload: NULL
+	static const string VIRTUAL_STORE_CONFIG = "VirtualStoreConfig";    // payload: NULL
+	static const string INVENTORY_HEALTH = "InventoryHealth";          // payload: NULL (dados no AskalHealthSyncCache)
+	static const string NOTIFICATION_QUEUED = "NotificationQueued";    // payload: NULL (dados no AskalNotificationHelper)
+	static const string TRADE_RESPONSE = "TradeResponse";              // payload: Param3<bool success, string message, bool isPurchase>
+	static const string TRADER_MENU_REQUESTED = "TraderMenuRequested"; // payload: Param1<string traderName>
+	static const string INVENTORY_CHANGED = "InventoryChanged";        // payload: NULL (AskalInventoryModel atualizado)
+	static const string SELL_QUOTES = "SellQuotes";                    // payload: NULL (dados no AskalSellQuotes)
+	static const string PERF_STATS = "PerfStats";                      // payload: NULL (dados no AskalPerfStats)
+	static const string RELOAD_REQUESTED = "ReloadRequested";          // payload: NULL (servidor: AskalHotReload)
+
+	protected static ref map<string, ref ScriptInvoker> s_Topics;
+
+	// Invoker do tópico (Insert/Remove para assinar/cancelar)
+	static ScriptInvoker Get(string topic)
+	{
+		if (!s_Topics)
+			s_Topics = new map<string, ref ScriptInvoker>();
+
+		ScriptInvoker invoker;
+		if (!s_Topics.Find(topic, invoker))
+		{
+			invoker = new ScriptInvoker();
+			s_Topics.Insert(topic, invoker);
+		}
+		return invoker;
+	}
+
+	static void Publish(string topic, Param payload = NULL)
+	{
+		if (!s_Topics)
+			return;
+
+		ScriptInvoker invoker;
+		if (s_Topics.Find(topic, invoker))
+			invoker.Invoke(payload);
+	}
+}
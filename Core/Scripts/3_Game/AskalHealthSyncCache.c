@@ -0,0 +1,89 @@
+// ==========================================
+// AskalHealthSyncCache - Condição dos itens do inventário (cliente)
+// Health e quantidade por network ID, recebidos do servidor como snapshot
+// inicial + deltas enquanto a loja está aberta
+// ==========================================
+
+class AskalEntityCondition
+{
+	float HealthPercent;   // 0..100
+	float QuantityPercent; // 0..100, -1 = item sem quantidade
+
+	void AskalEntityCondition(float healthPercent, float quantityPercent)
+	{
+		HealthPercent = healthPercent;
+		QuantityPercent = quantityPercent;
+	}
+}
+
+class AskalHealthSyncCache
+{
+	protected static ref map<string, ref AskalEntityCondition> s_Conditions; // "low:high" -> condição
+
+	static string MakeKey(int lowBits, int highBits)
+	{
+		return lowBits.ToString() + ":" + highBits.ToString();
+	}
+
+	static string KeyOf(Object entity)
+	{
+		if (!entity)
+			return "";
+
+		int lowBits;
+		int highBits;
+		entity.GetNetworkID(lowBits, highBits);
+		return MakeKey(lowBits, highBits);
+	}
+
+	static AskalEntityCondition Get(Object entity)
+	{
+		if (!s_Conditions || !entity)
+			return NULL;
+
+		AskalEntityCondition condition;
+		if (s_Conditions.Find(KeyOf(entity), condition))
+			return condition;
+		return NULL;
+	}
+
+	// ids: pares (low, high) intercalados; removedIds no mesmo formato
+	static void Apply(bool reset, array<int> ids, array<float> healths, array<float> quantities, array<int> removedIds)
+	{
+		if (!s_Conditions)
+			s_Conditions = new map<string, ref AskalEntityCondition>();
+
+		if (reset)
+			s_Conditions.Clear();
+
+		int updated = 0;
+		if (ids && healths && quantities)
+		{
+			int entryCount = Math.Min(ids.Count() / 2, Math.Min(healths.Count(), quantities.Count()));
+			for (int i = 0; i < entryCount; i++)
+			{
+				s_Conditions.Set(MakeKey(ids[i * 2], ids[i * 2 + 1]), new AskalEntityCondition(healths[i], quantities[i]));
+				updated++;
+			}
+		}
+
+		if (removedIds)
+		{
+			for (int r = 0; r + 1 < removedIds.Count(); r += 2)
+			{
+				s_Conditions.Remove(MakeKey(removedIds[r], removedIds[r + 1]));
+			}
+		}
+
+		if (reset)
+			Print("[AskalHealthSync] 💚 Snapshot recebido: " + updated + " itens");
+
+		AskalEventBus.Publish(AskalEventBus.INVENTORY_HEALTH);
+	}
+
+	static void Clear()
+	{
+		if (s_Conditions)
+			s_Conditions.Clear();
+	}
+}
@@ -7,6 +7,7 @@
 class AskalJsonLoader<Class T>
 {
     protected static ref JsonSerializer m_Serializer;
+    protected static const int CHUNK_LINES = 64; // Linhas por bloco na leitura de arquivos
     
     static JsonSerializer GetSerializer()
     {
@@ -98,6 +99,18 @@ class AskalJsonLoader<Class T>
     // Carrega objeto de arquivo JSON (lê linha por linha para arquivos grandes)
     static bool LoadFromFile(string path, out T data, bool logSuccess = true)
     {
+        int length;
+        int fingerprint;
+        return LoadFromFileWithFingerprint(path, data, length, fingerprint, logSuccess);
+    }
+    
+    // Igual a LoadFromFile, devolvendo também a impressão digital do texto lido
+    // (mesmo cálculo do AskalConfigLocator.ReadFingerprint, na mesma leitura do parse)
+    static bool LoadFromFileWithFingerprint(string path, out T data, out int length, out int fingerprint, bool logSuccess = true)
+    {
+        length = 0;
+        fingerprint = 0;
+        
         if (!path || path == "")
         {
             Print("[AskalJsonLoader] ⚠️ Caminho inválido");
@@ -118,12 +131,27 @@ class AskalJsonLoader<Class T>
         }
         
         // Ler arquivo linha por linha (suporta arquivos grandes)
+        // Linhas vão para um bloco pequeno antes de entrar no texto final, evitando
+        // recopiar o arquivo inteiro a cada linha
         string jsonData = "";
+        string chunk = "";
+        int chunkLines = 0;
         string line;
-        while (FGets(fh, line) > 0)
-        {
-            jsonData = jsonData + "\n" + line;
-        }
+        while (FGets(fh, line) >= 0)
+        {
+            length += line.Length() + 1;
+            fingerprint = AskalConfigLocator.FoldFingerprint(fingerprint, line);
+            
+            chunk = chunk + "\n" + line;
+            chunkLines++;
+            if (chunkLines >= CHUNK_LINES)
+            {
+                jsonData = jsonData + chunk;
+                chunk = "";
+                chunkLines = 0;
+            }
+        }
+        jsonData = jsonData + chunk;
         CloseFile(fh);
         
         if (jsonData == "")
@@ -0,0 +1,241 @@
+// ==========================================
+// AskalLog - Log com níveis e filtro por módulo
+// Níveis seguem LogsLevel da VirtualStoreConfig (0 = nada, 1 = básico, 2 = debug, 3 = detalhado)
+// Caminhos quentes testam IsEnabled antes de montar a mensagem; tudo que passa
+// vai para o console, para o histórico recente (anel) e, no servidor, para o arquivo
+// ==========================================
+
+class AskalLog
+{
+	static const int OFF = 0;
+	static const int INFO = 1;    // Básico: erros, avisos e resultados de transação
+	static const int DEBUG = 2;   // Passos de cada transação
+	static const int TRACE = 3;   // Detalhado: lotes de sincronização, resolução de SetupItems
+
+	protected static const int HISTORY_CAPACITY = 256;     // Linhas mantidas no anel
+	protected static const int FILE_FLUSH_INTERVAL_MS = 5000;
+	protected static const int FILE_FLUSH_MAX_LINES = 128; // Força flush antes do intervalo
+	protected static const string LOG_DIRECTORY = "$profile:Askal/Logs";
+
+	protected static int s_Level = INFO;
+	protected static int s_MaxModuleLevel = INFO;              // Maior nível entre global e módulos (atalho do IsEnabled)
+	protected static ref map<string, int> s_ModuleLevels;      // módulo -> nível (sobrepõe o global)
+
+	protected static ref array<string> s_History;
+	protected static int s_HistoryNext = 0;
+
+	protected static bool s_FileSinkEnabled = false;
+	protected static string s_FilePath;
+	protected static ref array<string> s_FileBuffer;
+	protected static bool s_FlushScheduled = false;
+
+	// Aplica LogsLevel e as sobreposições por módulo (LogsModules da config)
+	static void Configure(int level, map<string, int> moduleLevels = NULL)
+	{
+		s_Level = Math.Clamp(level, OFF, TRACE);
+		s_ModuleLevels = new map<string, int>();
+		if (moduleLevels)
+		{
+			foreach (string module, int moduleLevel : moduleLevels)
+			{
+				s_ModuleLevels.Set(module, Math.Clamp(moduleLevel, OFF, TRACE));
+			}
+		}
+		UpdateMaxLevel();
+
+		Print("[AskalLog] ✅ Nível de log: " + s_Level + " (" + s_ModuleLevels.Count() + " módulos com nível próprio)");
+	}
+
+	static void SetModuleLevel(string module, int level)
+	{
+		if (!s_ModuleLevels)
+			s_ModuleLevels = new map<string, int>();
+		s_ModuleLevels.Set(module, Math.Clamp(level, OFF, TRACE));
+		UpdateMaxLevel();
+	}
+
+	static int GetLevel()
+	{
+		return s_Level;
+	}
+
+	// Checagem barata: use antes de concatenar mensagens de debug/trace
+	static bool IsEnabled(string module, int level)
+	{
+		if (level > s_MaxModuleLevel)
+			return false;
+
+		int moduleLevel;
+		if (s_ModuleLevels && s_ModuleLevels.Find(module, moduleLevel))
+			return level <= moduleLevel;
+		return level <= s_Level;
+	}
+
+	static void Error(string module, string message)
+	{
+		if (IsEnabled(module, INFO))
+			Write(module, message, "[ERRO] ");
+	}
+
+	static void Warn(string module, string message)
+	{
+		if (IsEnabled(module, INFO))
+			Write(module, message, "[AVISO] ");
+	}
+
+	static void Info(string module, string message)
+	{
+		if (IsEnabled(module, INFO))
+			Write(module, message);
+	}
+
+	static void Debug(string module, string message)
+	{
+		if (IsEnabled(module, DEBUG))
+			Write(module, message);
+	}
+
+	static void Trace(string module, string message)
+	{
+		if (IsEnabled(module, TRACE))
+			Write(module, message);
+	}
+
+	// Últimas linhas registradas, da mais antiga para a mais nova (maxLines <= 0 = todas)
+	static array<string> GetHistory(int maxLines = 0)
+	{
+		array<string> lines = new array<string>();
+		if (!s_History)
+			return lines;
+
+		int count = s_History.Count();
+		int take = count;
+		if (maxLines > 0 && maxLines < count)
+			take = maxLines;
+
+		// Enquanto o anel não enche, s_HistoryNext == count
+		for (int i = take; i > 0; i--)
+		{
+			int index = s_HistoryNext - i;
+			if (index < 0)
+				index += count;
+			lines.Insert(s_History[index]);
+		}
+		return lines;
+	}
+
+	// Data/hora local para relatórios e nomes de arquivo
+	// ("-", "T", ":" -> 2025-01-31T14:05:09; "", "_", "" -> 20250131_140509)
+	static string FormatTimestamp(string dateSeparator = "-", string middle = "T", string timeSeparator = ":")
+	{
+		int year;
+		int month;
+		int day;
+		GetYearMonthDay(year, month, day);
+		return year.ToString() + dateSeparator + month.ToStringLen(2) + dateSeparator + day.ToStringLen(2) + middle + FormatTime(timeSeparator);
+	}
+
+	// Só a hora local (14:05:09)
+	static string FormatTime(string timeSeparator = ":")
+	{
+		int hour;
+		int minute;
+		int second;
+		GetHourMinuteSecond(hour, minute, second);
+		return hour.ToStringLen(2) + timeSeparator + minute.ToStringLen(2) + timeSeparator + second.ToStringLen(2);
+	}
+
+	// ========================================
+	// Arquivo ($profile:Askal/Logs)
+	// ========================================
+
+	// Liga o arquivo do dia (servidor); as linhas são gravadas em lote
+	static void EnableFileSink()
+	{
+		if (s_FileSinkEnabled)
+			return;
+
+		MakeDirectory("$profile:Askal");
+		MakeDirectory(LOG_DIRECTORY);
+
+		int year;
+		int month;
+		int day;
+		GetYearMonthDay(year, month, day);
+		s_FilePath = LOG_DIRECTORY + "/Askal_" + year.ToString() + "-" + month.ToStringLen(2) + "-" + day.ToStringLen(2) + ".log";
+		s_FileBuffer = new array<string>();
+		s_FileSinkEnabled = true;
+
+		Print("[AskalLog] 📝 Log em arquivo: " + s_FilePath);
+	}
+
+	static void Flush()
+	{
+		s_FlushScheduled = false;
+		if (!s_FileSinkEnabled || s_FileBuffer.Count() == 0)
+			return;
+
+		FileHandle file = OpenFile(s_FilePath, FileMode.APPEND);
+		if (file == 0)
+		{
+			s_FileBuffer.Clear();
+			return;
+		}
+
+		foreach (string line : s_FileBuffer)
+		{
+			FPrintln(file, line);
+		}
+		CloseFile(file);
+		s_FileBuffer.Clear();
+	}
+
+	// ========================================
+	// Internos
+	// ========================================
+	// levelTag marca erros e avisos na linha ("[ERRO] ", "[AVISO] "); demais níveis sem tag
+	protected static void Write(string module, string message, string levelTag = "")
+	{
+		string line = "[Askal" + module + "] " + levelTag + message;
+		Print(line);
+
+		if (!s_History)
+			s_History = new array<string>();
+		if (s_History.Count() < HISTORY_CAPACITY)
+			s_History.Insert(line);
+		else
+			s_History.Set(s_HistoryNext, line);
+		s_HistoryNext = (s_HistoryNext + 1) % HISTORY_CAPACITY;
+
+		if (!s_FileSinkEnabled)
+			return;
+
+		s_FileBuffer.Insert(FormatTime() + " " + line);
+
+		if (s_FileBuffer.Count() >= FILE_FLUSH_MAX_LINES)
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Flush);
+			Flush();
+			return;
+		}
+
+		if (!s_FlushScheduled)
+		{
+			s_FlushScheduled = true;
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(Flush, FILE_FLUSH_INTERVAL_MS, false);
+		}
+	}
+
+	protected static void UpdateMaxLevel()
+	{
+		s_MaxModuleLevel = s_Level;
+		if (!s_ModuleLevels)
+			return;
+
+		foreach (string module, int moduleLevel : s_ModuleLevels)
+		{
+			if (moduleLevel > s_MaxModuleLevel)
+				s_MaxModuleLevel = moduleLevel;
+		}
+	}
+}
@@ -0,0 +1,343 @@
+// ==========================================
+// AskalMetrics - Métricas do servidor (contadores, gauges e histogramas de latência)
+// Tempos medidos com TickCount (10000 ticks = 1 ms); buckets fixos em ms
+// Snapshot periódico em $profile:Askal/Metrics/metrics.json
+// ==========================================
+
+class AskalMetricHistogram
+{
+	ref array<int> Buckets;   // Contagem por bucket (último = acima do maior limite)
+	int Count;
+	float SumMs;
+	float MaxMs;
+
+	void AskalMetricHistogram()
+	{
+		Buckets = new array<int>();
+		for (int i = 0; i <= AskalMetrics.GetBucketBoundsMs().Count(); i++)
+		{
+			Buckets.Insert(0);
+		}
+		Count = 0;
+		SumMs = 0;
+		MaxMs = 0;
+	}
+
+	void Observe(float ms)
+	{
+		array<float> bounds = AskalMetrics.GetBucketBoundsMs();
+		int bucket = 0;
+		while (bucket < bounds.Count() && ms > bounds[bucket])
+		{
+			bucket++;
+		}
+		Buckets[bucket] = Buckets[bucket] + 1;
+
+		Count++;
+		SumMs += ms;
+		if (ms > MaxMs)
+			MaxMs = ms;
+	}
+
+	// Limite superior do bucket que contém o percentil (aproximado; -1 = acima do maior limite)
+	float GetPercentileMs(float percentile)
+	{
+		if (Count == 0)
+			return 0;
+
+		array<float> bounds = AskalMetrics.GetBucketBoundsMs();
+		int target = Math.Ceil(Count * percentile);
+		int seen = 0;
+		for (int i = 0; i < bounds.Count(); i++)
+		{
+			seen += Buckets[i];
+			if (seen >= target)
+				return bounds[i];
+		}
+		return -1;
+	}
+}
+
+// Transação recente (para listar as mais lentas)
+class AskalMetricTransaction
+{
+	string Kind;
+	string Detail;
+	float Ms;
+	string Time;
+
+	void AskalMetricTransaction(string kind, string detail, float ms, string time)
+	{
+		Kind = kind;
+		Detail = detail;
+		Ms = ms;
+		Time = time;
+	}
+}
+
+// Formato gravado no metrics.json
+class AskalMetricHistogramSnapshot
+{
+	int Count;
+	float AvgMs;
+	float MaxMs;
+	float P50Ms;
+	float P95Ms;
+	ref array<int> Buckets;
+}
+
+class AskalMetricsSnapshot
+{
+	string Timestamp;
+	int UptimeSeconds;
+	ref array<float> BucketBoundsMs;
+	ref map<string, int> Counters;
+	ref map<string, float> Gauges;
+	ref map<string, ref AskalMetricHistogramSnapshot> Histograms;
+}
+
+class AskalMetrics
+{
+	static const int NUMBER_BYTES = 4;                   // int/float/bool no payload
+	protected static const int SNAPSHOT_INTERVAL_MS = 60000;
+	protected static const int TRANSACTION_HISTORY = 64;   // Transações recentes mantidas no anel
+	protected static const string METRICS_DIRECTORY = "$profile:Askal/Metrics";
+	protected static const string METRICS_FILE = "$profile:Askal/Metrics/metrics.json";
+
+	protected static ref array<float> s_BucketBoundsMs;
+	protected static ref map<string, int> s_Counters;
+	protected static ref map<string, float> s_Gauges;
+	protected static ref map<string, ref AskalMetricHistogram> s_Histograms;
+	protected static ref array<ref AskalMetricTransaction> s_Transactions;
+	protected static int s_TransactionNext = 0;
+	protected static bool s_SnapshotsStarted = false;
+	protected static int s_StartedAt = 0;
+
+	// Limites superiores dos buckets de latência (ms)
+	static array<float> GetBucketBoundsMs()
+	{
+		if (!s_BucketBoundsMs)
+			s_BucketBoundsMs = {0.5, 1, 2, 5, 10, 25, 50, 100, 250, 500, 1000};
+		return s_BucketBoundsMs;
+	}
+
+	static void Increment(string name, int amount = 1)
+	{
+		if (!s_Counters)
+			s_Counters = new map<string, int>();
+
+		int current;
+		s_Counters.Find(name, current);
+		s_Counters.Set(name, current + amount);
+	}
+
+	static void SetGauge(string name, float value)
+	{
+		if (!s_Gauges)
+			s_Gauges = new map<string, float>();
+		s_Gauges.Set(name, value);
+	}
+
+	static void ObserveMs(string name, float ms)
+	{
+		if (!s_Histograms)
+			s_Histograms = new map<string, ref AskalMetricHistogram>();
+
+		AskalMetricHistogram histogram;
+		if (!s_Histograms.Find(name, histogram))
+		{
+			histogram = new AskalMetricHistogram();
+			s_Histograms.Insert(name, histogram);
+		}
+		histogram.Observe(ms);
+	}
+
+	// startTicks = TickCount(0) no início da operação; retorna os ms medidos
+	static float ObserveTicks(string name, int startTicks)
+	{
+		float elapsedMs = TickCount(startTicks) / 10000.0;
+		ObserveMs(name, elapsedMs);
+		return elapsedMs;
+	}
+
+	// Guarda a transação no anel de recentes (kind = "purchase", "sell", ...)
+	static void RecordTransaction(string kind, string detail, float ms)
+	{
+		if (!s_Transactions)
+			s_Transactions = new array<ref AskalMetricTransaction>();
+
+		AskalMetricTransaction transaction = new AskalMetricTransaction(kind, detail, ms, AskalLog.FormatTime());
+		if (s_Transactions.Count() < TRANSACTION_HISTORY)
+			s_Transactions.Insert(transaction);
+		else
+			s_Transactions.Set(s_TransactionNext, transaction);
+		s_TransactionNext = (s_TransactionNext + 1) % TRANSACTION_HISTORY;
+	}
+
+	// As transações mais lentas entre as recentes, da mais lenta para a mais rápida
+	static array<AskalMetricTransaction> GetSlowestTransactions(int count)
+	{
+		array<AskalMetricTransaction> slowest = new array<AskalMetricTransaction>();
+		if (!s_Transactions)
+			return slowest;
+
+		foreach (AskalMetricTransaction transaction : s_Transactions)
+		{
+			int insertAt = slowest.Count();
+			while (insertAt > 0 && slowest[insertAt - 1].Ms < transaction.Ms)
+			{
+				insertAt--;
+			}
+			if (insertAt >= count)
+				continue;
+
+			slowest.InsertAt(transaction, insertAt);
+			if (slowest.Count() > count)
+				slowest.Remove(slowest.Count() - 1);
+		}
+		return slowest;
+	}
+
+	static array<string> GetHistogramNames()
+	{
+		array<string> names = new array<string>();
+		if (s_Histograms)
+		{
+			foreach (string name, AskalMetricHistogram histogram : s_Histograms)
+			{
+				names.Insert(name);
+			}
+		}
+		names.Sort();
+		return names;
+	}
+
+	// Bytes estimados do payload (strings = 4 + tamanho, números = NUMBER_BYTES); sem o overhead do CF
+	static void RecordRpc(string rpcName, int payloadBytes)
+	{
+		Increment("rpc." + rpcName + ".count");
+		Increment("rpc." + rpcName + ".bytes", payloadBytes);
+		Increment("rpc.total.bytes", payloadBytes);
+	}
+
+	static int StringBytes(string value)
+	{
+		return NUMBER_BYTES + value.Length();
+	}
+
+	static int StringArrayBytes(array<string> values)
+	{
+		int bytes = NUMBER_BYTES;
+		if (!values)
+			return bytes;
+		foreach (string value : values)
+		{
+			bytes += StringBytes(value);
+		}
+		return bytes;
+	}
+
+	static AskalMetricHistogram GetHistogram(string name)
+	{
+		if (!s_Histograms)
+			return NULL;
+		return s_Histograms.Get(name);
+	}
+
+	static int GetCounter(string name)
+	{
+		int value;
+		if (s_Counters)
+			s_Counters.Find(name, value);
+		return value;
+	}
+
+	// ========================================
+	// Snapshot ($profile:Askal/Metrics/metrics.json)
+	// ========================================
+
+	// Servidor: grava o snapshot a cada SNAPSHOT_INTERVAL_MS
+	static void StartSnapshots()
+	{
+		if (s_SnapshotsStarted)
+			return;
+
+		s_SnapshotsStarted = true;
+		s_StartedAt = GetGame().GetTime();
+		MakeDirectory("$profile:Askal");
+		MakeDirectory(METRICS_DIRECTORY);
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(WriteSnapshot, SNAPSHOT_INTERVAL_MS, true);
+		Print("[AskalMetrics] 📊 Snapshot de métricas a cada " + (SNAPSHOT_INTERVAL_MS / 1000) + "s em " + METRICS_FILE);
+	}
+
+	static void StopSnapshots()
+	{
+		if (!s_SnapshotsStarted)
+			return;
+
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(WriteSnapshot);
+		WriteSnapshot();
+		s_SnapshotsStarted = false;
+	}
+
+	static AskalMetricsSnapshot BuildSnapshot()
+	{
+		array<Man> players = new array<Man>();
+		GetGame().GetPlayers(players);
+		SetGauge("players.online", players.Count());
+
+		AskalMetricsSnapshot snapshot = new AskalMetricsSnapshot();
+		snapshot.Timestamp = AskalLog.FormatTimestamp();
+		snapshot.UptimeSeconds = (GetGame().GetTime() - s_StartedAt) / 1000;
+		snapshot.BucketBoundsMs = GetBucketBoundsMs();
+
+		snapshot.Counters = new map<string, int>();
+		if (s_Counters)
+			snapshot.Counters.Copy(s_Counters);
+
+		snapshot.Gauges = new map<string, float>();
+		if (s_Gauges)
+			snapshot.Gauges.Copy(s_Gauges);
+
+		snapshot.Histograms = new map<string, ref AskalMetricHistogramSnapshot>();
+		if (s_Histograms)
+		{
+			foreach (string name, AskalMetricHistogram histogram : s_Histograms)
+			{
+				AskalMetricHistogramSnapshot entry = new AskalMetricHistogramSnapshot();
+				entry.Count = histogram.Count;
+				entry.AvgMs = 0;
+				if (histogram.Count > 0)
+					entry.AvgMs = histogram.SumMs / histogram.Count;
+				entry.MaxMs = histogram.MaxMs;
+				entry.P50Ms = histogram.GetPercentileMs(0.5);
+				entry.P95Ms = histogram.GetPercentileMs(0.95);
+				entry.Buckets = histogram.Buckets;
+				snapshot.Histograms.Insert(name, entry);
+			}
+		}
+		return snapshot;
+	}
+
+	static void WriteSnapshot()
+	{
+		AskalMetricsSnapshot snapshot = BuildSnapshot();
+
+		JsonSerializer serializer = new JsonSerializer();
+		string jsonData;
+		if (!serializer.WriteToString(snapshot, true, jsonData))
+		{
+			AskalLog.Error("Metrics", "❌ Erro ao serializar snapshot de métricas");
+			return;
+		}
+
+		FileHandle file = OpenFile(METRICS_FILE, FileMode.WRITE);
+		if (file == 0)
+		{
+			AskalLog.Error("Metrics", "❌ Não foi possível gravar: " + METRICS_FILE);
+			return;
+		}
+		FPrintln(file, jsonData);
+		CloseFile(file);
+	}
+}
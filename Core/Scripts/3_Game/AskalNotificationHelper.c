@@ -10,14 +10,16 @@ class AskalNotificationData
 	string Description; // Descrição detalhada (inclui attachments, etc)
 	int Price;
 	bool IsPurchase;
+	string OwnerId; // SteamID de quem gerou (servidor); vazio no cliente
 	
-	void AskalNotificationData(string actionType, string itemClass, string description, int price, bool isPurchase)
+	void AskalNotificationData(string actionType, string itemClass, string description, int price, bool isPurchase, string ownerId = "")
 	{
 		ActionType = actionType;
 		ItemClassName = itemClass;
 		Description = description;
 		Price = price;
 		IsPurchase = isPurchase;
+		OwnerId = ownerId;
 	}
 }
 
@@ -31,22 +33,24 @@ class AskalNotificationHelper
 			s_PendingNotifications = new array<ref AskalNotificationData>();
 	}
 	
-	static void AddPurchaseNotification(string itemClassName, int price, string description = "")
+	static void AddPurchaseNotification(string itemClassName, int price, string description = "", string ownerId = "")
 	{
 		Init();
 		if (!description || description == "")
 			description = itemClassName;
-		s_PendingNotifications.Insert(new AskalNotificationData("COMPRA", itemClassName, description, price, true));
+		s_PendingNotifications.Insert(new AskalNotificationData("COMPRA", itemClassName, description, price, true, ownerId));
 		Print("[AskalNotification] 📢 Notificação de compra adicionada: " + itemClassName + " ($" + price.ToString() + ")");
+		AskalEventBus.Publish(AskalEventBus.NOTIFICATION_QUEUED);
 	}
 	
-	static void AddSellNotification(string itemClassName, int price, string description = "")
+	static void AddSellNotification(string itemClassName, int price, string description = "", string ownerId = "")
 	{
 		Init();
 		if (!description || description == "")
 			description = itemClassName;
-		s_PendingNotifications.Insert(new AskalNotificationData("VENDA", itemClassName, description, price, false));
+		s_PendingNotifications.Insert(new AskalNotificationData("VENDA", itemClassName, description, price, false, ownerId));
 		Print("[AskalNotification] 📢 Notificação de venda adicionada: " + description + " ($" + price.ToString() + ")");
+		AskalEventBus.Publish(AskalEventBus.NOTIFICATION_QUEUED);
 	}
 	
 	static array<ref AskalNotificationData> GetPendingNotifications()
@@ -61,52 +65,26 @@ class AskalNotificationHelper
 			s_PendingNotifications.Clear();
 	}
 	
-	static void RemoveNotification(int index)
+	// Remove só as notificações de donos com o prefixo (ex.: jogadores do simulador de carga)
+	static void ClearNotificationsForOwnerPrefix(string ownerPrefix)
 	{
-		if (s_PendingNotifications && index >= 0 && index < s_PendingNotifications.Count())
+		if (!s_PendingNotifications || !ownerPrefix || ownerPrefix == "")
+			return;
+		
+		for (int i = s_PendingNotifications.Count() - 1; i >= 0; i--)
 		{
-			s_PendingNotifications.Remove(index);
+			AskalNotificationData notification = s_PendingNotifications.Get(i);
+			if (notification && notification.OwnerId.IndexOf(ownerPrefix) == 0)
+				s_PendingNotifications.RemoveOrdered(i);
 		}
 	}
 	
-	// ========================================
-	// SISTEMA DE HEALTH DOS ITENS
-	// ========================================
-	
-	protected static ref array<ref Param2<string, float>> s_InventoryHealth;
-	
-	static void SetInventoryHealth(array<ref Param2<string, float>> healthArray)
+	static void RemoveNotification(int index)
 	{
-		if (!s_InventoryHealth)
-			s_InventoryHealth = new array<ref Param2<string, float>>();
-		
-		s_InventoryHealth.Clear();
-		
-		if (healthArray)
+		if (s_PendingNotifications && index >= 0 && index < s_PendingNotifications.Count())
 		{
-			for (int i = 0; i < healthArray.Count(); i++)
-			{
-				Param2<string, float> healthData = healthArray.Get(i);
-				if (healthData)
-					s_InventoryHealth.Insert(healthData);
-			}
+			s_PendingNotifications.Remove(index);
 		}
-		
-		Print("[AskalNotification] 💚 Health armazenado para " + s_InventoryHealth.Count() + " itens");
-	}
-	
-	static array<ref Param2<string, float>> GetInventoryHealth()
-	{
-		if (!s_InventoryHealth)
-			s_InventoryHealth = new array<ref Param2<string, float>>();
-		
-		return s_InventoryHealth;
-	}
-	
-	static void ClearInventoryHealth()
-	{
-		if (s_InventoryHealth)
-			s_InventoryHealth.Clear();
 	}
 	
 	// ========================================
@@ -134,6 +112,7 @@ class AskalNotificationHelper
 		if (s_PendingTraderSetupItems)
 			setupCount = s_PendingTraderSetupItems.Count();
 		Print("[AskalNotification] 📦 SetupItems: " + setupCount.ToString() + " entradas");
+		AskalEventBus.Publish(AskalEventBus.TRADER_MENU_REQUESTED, new Param1<string>(traderName));
 	}
 	
 	static string GetPendingTraderMenu()
@@ -0,0 +1,55 @@
+// ==========================================
+// AskalPerfStats - Última resposta do console de performance (cliente)
+// Linhas já formatadas pelo servidor (AskalPerfConsoleModule)
+// ==========================================
+
+class AskalPerfStats
+{
+	protected static ref array<string> s_Lines;
+	protected static int s_ReceivedAt = 0;
+	protected static bool s_Denied = false;
+	protected static int s_DeniedAt = 0;
+
+	static void Apply(bool authorized, array<string> lines)
+	{
+		s_Lines = new array<string>();
+		if (lines)
+			s_Lines.Copy(lines);
+		s_ReceivedAt = GetGame().GetTime();
+		s_Denied = !authorized;
+		if (s_Denied)
+			s_DeniedAt = s_ReceivedAt;
+
+		AskalEventBus.Publish(AskalEventBus.PERF_STATS);
+	}
+
+	static array<string> GetLines()
+	{
+		if (!s_Lines)
+			s_Lines = new array<string>();
+		return s_Lines;
+	}
+
+	// Servidor negou o acesso (o painel para de pedir)
+	static bool IsDenied()
+	{
+		return s_Denied;
+	}
+
+	// ms de jogo em que o acesso foi negado pela última vez
+	static int GetDeniedAt()
+	{
+		return s_DeniedAt;
+	}
+
+	// ms de jogo em que a última resposta chegou (0 = nunca)
+	static int GetReceivedAt()
+	{
+		return s_ReceivedAt;
+	}
+
+	static void Request()
+	{
+		GetRPCManager().SendRPC("AskalCoreModule", "RequestPerfStats", NULL, true, NULL, NULL);
+	}
+}
@@ -0,0 +1,101 @@
+// ==========================================
+// AskalPermissionCache - Permissions do AskalPlayerData com validade curta (servidor)
+// Checagens de admin em RPCs (console de performance, hot reload) não leem o arquivo
+// do player a cada chamada; respostas negativas também ficam em cache
+// ==========================================
+
+class AskalPermissionCacheEntry
+{
+	ref map<string, int> Permissions;
+	int LoadedAtMs;
+
+	void AskalPermissionCacheEntry(map<string, int> permissions, int loadedAtMs)
+	{
+		Permissions = permissions;
+		LoadedAtMs = loadedAtMs;
+	}
+}
+
+class AskalPermissionCache
+{
+	static const int TTL_MS = 30000;
+
+	// Acima deste número de entradas, remove as expiradas
+	protected static const int PRUNE_THRESHOLD = 256;
+
+	protected static ref map<string, ref AskalPermissionCacheEntry> s_Entries; // steamId -> permissões
+
+	// Nível da permissão (0 = sem permissão)
+	static int GetLevel(PlayerIdentity identity, string permissionKey)
+	{
+		if (!identity)
+			return 0;
+
+		string steamId = identity.GetPlainId();
+		if (!steamId || steamId == "")
+			steamId = identity.GetId();
+
+		AskalPermissionCacheEntry entry = GetEntry(steamId);
+		if (!entry || !entry.Permissions)
+			return 0;
+
+		int level;
+		if (!entry.Permissions.Find(permissionKey, level))
+			return 0;
+		return level;
+	}
+
+	// Esquece as permissões guardadas (ex.: arquivo do player editado)
+	static void Invalidate(string steamId = "")
+	{
+		if (!s_Entries)
+			return;
+
+		if (steamId == "")
+			s_Entries.Clear();
+		else
+			s_Entries.Remove(steamId);
+	}
+
+	protected static AskalPermissionCacheEntry GetEntry(string steamId)
+	{
+		if (!s_Entries)
+			s_Entries = new map<string, ref AskalPermissionCacheEntry>();
+
+		int nowMs = GetGame().GetTime();
+		AskalPermissionCacheEntry entry;
+		if (s_Entries.Find(steamId, entry) && nowMs - entry.LoadedAtMs < TTL_MS)
+		{
+			AskalMetrics.Increment("cache.permission.hit");
+			return entry;
+		}
+
+		AskalMetrics.Increment("cache.permission.miss");
+		if (s_Entries.Count() >= PRUNE_THRESHOLD)
+			PruneExpired(nowMs);
+
+		map<string, int> permissions = NULL;
+		AskalPlayerData playerData = AskalPlayerBalance.LoadPlayerData(steamId);
+		if (playerData)
+			permissions = playerData.Permissions;
+
+		entry = new AskalPermissionCacheEntry(permissions, nowMs);
+		s_Entries.Set(steamId, entry);
+		return entry;
+	}
+
+	protected static void PruneExpired(int nowMs)
+	{
+		array<string> expiredKeys = new array<string>();
+		foreach (string steamId, AskalPermissionCacheEntry entry : s_Entries)
+		{
+			if (nowMs - entry.LoadedAtMs >= TTL_MS)
+				expiredKeys.Insert(steamId);
+		}
+
+		foreach (string expiredKey : expiredKeys)
+		{
+			s_Entries.Remove(expiredKey);
+		}
+	}
+}
@@ -75,6 +75,14 @@ class AskalPlayerBalance
 		if (!steamId || steamId == "")
 			return NULL;
 
+		int startTicks = TickCount(0);
+		AskalPlayerData playerData = LoadPlayerDataInternal(steamId);
+		AskalMetrics.ObserveTicks("player.load_ms", startTicks);
+		return playerData;
+	}
+	
+	protected static AskalPlayerData LoadPlayerDataInternal(string steamId)
+	{
 		Init();
 
 		string filePath = GetPlayerFilePath(steamId);
@@ -208,7 +216,9 @@ class AskalPlayerBalance
 		Init();
 		
 		string filePath = GetPlayerFilePath(steamId);
+		int startTicks = TickCount(0);
 		bool success = AskalJsonLoader<AskalPlayerData>.SaveToFile(filePath, playerData);
+		AskalMetrics.ObserveTicks("player.save_ms", startTicks);
 		
 		if (success)
 		{
@@ -216,6 +226,7 @@ class AskalPlayerBalance
 		}
 		else
 		{
+			AskalMetrics.Increment("player.save_failure");
 			Print("[AskalBalance] ❌ Erro ao salvar dados do player: " + steamId);
 		}
 		
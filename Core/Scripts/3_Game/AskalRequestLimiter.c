@@ -0,0 +1,255 @@
+// ==========================================
+// AskalRequestLimiter - Rate limit de RPCs de trade no servidor (3_Game)
+// Token bucket por identidade + tipo de RPC e coalescência de requisições duplicadas
+// ==========================================
+
+class AskalRateBucket
+{
+	float Tokens;
+	int LastRefillMs;
+
+	void AskalRateBucket(float tokens, int nowMs)
+	{
+		Tokens = tokens;
+		LastRefillMs = nowMs;
+	}
+}
+
+class AskalRequestLimiter
+{
+	static const string KIND_PURCHASE = "purchase";
+	static const string KIND_SELL = "sell";
+	static const string KIND_HEALTH = "health";
+	static const string KIND_QUOTE = "quote";
+	static const string KIND_ADMIN = "admin";   // Console de performance / hot reload
+
+	// Capacidade do bucket (burst) e recarga em tokens por segundo
+	static const float PURCHASE_CAPACITY = 10.0;
+	static const float PURCHASE_REFILL_PER_SEC = 4.0;
+	static const float SELL_CAPACITY = 10.0;
+	static const float SELL_REFILL_PER_SEC = 4.0;
+	static const float HEALTH_CAPACITY = 3.0;
+	static const float HEALTH_REFILL_PER_SEC = 0.5;
+	static const float QUOTE_CAPACITY = 5.0;
+	static const float QUOTE_REFILL_PER_SEC = 1.0;
+	static const float ADMIN_CAPACITY = 3.0;
+	static const float ADMIN_REFILL_PER_SEC = 1.0;
+
+	// Lote (carrinho, venda em lote) é uma ação só: 1 token + fração por linha, com teto
+	// abaixo do burst para um lote grande não ser recusado com o bucket quase cheio
+	static const float BATCH_LINE_COST = 0.1;
+	static const float BATCH_MAX_COST = 4.0;
+
+	// Janela de coalescência (requisições duplicadas dentro dela são unidas)
+	static const int COALESCE_WINDOW_MS = 250;
+
+	// Acima deste número de buckets, remove os que estão cheios (jogadores inativos)
+	protected static const int PRUNE_THRESHOLD = 256;
+
+	// Rejeições são agregadas num único log por intervalo (flood não vira spam no RPT)
+	protected static const int REJECT_LOG_INTERVAL_MS = 10000;
+	protected static int s_LastRejectLogMs = -REJECT_LOG_INTERVAL_MS;
+	protected static int s_RejectsSinceLog = 0;
+	protected static string s_LastRejectedName = "";
+
+	protected static ref map<string, ref AskalRateBucket> s_Buckets;  // "<identityId>|<kind>" -> bucket
+	protected static ref map<string, bool> s_Coalescing;              // "<identityId>|<kind>" -> requisição pendente
+	protected static ref map<string, int> s_Accepted;                 // kind -> aceitas
+	protected static ref map<string, int> s_Rejected;                 // kind -> rejeitadas pelo limite
+	protected static ref map<string, int> s_Coalesced;                // kind -> unidas a uma pendente
+
+	static void Init()
+	{
+		if (!s_Buckets)
+			s_Buckets = new map<string, ref AskalRateBucket>();
+		if (!s_Coalescing)
+			s_Coalescing = new map<string, bool>();
+		if (!s_Accepted)
+			s_Accepted = new map<string, int>();
+		if (!s_Rejected)
+			s_Rejected = new map<string, int>();
+		if (!s_Coalesced)
+			s_Coalesced = new map<string, int>();
+	}
+
+	// Consome "cost" tokens do bucket da identidade para o tipo de RPC (lotes: GetBatchCost)
+	// Retorna false (e conta a rejeição) quando o limite foi excedido
+	static bool TryAcquire(PlayerIdentity identity, string kind, float cost = 1.0)
+	{
+		Init();
+		if (!identity)
+			return false;
+
+		int nowMs = GetGame().GetTime();
+		string bucketKey = BuildKey(identity, kind);
+		float capacity = GetCapacity(kind);
+
+		AskalRateBucket bucket;
+		if (!s_Buckets.Find(bucketKey, bucket))
+		{
+			if (s_Buckets.Count() >= PRUNE_THRESHOLD)
+				PruneIdleBuckets(nowMs);
+
+			bucket = new AskalRateBucket(capacity, nowMs);
+			s_Buckets.Insert(bucketKey, bucket);
+		}
+
+		int elapsedMs = nowMs - bucket.LastRefillMs;
+		if (elapsedMs > 0)
+		{
+			bucket.Tokens = Math.Min(capacity, bucket.Tokens + elapsedMs * GetRefillPerSec(kind) / 1000.0);
+			bucket.LastRefillMs = nowMs;
+		}
+
+		if (bucket.Tokens < cost)
+		{
+			Increment(s_Rejected, kind);
+			LogRejection(identity, kind, nowMs);
+			return false;
+		}
+
+		bucket.Tokens -= cost;
+		Increment(s_Accepted, kind);
+		return true;
+	}
+
+	// Marca uma requisição como pendente; retorna false se já houver uma igual na fila (coalescida)
+	static bool BeginCoalesce(PlayerIdentity identity, string kind)
+	{
+		Init();
+		if (!identity)
+			return false;
+
+		string coalesceKey = BuildKey(identity, kind);
+		if (s_Coalescing.Contains(coalesceKey))
+		{
+			Increment(s_Coalesced, kind);
+			return false;
+		}
+
+		s_Coalescing.Insert(coalesceKey, true);
+		return true;
+	}
+
+	static void EndCoalesce(string identityId, string kind)
+	{
+		Init();
+		s_Coalescing.Remove(identityId + "|" + kind);
+	}
+
+	// Custo de um lote com "lines" linhas (ver BATCH_LINE_COST)
+	static float GetBatchCost(int lines)
+	{
+		return Math.Min(1.0 + lines * BATCH_LINE_COST, BATCH_MAX_COST);
+	}
+
+	// ========================================
+	// Contadores (monitoramento)
+	// ========================================
+	static int GetAcceptedCount(string kind)
+	{
+		Init();
+		return s_Accepted.Get(kind);
+	}
+
+	static int GetRejectedCount(string kind)
+	{
+		Init();
+		return s_Rejected.Get(kind);
+	}
+
+	static int GetCoalescedCount(string kind)
+	{
+		Init();
+		return s_Coalesced.Get(kind);
+	}
+
+	static string GetStatsSummary()
+	{
+		Init();
+		string summary = "";
+		array<string> kinds = {KIND_PURCHASE, KIND_SELL, KIND_HEALTH, KIND_QUOTE, KIND_ADMIN};
+		foreach (string kind : kinds)
+		{
+			if (summary != "")
+				summary += " | ";
+			summary += kind + ": ok=" + s_Accepted.Get(kind) + " rejected=" + s_Rejected.Get(kind) + " coalesced=" + s_Coalesced.Get(kind);
+		}
+		return summary;
+	}
+
+	static void ResetCounters()
+	{
+		Init();
+		s_Accepted.Clear();
+		s_Rejected.Clear();
+		s_Coalesced.Clear();
+	}
+
+	// ========================================
+	// Internos
+	// ========================================
+	protected static string BuildKey(PlayerIdentity identity, string kind)
+	{
+		return identity.GetId() + "|" + kind;
+	}
+
+	protected static float GetCapacity(string kind)
+	{
+		if (kind == KIND_PURCHASE)
+			return PURCHASE_CAPACITY;
+		if (kind == KIND_SELL)
+			return SELL_CAPACITY;
+		if (kind == KIND_QUOTE)
+			return QUOTE_CAPACITY;
+		if (kind == KIND_ADMIN)
+			return ADMIN_CAPACITY;
+		return HEALTH_CAPACITY;
+	}
+
+	protected static float GetRefillPerSec(string kind)
+	{
+		if (kind == KIND_PURCHASE)
+			return PURCHASE_REFILL_PER_SEC;
+		if (kind == KIND_SELL)
+			return SELL_REFILL_PER_SEC;
+		if (kind == KIND_QUOTE)
+			return QUOTE_REFILL_PER_SEC;
+		if (kind == KIND_ADMIN)
+			return ADMIN_REFILL_PER_SEC;
+		return HEALTH_REFILL_PER_SEC;
+	}
+
+	protected static void LogRejection(PlayerIdentity identity, string kind, int nowMs)
+	{
+		s_RejectsSinceLog++;
+		s_LastRejectedName = identity.GetName();
+		if (nowMs - s_LastRejectLogMs < REJECT_LOG_INTERVAL_MS)
+			return;
+
+		AskalLog.Warn("Limiter", "⛔ " + s_RejectsSinceLog + " requisições rejeitadas (rate limit) nos últimos " + (REJECT_LOG_INTERVAL_MS / 1000) + "s, última: " + kind + " de " + s_LastRejectedName);
+		s_LastRejectLogMs = nowMs;
+		s_RejectsSinceLog = 0;
+	}
+
+	protected static void Increment(map<string, int> counters, string kind)
+	{
+		counters.Set(kind, counters.Get(kind) + 1);
+	}
+
+	protected static void PruneIdleBuckets(int nowMs)
+	{
+		array<string> idleKeys = new array<string>();
+		foreach (string bucketKey, AskalRateBucket bucket : s_Buckets)
+		{
+			// Sem atividade há tempo suficiente para o bucket estar cheio de novo
+			if (nowMs - bucket.LastRefillMs > 60000)
+				idleKeys.Insert(bucketKey);
+		}
+
+		foreach (string idleKey : idleKeys)
+		{
+			s_Buckets.Remove(idleKey);
+		}
+	}
+}
@@ -0,0 +1,299 @@
+// ==========================================
+// AskalSearchIndex - Índice de pesquisa do catálogo no cliente
+// Construído uma vez ao final da sincronização: nomes normalizados,
+// tokens e tabela de trigramas -> entradas (itens e variantes)
+// ==========================================
+
+class AskalSearchEntry
+{
+	string ClassName;
+	string DisplayName;
+	string DisplayLower;
+	string ClassLower;
+	string DatasetID;
+	string CategoryID;
+	AskalItemSyncData Item;   // Item do catálogo (para variantes: o item base)
+	bool IsVariant;
+
+	void AskalSearchEntry(string className, string displayName, string datasetID, string categoryID, AskalItemSyncData item, bool isVariant)
+	{
+		ClassName = className;
+		DisplayName = displayName;
+		DatasetID = datasetID;
+		CategoryID = categoryID;
+		Item = item;
+		IsVariant = isVariant;
+
+		DisplayLower = displayName;
+		DisplayLower.ToLower();
+		ClassLower = className;
+		ClassLower.ToLower();
+	}
+}
+
+class AskalSearchIndex
+{
+	protected static const int GRAM_SIZE = 3;
+	protected static const string TOKEN_SEPARATORS = " -_.,;:/\\()[]{}'\"+#";
+
+	private static ref AskalSearchIndex s_Instance;
+
+	protected ref array<ref AskalSearchEntry> m_Entries;   // Ordem do catálogo (dataset > categoria > item > variantes)
+	protected ref map<string, ref array<int>> m_Grams;     // trigrama -> entradas (ordem crescente)
+	protected bool m_IsBuilt;
+	protected int m_Revision;
+
+	void AskalSearchIndex()
+	{
+		m_Entries = new array<ref AskalSearchEntry>();
+		m_Grams = new map<string, ref array<int>>();
+		m_IsBuilt = false;
+		m_Revision = 0;
+	}
+
+	static AskalSearchIndex GetInstance()
+	{
+		if (!s_Instance)
+			s_Instance = new AskalSearchIndex();
+		return s_Instance;
+	}
+
+	bool IsBuilt()
+	{
+		return m_IsBuilt;
+	}
+
+	// Incrementa a cada reconstrução (resultados anteriores deixam de valer)
+	int GetRevision()
+	{
+		return m_Revision;
+	}
+
+	int GetEntryCount()
+	{
+		return m_Entries.Count();
+	}
+
+	AskalSearchEntry GetEntry(int index)
+	{
+		if (index < 0 || index >= m_Entries.Count())
+			return NULL;
+		return m_Entries[index];
+	}
+
+	void Clear()
+	{
+		m_Entries.Clear();
+		m_Grams.Clear();
+		m_IsBuilt = false;
+		m_Revision++;
+	}
+
+	// Monta o índice a partir do cache sincronizado
+	void Build(AskalDatabaseClientCache cache)
+	{
+		Clear();
+
+		if (!cache || !cache.GetDatasets())
+			return;
+
+		int startTime = GetGame().GetTime();
+		map<string, bool> processedClasses = new map<string, bool>();
+		map<string, bool> variantClassLookup = new map<string, bool>();
+		map<string, ref AskalDatasetSyncData> datasets = cache.GetDatasets();
+
+		for (int dsIdx = 0; dsIdx < datasets.Count(); dsIdx++)
+		{
+			string datasetID = datasets.GetKey(dsIdx);
+			AskalDatasetSyncData dataset = datasets.GetElement(dsIdx);
+			if (!dataset || !dataset.Categories)
+				continue;
+
+			for (int catIdx = 0; catIdx < dataset.Categories.Count(); catIdx++)
+			{
+				string categoryID = dataset.Categories.GetKey(catIdx);
+				AskalCategorySyncData category = dataset.Categories.GetElement(catIdx);
+				if (!category || !category.Items)
+					continue;
+
+				for (int itemIdx = 0; itemIdx < category.Items.Count(); itemIdx++)
+				{
+					string itemClassName = category.Items.GetKey(itemIdx);
+					AskalItemSyncData itemData = category.Items.GetElement(itemIdx);
+					if (!itemData)
+						continue;
+
+					if (!processedClasses.Contains(itemClassName))
+					{
+						processedClasses.Set(itemClassName, true);
+
+						string displayName = itemData.DisplayName;
+						if (displayName == "")
+							displayName = itemClassName;
+
+						AddEntry(new AskalSearchEntry(itemClassName, displayName, datasetID, categoryID, itemData, false));
+					}
+
+					if (!itemData.Variants)
+						continue;
+
+					foreach (string variantClass : itemData.Variants)
+					{
+						if (!variantClass || variantClass == "" || variantClassLookup.Contains(variantClass))
+							continue;
+						variantClassLookup.Set(variantClass, true);
+
+						if (processedClasses.Contains(variantClass))
+							continue;
+						processedClasses.Set(variantClass, true);
+
+						AddEntry(new AskalSearchEntry(variantClass, ResolveConfigDisplayName(variantClass), datasetID, categoryID, itemData, true));
+					}
+				}
+			}
+		}
+
+		m_IsBuilt = true;
+		Print("[AskalSearch] ✅ Índice construído: " + m_Entries.Count() + " entradas, " + m_Grams.Count() + " trigramas (" + (GetGame().GetTime() - startTime) + "ms)");
+	}
+
+	// Pesquisa por substring no nome de exibição ou classname (query já normalizada)
+	// narrowFrom: resultados de uma query contida nesta (digitação incremental) - só filtra
+	array<int> Search(string query, array<int> narrowFrom = NULL)
+	{
+		array<int> results = new array<int>();
+		if (!query || query == "")
+			return results;
+
+		array<int> candidates = narrowFrom;
+		if (!candidates)
+			candidates = FindCandidates(query);
+
+		if (!candidates)
+		{
+			// Query sem trigramas (tokens curtos): varre as entradas já normalizadas
+			for (int i = 0; i < m_Entries.Count(); i++)
+			{
+				if (Matches(m_Entries[i], query))
+					results.Insert(i);
+			}
+			return results;
+		}
+
+		foreach (int entryIndex : candidates)
+		{
+			AskalSearchEntry entry = GetEntry(entryIndex);
+			if (entry && Matches(entry, query))
+				results.Insert(entryIndex);
+		}
+		return results;
+	}
+
+	// ========================================
+	// Internos
+	// ========================================
+	protected void AddEntry(AskalSearchEntry entry)
+	{
+		int entryIndex = m_Entries.Insert(entry);
+
+		map<string, bool> entryGrams = new map<string, bool>();
+		CollectGrams(entry.DisplayLower, entryGrams);
+		CollectGrams(entry.ClassLower, entryGrams);
+
+		foreach (string gram, bool present : entryGrams)
+		{
+			array<int> postings;
+			if (!m_Grams.Find(gram, postings))
+			{
+				postings = new array<int>();
+				m_Grams.Insert(gram, postings);
+			}
+			postings.Insert(entryIndex);
+		}
+	}
+
+	// Menor lista de postings entre os trigramas da query (NULL se a query não tiver trigramas)
+	protected array<int> FindCandidates(string query)
+	{
+		map<string, bool> queryGrams = new map<string, bool>();
+		CollectGrams(query, queryGrams);
+		if (queryGrams.Count() == 0)
+			return NULL;
+
+		array<int> smallest = NULL;
+		foreach (string gram, bool present : queryGrams)
+		{
+			array<int> postings;
+			if (!m_Grams.Find(gram, postings))
+				return new array<int>();
+
+			if (!smallest || postings.Count() < smallest.Count())
+				smallest = postings;
+		}
+		return smallest;
+	}
+
+	protected static bool Matches(AskalSearchEntry entry, string query)
+	{
+		return entry.DisplayLower.Contains(query) || entry.ClassLower.Contains(query);
+	}
+
+	// Trigramas de cada token (separadores não entram nos trigramas)
+	protected static void CollectGrams(string text, map<string, bool> grams)
+	{
+		array<string> tokens = new array<string>();
+		Tokenize(text, tokens);
+
+		foreach (string token : tokens)
+		{
+			int tokenLength = token.Length();
+			for (int start = 0; start + GRAM_SIZE <= tokenLength; start++)
+			{
+				grams.Set(token.Substring(start, GRAM_SIZE), true);
+			}
+		}
+	}
+
+	protected static void Tokenize(string text, array<string> tokens)
+	{
+		string current = "";
+		int textLength = text.Length();
+		for (int i = 0; i < textLength; i++)
+		{
+			string character = text.Get(i);
+			if (TOKEN_SEPARATORS.Contains(character))
+			{
+				if (current != "")
+					tokens.Insert(current);
+				current = "";
+				continue;
+			}
+			current += character;
+		}
+
+		if (current != "")
+			tokens.Insert(current);
+	}
+
+	// Nome de exibição via config (variantes não trazem DisplayName na sincronização)
+	protected static string ResolveConfigDisplayName(string className)
+	{
+		array<string> configRoots = {"CfgVehicles", "CfgWeapons", "CfgMagazines", "CfgAmmo", "CfgNonAIVehicles"};
+		foreach (string configRoot : configRoots)
+		{
+			string resolved = "";
+			GetGame().ConfigGetText(configRoot + " " + className + " displayName", resolved);
+			if (resolved == "")
+				continue;
+
+			if (resolved.IndexOf("$STR_") == 0)
+			{
+				string translated = Widget.TranslateString(resolved);
+				if (translated != "")
+					return translated;
+			}
+			return resolved;
+		}
+		return className;
+	}
+}
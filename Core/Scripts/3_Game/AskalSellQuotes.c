@@ -0,0 +1,52 @@
+// ==========================================
+// AskalSellQuotes - Cotações de venda recebidas do servidor (cliente)
+// Preço final por network ID, calculado pela mesma fórmula da venda
+// ==========================================
+
+class AskalSellQuotes
+{
+	protected static ref map<string, int> s_Prices; // "low:high" -> preço
+	protected static string s_CurrencyId = "";
+
+	// ids: pares (low, high) intercalados; cada resposta substitui a anterior
+	static void Apply(string currencyId, array<int> ids, array<int> prices)
+	{
+		if (!s_Prices)
+			s_Prices = new map<string, int>();
+
+		s_Prices.Clear();
+		s_CurrencyId = currencyId;
+
+		if (ids && prices)
+		{
+			int entryCount = Math.Min(ids.Count() / 2, prices.Count());
+			for (int i = 0; i < entryCount; i++)
+			{
+				s_Prices.Set(AskalHealthSyncCache.MakeKey(ids[i * 2], ids[i * 2 + 1]), prices[i]);
+			}
+		}
+
+		AskalEventBus.Publish(AskalEventBus.SELL_QUOTES);
+	}
+
+	static bool Find(Object entity, out int price)
+	{
+		price = 0;
+		if (!s_Prices || !entity)
+			return false;
+
+		return s_Prices.Find(AskalHealthSyncCache.KeyOf(entity), price);
+	}
+
+	static string GetCurrencyId()
+	{
+		return s_CurrencyId;
+	}
+
+	static void Clear()
+	{
+		if (s_Prices)
+			s_Prices.Clear();
+		s_CurrencyId = "";
+	}
+}
@@ -0,0 +1,153 @@
+// ==========================================
+// AskalServerReadiness - Estado do boot escalonado do servidor (ver AskalServerBoot)
+// Os estágios concluem em ordem; RPCs que chegam antes do estágio de que dependem
+// ficam retidos (parâmetros já lidos) e são reexecutados quando ele termina
+// Sem boot iniciado (ex.: chamadas diretas aos serviços) tudo é considerado pronto
+// ==========================================
+
+class AskalHeldRequest
+{
+	int Stage;
+	Class Target;
+	string Function;
+	ref Param Params;
+	int HeldAtTicks;
+
+	void AskalHeldRequest(int stage, Class target, string function, Param params)
+	{
+		Stage = stage;
+		Target = target;
+		Function = function;
+		Params = params;
+		HeldAtTicks = TickCount(0);
+	}
+}
+
+class AskalServerReadiness
+{
+	static const int STAGE_CATALOG = 0;          // Datasets JSON -> AskalDatabase
+	static const int STAGE_INDEX = 1;            // Livro de preços da loja virtual (índice por className)
+	static const int STAGE_TRADER_REGISTRY = 2;  // Lista de arquivos de trader
+	static const int STAGE_TRADERS = 3;          // Objetos spawnados e configurados (SetupTraderStatic)
+	static const int STAGE_SYNC_WARMUP = 4;      // Cache de sync do catálogo montado
+	static const int STAGE_COUNT = 5;
+
+	static const int MAX_HELD_REQUESTS = 512;
+
+	protected static bool s_Booting = false;
+	protected static int s_CompletedStages = STAGE_COUNT;
+	protected static ref array<ref AskalHeldRequest> s_HeldRequests;
+
+	static string GetStageName(int stage)
+	{
+		switch (stage)
+		{
+			case STAGE_CATALOG:
+				return "catalog";
+			case STAGE_INDEX:
+				return "index";
+			case STAGE_TRADER_REGISTRY:
+				return "trader_registry";
+			case STAGE_TRADERS:
+				return "traders";
+			case STAGE_SYNC_WARMUP:
+				return "sync_warmup";
+		}
+		return "ready";
+	}
+
+	// Chamado pelo AskalServerBoot antes do primeiro estágio
+	static void BeginBoot()
+	{
+		s_Booting = true;
+		s_CompletedStages = 0;
+		if (!s_HeldRequests)
+			s_HeldRequests = new array<ref AskalHeldRequest>();
+	}
+
+	static bool IsBooting()
+	{
+		return s_Booting;
+	}
+
+	static bool IsStageDone(int stage)
+	{
+		return s_CompletedStages > stage;
+	}
+
+	static bool IsReady()
+	{
+		return s_CompletedStages >= STAGE_COUNT;
+	}
+
+	static int GetCompletedStages()
+	{
+		return s_CompletedStages;
+	}
+
+	static int GetHeldCount()
+	{
+		if (!s_HeldRequests)
+			return 0;
+		return s_HeldRequests.Count();
+	}
+
+	// Retém a chamada target.function(params...) até o estágio concluir
+	// false = fila cheia (o chamador responde "servidor iniciando")
+	static bool Hold(int stage, Class target, string function, Param params)
+	{
+		if (!s_HeldRequests)
+			s_HeldRequests = new array<ref AskalHeldRequest>();
+
+		if (s_HeldRequests.Count() >= MAX_HELD_REQUESTS)
+		{
+			AskalLog.Warn("Boot", "⚠️ Fila de requisições retidas cheia, descartando " + function);
+			return false;
+		}
+
+		s_HeldRequests.Insert(new AskalHeldRequest(stage, target, function, params));
+		AskalMetrics.Increment("boot.held_requests");
+		if (AskalLog.IsEnabled("Boot", AskalLog.DEBUG))
+			AskalLog.Debug("Boot", "⏸️ " + function + " retido até o estágio " + GetStageName(stage));
+		return true;
+	}
+
+	static void MarkStageDone(int stage)
+	{
+		if (stage < s_CompletedStages)
+			return;
+
+		s_CompletedStages = stage + 1;
+		if (IsReady())
+			s_Booting = false;
+
+		ReleaseHeld();
+	}
+
+	// Reexecuta (no próximo frame) tudo que estava esperando por estágios já concluídos
+	protected static void ReleaseHeld()
+	{
+		if (!s_HeldRequests || s_HeldRequests.Count() == 0)
+			return;
+
+		int released = 0;
+		for (int i = 0; i < s_HeldRequests.Count(); i++)
+		{
+			AskalHeldRequest held = s_HeldRequests.Get(i);
+			if (!IsStageDone(held.Stage))
+				continue;
+
+			if (held.Target)
+			{
+				AskalMetrics.ObserveTicks("boot.held_wait_ms", held.HeldAtTicks);
+				GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallByName(held.Target, held.Function, held.Params);
+				released++;
+			}
+			s_HeldRequests.RemoveOrdered(i);
+			i--;
+		}
+
+		if (released > 0)
+			AskalLog.Info("Boot", "▶️ " + released + " requisições retidas liberadas (" + GetStageName(s_CompletedStages - 1) + ")");
+	}
+}
@@ -0,0 +1,125 @@
+// ==========================================
+// AskalSyncRecorder - Perfil de banda da sincronização do catálogo (servidor)
+// Ativado por -askalSyncRecord=1: cada RPC de sync enviado (tipo, bytes, itens do
+// batch, tempo, player) é registrado junto com o payload, e cada sessão vira um
+// arquivo de replay em $profile:Askal/Benchmark/Sync/ (ver AskalSyncReplayer)
+// ==========================================
+
+class AskalSyncRecord
+{
+	string Type;               // Nome do RPC (SendDatasetHeader, SendCategoryBatch, SendDatasetsComplete)
+	float TimeMs;              // Desde o início da sessão
+	int Bytes;                 // Estimativa do payload (mesma do AskalMetrics.RecordRpc)
+	int Items;                 // Itens no batch (0 para header/conclusão)
+	ref array<string> Args;    // Parâmetros do RPC, na ordem do Param
+}
+
+class AskalSyncRecording
+{
+	string Timestamp;
+	string Player;
+	string PlayerId;
+	float DurationMs;
+	int Rpcs;
+	int Batches;
+	int Items;
+	int TotalBytes;
+	ref array<ref AskalSyncRecord> Records;
+
+	void AskalSyncRecording()
+	{
+		Records = new array<ref AskalSyncRecord>();
+	}
+}
+
+class AskalSyncRecorder
+{
+	static const string CLI_PARAM = "askalSyncRecord";
+	static const string RECORDINGS_DIRECTORY = "$profile:Askal/Benchmark/Sync/";
+	static const string LATEST_FILE = "$profile:Askal/Benchmark/Sync/sync_latest.json";
+
+	protected static bool s_EnabledChecked = false;
+	protected static bool s_Enabled = false;
+	protected static ref AskalSyncRecording s_Session;
+	protected static int s_SessionStartTicks;
+
+	static bool IsEnabled()
+	{
+		if (!s_EnabledChecked)
+		{
+			string recordParam;
+			s_Enabled = GetCLIParam(CLI_PARAM, recordParam) && recordParam != "0";
+			s_EnabledChecked = true;
+			if (s_Enabled)
+				Print("[AskalSyncRecorder] 🎙️ Gravação de sync ativa em " + RECORDINGS_DIRECTORY);
+		}
+		return s_Enabled;
+	}
+
+	static void SetEnabled(bool enabled)
+	{
+		s_Enabled = enabled;
+		s_EnabledChecked = true;
+	}
+
+	static bool IsRecording()
+	{
+		return s_Session != NULL;
+	}
+
+	static void BeginSession(PlayerIdentity identity)
+	{
+		if (!identity || !IsEnabled())
+			return;
+
+		s_Session = new AskalSyncRecording();
+		s_Session.Timestamp = AskalLog.FormatTimestamp("-", "T", ":");
+		s_Session.Player = identity.GetName();
+		s_Session.PlayerId = identity.GetPlainId();
+		s_SessionStartTicks = TickCount(0);
+	}
+
+	static void Record(string type, int bytes, int items, array<string> args)
+	{
+		if (!s_Session)
+			return;
+
+		AskalSyncRecord record = new AskalSyncRecord();
+		record.Type = type;
+		record.TimeMs = TickCount(s_SessionStartTicks) / 10000.0;
+		record.Bytes = bytes;
+		record.Items = items;
+		record.Args = args;
+		s_Session.Records.Insert(record);
+
+		s_Session.Rpcs++;
+		s_Session.TotalBytes += bytes;
+		s_Session.Items += items;
+		if (type == "SendCategoryBatch")
+			s_Session.Batches++;
+
+		if (AskalLog.IsEnabled("SyncRecorder", AskalLog.DEBUG))
+			AskalLog.Debug("SyncRecorder", record.TimeMs.ToString() + "ms " + type + " " + bytes + " bytes, " + items + " itens -> " + s_Session.Player);
+	}
+
+	// Fecha a sessão e grava o arquivo de replay
+	static void EndSession()
+	{
+		if (!s_Session)
+			return;
+
+		AskalSyncRecording session = s_Session;
+		s_Session = NULL;
+		session.DurationMs = TickCount(s_SessionStartTicks) / 10000.0;
+
+		MakeDirectory("$profile:Askal");
+		MakeDirectory("$profile:Askal/Benchmark");
+		MakeDirectory(RECORDINGS_DIRECTORY);
+
+		string recordingPath = RECORDINGS_DIRECTORY + "sync_" + AskalLog.FormatTimestamp("", "_", "") + "_" + session.PlayerId + ".json";
+		if (AskalJsonLoader<AskalSyncRecording>.SaveToFile(recordingPath, session))
+			AskalJsonLoader<AskalSyncRecording>.SaveToFile(LATEST_FILE, session);
+
+		AskalLog.Info("SyncRecorder", "📝 Sync de " + session.Player + ": " + session.Rpcs + " RPCs, " + session.Batches + " batches, " + session.Items + " itens, " + session.TotalBytes + " bytes em " + session.DurationMs + "ms -> " + recordingPath);
+	}
+}
@@ -0,0 +1,134 @@
+// ==========================================
+// AskalSyncReplayer - Reproduz uma gravação do AskalSyncRecorder no cliente, offline
+// Ativado por -askalSyncReplay=<arquivo> ("latest" = sync_latest.json)
+// Alimenta RPC_ReceiveDatasetHeader/CategoryBatch/DatasetsComplete com os payloads
+// gravados e mede deserialização, montagem dos batches e do cache (+ índice de busca)
+// Relatório em $profile:Askal/Benchmark/Reports/sync_replay_*.json
+// ==========================================
+
+class AskalSyncReplayReport
+{
+	string Timestamp;
+	string Recording;
+	string RecordedPlayer;
+	int Headers;
+	int Batches;
+	int Items;
+	int PayloadBytes;
+	float DeserializeMs;       // Só AskalJsonLoader.StringToObject dos batches
+	float HeaderMs;            // RPC_ReceiveDatasetHeader
+	float BatchMs;             // RPC_ReceiveCategoryBatch (deserialização + displayName + montagem)
+	float CacheBuildMs;        // RPC_ReceiveDatasetsComplete (cache + índice de busca)
+	float TotalMs;
+	float BatchAvgMs;
+	float BatchMaxMs;
+}
+
+class AskalSyncReplayer
+{
+	static const string CLI_PARAM = "askalSyncReplay";
+	protected static const string REPORTS_DIRECTORY = "$profile:Askal/Benchmark/Reports/";
+
+	static bool RunFromCommandLine()
+	{
+		string replayParam;
+		if (!GetCLIParam(CLI_PARAM, replayParam) || replayParam == "")
+			return false;
+
+		string recordingPath = replayParam;
+		if (replayParam == "latest")
+			recordingPath = AskalSyncRecorder.LATEST_FILE;
+
+		return Replay(recordingPath) != NULL;
+	}
+
+	// Substitui o catálogo do cliente pelo da gravação
+	static AskalSyncReplayReport Replay(string recordingPath)
+	{
+		AskalSyncRecording recording = new AskalSyncRecording();
+		if (!FileExist(recordingPath) || !AskalJsonLoader<AskalSyncRecording>.LoadFromFile(recordingPath, recording, false))
+		{
+			Print("[AskalSyncReplay] ❌ Gravação não encontrada ou inválida: " + recordingPath);
+			return NULL;
+		}
+
+		AskalSyncReplayReport report = new AskalSyncReplayReport();
+		report.Timestamp = AskalLog.FormatTimestamp("-", "T", ":");
+		report.Recording = recordingPath;
+		report.RecordedPlayer = recording.Player;
+
+		Print("[AskalSyncReplay] ▶️ Reproduzindo " + recording.Records.Count() + " RPCs de " + recordingPath);
+
+		// Passo 1: deserialização isolada (sem efeitos colaterais)
+		foreach (AskalSyncRecord parseRecord : recording.Records)
+		{
+			if (parseRecord.Type != "SendCategoryBatch" || !parseRecord.Args || parseRecord.Args.Count() < 1)
+				continue;
+
+			AskalCategoryBatchData batchData = new AskalCategoryBatchData();
+			int parseStart = TickCount(0);
+			AskalJsonLoader<AskalCategoryBatchData>.StringToObject(parseRecord.Args[0], batchData);
+			report.DeserializeMs += TickCount(parseStart) / 10000.0;
+		}
+
+		// Passo 2: caminho completo de recepção do cliente
+		AskalDatabaseSync.ResetSyncState();
+		AskalDatabaseClientCache.GetInstance().Clear();
+		AskalDatabaseSync.SetReplayMode(true);
+
+		int totalStart = TickCount(0);
+		foreach (AskalSyncRecord record : recording.Records)
+		{
+			if (!record.Args)
+				continue;
+
+			report.PayloadBytes += record.Bytes;
+			int stepStart = TickCount(0);
+			if (record.Type == "SendDatasetHeader" && record.Args.Count() >= 4)
+			{
+				AskalDatabaseSync.RPC_ReceiveDatasetHeader(record.Args[0], record.Args[1], record.Args[2].ToInt(), record.Args[3]);
+				report.HeaderMs += TickCount(stepStart) / 10000.0;
+				report.Headers++;
+			}
+			else if (record.Type == "SendCategoryBatch" && record.Args.Count() >= 1)
+			{
+				AskalDatabaseSync.RPC_ReceiveCategoryBatch(record.Args[0]);
+				float batchMs = TickCount(stepStart) / 10000.0;
+				report.BatchMs += batchMs;
+				if (batchMs > report.BatchMaxMs)
+					report.BatchMaxMs = batchMs;
+				report.Batches++;
+				report.Items += record.Items;
+			}
+			else if (record.Type == "SendDatasetsComplete" && record.Args.Count() >= 2)
+			{
+				AskalDatabaseSync.RPC_ReceiveDatasetsComplete(record.Args[0].ToInt(), record.Args[1]);
+				report.CacheBuildMs += TickCount(stepStart) / 10000.0;
+			}
+		}
+		report.TotalMs = TickCount(totalStart) / 10000.0;
+
+		AskalDatabaseSync.SetReplayMode(false);
+
+		if (report.Batches > 0)
+			report.BatchAvgMs = report.BatchMs / report.Batches;
+
+		Print("[AskalSyncReplay] ✅ " + report.Batches + " batches, " + report.Items + " itens, " + report.PayloadBytes + " bytes | deserializar=" + report.DeserializeMs + "ms | batches=" + report.BatchMs + "ms | cache=" + report.CacheBuildMs + "ms | total=" + report.TotalMs + "ms");
+		WriteReport(report);
+		return report;
+	}
+
+	protected static void WriteReport(AskalSyncReplayReport report)
+	{
+		MakeDirectory("$profile:Askal");
+		MakeDirectory("$profile:Askal/Benchmark");
+		MakeDirectory(REPORTS_DIRECTORY);
+
+		string reportPath = REPORTS_DIRECTORY + "sync_replay_" + AskalLog.FormatTimestamp("", "_", "") + ".json";
+		if (AskalJsonLoader<AskalSyncReplayReport>.SaveToFile(reportPath, report))
+		{
+			AskalJsonLoader<AskalSyncReplayReport>.SaveToFile(REPORTS_DIRECTORY + "sync_replay_latest.json", report);
+			Print("[AskalSyncReplay] 📝 Relatório: " + reportPath);
+		}
+	}
+}
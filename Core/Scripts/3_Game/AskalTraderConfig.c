@@ -93,6 +93,16 @@ class AskalTraderConfig
 	
 	// Carregar config pelo TraderName (busca em todos os arquivos)
 	static AskalTraderConfig LoadByTraderName(string traderName)
+	{
+		int startTicks = TickCount(0);
+		AskalTraderConfig config = LoadByTraderNameInternal(traderName);
+		AskalMetrics.ObserveTicks("trader.config_load_ms", startTicks);
+		if (!config)
+			AskalMetrics.Increment("trader.config_load_failure");
+		return config;
+	}
+	
+	protected static AskalTraderConfig LoadByTraderNameInternal(string traderName)
 	{
 		if (!traderName || traderName == "")
 		{
@@ -291,21 +301,9 @@ class AskalTraderConfig
 	// Obter caminho da pasta de traders
 	static string GetTradersPath()
 	{
-		// Priorizar $mission: sobre $profile: (traders geralmente ficam na missão)
-		array<string> candidatePaths = {
-			"$mission:Askal/Traders/",
-			"$mission:Askal\\Traders\\",
-			"$profile:config/Askal/Traders/",
-			"$profile:config\\Askal\\Traders\\",
-			"$profile:Askal/Traders/",
-			"$profile:Askal\\Traders\\"
-		};
-		
-		foreach (string path : candidatePaths)
-		{
-			if (FileExist(path))
-				return path;
-		}
+		string path = AskalConfigLocator.Resolve(AskalConfigLocator.TRADERS_DIRECTORY);
+		if (path != "")
+			return path;
 		
 		// Retornar padrão da missão se nenhum existir
 		return "$mission:Askal/Traders/";
@@ -56,10 +56,15 @@ class AskalCoreModule : CF_ModuleGame
 	AddLegacyRPC("PurchaseItemResponse", SingleplayerExecutionType.Client);
 	AddLegacyRPC("SellItemResponse", SingleplayerExecutionType.Client);
 	
-	// RPC para health dos itens do inventário
-		AddLegacyRPC("RequestInventoryHealth", SingleplayerExecutionType.Server);
-		AddLegacyRPC("InventoryHealthResponse", SingleplayerExecutionType.Client);
+	// RPC para health/quantidade dos itens do inventário (assinatura + deltas)
+		AddLegacyRPC("SubscribeInventoryHealth", SingleplayerExecutionType.Server);
+		AddLegacyRPC("InventoryHealthDelta", SingleplayerExecutionType.Client);
+		AddLegacyRPC("InventoryQuoteResponse", SingleplayerExecutionType.Client);
 		AddLegacyRPC("OpenTraderMenu", SingleplayerExecutionType.Client);
+		
+		// Console de performance (admin; handler do servidor em 4_World)
+		AddLegacyRPC("RequestPerfStats", SingleplayerExecutionType.Server);
+		AddLegacyRPC("PerfStatsResponse", SingleplayerExecutionType.Client);
 	
 	Print("[AskalCore] ✅ RPCs registrados");
 	Print("[AskalCore] ========================================");
@@ -80,6 +85,23 @@ class AskalCoreModule : CF_ModuleGame
 			return;
 		}
 		
+		// Boot escalonado: segurar até o cache de sync estar montado
+		if (!AskalServerReadiness.IsStageDone(AskalServerReadiness.STAGE_SYNC_WARMUP))
+		{
+			Print("[AskalCore] ⏸️ Servidor iniciando - sync de " + sender.GetName() + " retido");
+			AskalServerReadiness.Hold(AskalServerReadiness.STAGE_SYNC_WARMUP, this, "SendDatasetsTo", new Param1<PlayerIdentity>(sender));
+			return;
+		}
+		
+		SendDatasetsTo(sender);
+	}
+	
+	// Envia o catálogo completo (direto ou liberado pelo AskalServerReadiness)
+	void SendDatasetsTo(PlayerIdentity sender)
+	{
+		if (!sender)
+			return;
+		
 		Print("[AskalCore] ========================================");
 		Print("[AskalCore] 📥 Cliente solicitou sync: " + sender.GetName());
 		
@@ -136,6 +158,7 @@ class AskalCoreModule : CF_ModuleGame
 		
 		Param5<string, float, float, ref array<string>, ref array<int>> data = new Param5<string, float, float, ref array<string>, ref array<int>>(currencyId, buyCoeff, sellCoeff, setupKeys, setupValues);
 		GetRPCManager().SendRPC("AskalCoreModule", "VirtualStoreConfigResponse", data, true, sender, NULL);
+		AskalMetrics.RecordRpc("VirtualStoreConfigResponse", AskalMetrics.StringBytes(currencyId) + AskalMetrics.NUMBER_BYTES * (3 + setupValues.Count()) + AskalMetrics.StringArrayBytes(setupKeys));
 	}
 	
 	// RPC Handler: Cliente recebe header de dataset
@@ -274,6 +297,7 @@ class AskalCoreModule : CF_ModuleGame
 		Param5<string, ref array<string>, ref array<int>, ref array<string>, ref array<int>> data = new Param5<string, ref array<string>, ref array<int>, ref array<string>, ref array<int>>(
 			defaultCurrencyId, currencyIds, currencyModes, currencyShortNames, currencyStartCurrencies);
 		GetRPCManager().SendRPC("AskalCoreModule", "MarketConfigResponse", data, true, sender, NULL);
+		AskalMetrics.RecordRpc("MarketConfigResponse", AskalMetrics.StringBytes(defaultCurrencyId) + AskalMetrics.StringArrayBytes(currencyIds) + AskalMetrics.StringArrayBytes(currencyShortNames) + AskalMetrics.NUMBER_BYTES * (2 + currencyModes.Count() + currencyStartCurrencies.Count()));
 		Print("[AskalCore] ✅ MarketConfig enviado ao cliente: " + currencyIds.Count() + " currencies");
 	}
 	
@@ -326,6 +350,9 @@ class AskalCoreModule : CF_ModuleGame
 		else
 		{
 			Print("[AskalCore] Cliente: dados serão recebidos via RPC");
+			
+			// Benchmark offline da recepção (apenas com -askalSyncReplay=<arquivo>)
+			AskalSyncReplayer.RunFromCommandLine();
 		}
 		
 		Print("[AskalCore] ========================================");
@@ -339,6 +366,7 @@ class AskalCoreModule : CF_ModuleGame
 		
 		Param2<bool, string> params = new Param2<bool, string>(success, message);
 		GetRPCManager().SendRPC("AskalCoreModule", "PurchaseItemResponse", params, true, identity, NULL);
+		AskalMetrics.RecordRpc("PurchaseItemResponse", AskalMetrics.NUMBER_BYTES + AskalMetrics.StringBytes(message));
 	}
 	
 	// RPC Handler: Cliente recebe resposta de compra
@@ -372,6 +400,8 @@ class AskalCoreModule : CF_ModuleGame
 		{
 			Print("[AskalStore] ❌ " + message);
 		}
+		
+		AskalEventBus.Publish(AskalEventBus.TRADE_RESPONSE, new Param3<bool, string, bool>(success, message, true));
 	}
 	
 	// RPC Handler: Cliente recebe resposta de venda
@@ -424,32 +454,56 @@ class AskalCoreModule : CF_ModuleGame
 		{
 			Print("[AskalStore] [ERRO] " + message);
 		}
+		
+		AskalEventBus.Publish(AskalEventBus.TRADE_RESPONSE, new Param3<bool, string, bool>(success, message, false));
 	}
 	
-	// RPC Handler: Cliente recebe health dos itens do inventário
-	void InventoryHealthResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
+	// RPC Handler: Cliente recebe snapshot/delta de health por network ID
+	void InventoryHealthDelta(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
 	{
 		if (type != CallType.Client)
 			return;
 		
-		Param1<ref array<ref Param2<string, float>>> data;
+		Param5<bool, ref array<int>, ref array<float>, ref array<float>, ref array<int>> data;
 		if (!ctx.Read(data))
 		{
-			Print("[AskalCore] ❌ Erro ao ler InventoryHealthResponse");
+			Print("[AskalCore] ❌ Erro ao ler InventoryHealthDelta");
 			return;
 		}
 		
-		ref array<ref Param2<string, float>> healthArray = data.param1;
-		if (!healthArray)
+		AskalHealthSyncCache.Apply(data.param1, data.param2, data.param3, data.param4, data.param5);
+	}
+	
+	// RPC Handler: Cliente recebe cotações de venda do inventário
+	void InventoryQuoteResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
+	{
+		if (type != CallType.Client)
+			return;
+		
+		Param3<string, ref array<int>, ref array<int>> data;
+		if (!ctx.Read(data))
 		{
-			Print("[AskalCore] ⚠️ InventoryHealthResponse recebido sem dados");
+			Print("[AskalCore] ❌ Erro ao ler InventoryQuoteResponse");
 			return;
 		}
 		
-		Print("[AskalCore] 📥 InventoryHealthResponse recebido com " + healthArray.Count() + " itens");
+		AskalSellQuotes.Apply(data.param1, data.param2, data.param3);
+	}
+	
+	// RPC Handler: Cliente recebe estatísticas do console de performance
+	void PerfStatsResponse(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
+	{
+		if (type != CallType.Client)
+			return;
+		
+		Param2<bool, ref array<string>> data;
+		if (!ctx.Read(data))
+		{
+			Print("[AskalCore] ❌ Erro ao ler PerfStatsResponse");
+			return;
+		}
 		
-		// Armazenar health no helper (3_Game pode acessar)
-		AskalNotificationHelper.SetInventoryHealth(healthArray);
+		AskalPerfStats.Apply(data.param1, data.param2);
 	}
 	
 	// RPC Handler: Cliente recebe comando para abrir menu do trader
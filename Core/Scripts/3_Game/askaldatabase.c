@@ -318,6 +318,9 @@ class AskalDatabase
     
     // Armazena datasets por ID (ex: "DS_Firearms")
     static ref map<string, ref Dataset> m_Datasets = new map<string, ref Dataset>();
+    
+    // Incrementado a cada alteração do catálogo (caches derivados comparam para invalidar)
+    static int m_Revision = 0;
 
     // getters / setters simples (sem I/O)
     static void SetDatabasePath(string p)
@@ -339,6 +342,21 @@ class AskalDatabase
     {
         if (!dataset || !dataset.DatasetID || dataset.DatasetID == "") return;
         m_Datasets.Set(dataset.DatasetID, dataset);
+        m_Revision++;
+    }
+    
+    static int GetRevision()
+    {
+        return m_Revision;
+    }
+    
+    // Troca o catálogo inteiro de uma vez (hot reload). Quem ainda segura
+    // Dataset/ItemData do snapshot anterior continua usando-o até soltar a referência
+    static void SwapDatasets(map<string, ref Dataset> datasets)
+    {
+        if (!datasets) return;
+        m_Datasets = datasets;
+        m_Revision++;
     }
 
     // ========================================
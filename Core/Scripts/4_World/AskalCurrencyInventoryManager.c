@@ -32,12 +32,12 @@ class AskalCurrencyInventoryManager
 			
 			string itemClass = inventoryItem.GetType();
 			
-			// Verifica se é uma moeda desta currency
+			// Verifica se é uma moeda desta currency (cada stack vale Value * quantidade)
 			foreach (AskalCurrencyValueConfig valueConfig : currencyConfig.Values)
 			{
 				if (valueConfig.Name == itemClass)
 				{
-					totalAmount += valueConfig.Value;
+					totalAmount += valueConfig.Value * GetCoinQuantity(inventoryItem);
 					break;
 				}
 			}
@@ -78,6 +78,7 @@ class AskalCurrencyInventoryManager
 		SortCurrencyValues(sortedValues, false); // Menor primeiro
 		
 		// Remove moedas (greedy: menor denominação primeiro para minimizar troco)
+		// Stacks são consumidos parcialmente: só deleta a entidade quando o stack inteiro é usado
 		int remainingToRemove = amountToRemove;
 		array<EntityAI> itemsToDelete = new array<EntityAI>();
 		
@@ -86,6 +87,9 @@ class AskalCurrencyInventoryManager
 			if (remainingToRemove <= 0)
 				break;
 			
+			if (valueConfig.Value <= 0)
+				continue;
+			
 			// Encontra todas as moedas desta denominação
 			array<EntityAI> coinsOfThisDenom = FindCoinsInInventory(player, valueConfig.Name);
 			
@@ -94,12 +98,26 @@ class AskalCurrencyInventoryManager
 				if (remainingToRemove <= 0)
 					break;
 				
-				itemsToDelete.Insert(coin);
-				remainingToRemove -= valueConfig.Value;
+				int stackQuantity = GetCoinQuantity(coin);
+				if (stackQuantity <= 0)
+					continue;
+				
+				// Moedas necessárias desta denominação (arredonda para cima; excedente vira troco)
+				int coinsNeeded = (remainingToRemove + valueConfig.Value - 1) / valueConfig.Value;
+				int coinsTaken = stackQuantity;
+				if (coinsTaken > coinsNeeded)
+					coinsTaken = coinsNeeded;
+				
+				if (coinsTaken >= stackQuantity)
+					itemsToDelete.Insert(coin);
+				else
+					SetCoinQuantity(coin, stackQuantity - coinsTaken);
+				
+				remainingToRemove -= coinsTaken * valueConfig.Value;
 			}
 		}
 		
-		// Deleta as moedas
+		// Deleta os stacks consumidos por inteiro
 		foreach (EntityAI itemToDelete : itemsToDelete)
 		{
 			GetGame().ObjectDelete(itemToDelete);
@@ -131,50 +149,174 @@ class AskalCurrencyInventoryManager
 		if (!currencyConfig || !currencyConfig.Values)
 			return false;
 		
-		// Calcula troco otimizado (maior denominação primeiro)
-		array<ref Param2<string, int>> change = CalculateChange(amountToAdd, currencyConfig.Values);
+		// Calcula troco com mínimo de moedas (tabela DP da currency; greedy como fallback)
+		array<ref Param2<string, int>> change;
+		int changeShortfall = 0;
+		AskalChangeTable changeTable = marketConfig.GetChangeTable(currencyId);
+		if (changeTable)
+			change = changeTable.CalculateChange(amountToAdd, changeShortfall);
+		else
+			change = CalculateChange(amountToAdd, currencyConfig.Values, changeShortfall);
+		
+		// Valor sem combinação de moedas não some: vai para o balance virtual da mesma currency
+		if (changeShortfall > 0)
+			CreditChangeShortfall(player, changeShortfall, currencyId);
 		
-		// Tenta adicionar ao inventário
-		int coinsSpawned = 0;
-		array<EntityAI> droppedCoins = new array<EntityAI>();
+		// Preenche stacks existentes primeiro, depois cria novos stacks até o máximo de quantidade
+		int stacksSpawned = 0;
+		int stacksDropped = 0;
 		
+		// Merge primeiro: só os stacks novos precisam de espaço
+		array<ref Param2<string, int>> pendingStacks = new array<ref Param2<string, int>>();
 		foreach (Param2<string, int> coinEntry : change)
 		{
-			string coinClass = coinEntry.param1;
-			int coinCount = coinEntry.param2;
+			int remainingCoins = MergeIntoExistingStacks(player, coinEntry.param1, coinEntry.param2);
+			if (remainingCoins > 0)
+				pendingStacks.Insert(new Param2<string, int>(coinEntry.param1, remainingCoins));
+		}
+		
+		// Planejamento de espaço: stacks que não cabem vão direto para o chão, sem tentativa de criação no inventário
+		AskalInventoryFitPlanner fitPlanner = NULL;
+		if (pendingStacks.Count() > 0)
+			fitPlanner = new AskalInventoryFitPlanner(player);
+		
+		foreach (Param2<string, int> pendingEntry : pendingStacks)
+		{
+			string coinClass = pendingEntry.param1;
+			int coinCount = pendingEntry.param2;
 			
-			for (int i = 0; i < coinCount; i++)
+			int stackMax = GetCoinStackMax(coinClass);
+			while (coinCount > 0)
 			{
-				EntityAI coin = player.GetInventory().CreateInInventory(coinClass);
-				if (!coin)
-				{
-				// Não há espaço: dropa no chão (Q6 - OPÇÃO C)
-				vector playerPos = player.GetPosition();
-				Object createdObj = GetGame().CreateObjectEx(coinClass, playerPos, ECE_PLACE_ON_SURFACE);
-				coin = EntityAI.Cast(createdObj);
+				int stackAmount = coinCount;
+				if (stackAmount > stackMax)
+					stackAmount = stackMax;
+				
+				EntityAI coin = NULL;
+				if (fitPlanner.Reserve(coinClass))
+					coin = player.GetInventory().CreateInInventory(coinClass);
+				
 				if (coin)
-					{
-						droppedCoins.Insert(coin);
-					}
+				{
+					stacksSpawned++;
 				}
 				else
 				{
-					coinsSpawned++;
+					// Não há espaço: dropa o stack no chão (Q6 - OPÇÃO C)
+					vector playerPos = player.GetPosition();
+					Object createdObj = GetGame().CreateObjectEx(coinClass, playerPos, ECE_PLACE_ON_SURFACE);
+					coin = EntityAI.Cast(createdObj);
+					if (coin)
+						stacksDropped++;
+				}
+				
+				if (!coin)
+				{
+					Print("[AskalCurrency] ❌ Falha ao criar moeda: " + coinClass);
+					break;
 				}
+				
+				SetCoinQuantity(coin, stackAmount);
+				coinCount -= stackAmount;
 			}
 		}
 		
-		if (droppedCoins.Count() > 0)
+		if (stacksDropped > 0)
 		{
-			Print("[AskalCurrency] ⚠️ " + droppedCoins.Count() + " moedas dropadas no chão (inventário cheio)");
+			Print("[AskalCurrency] ⚠️ " + stacksDropped + " stacks de moedas dropados no chão (inventário cheio)");
 		}
 		
-		Print("[AskalCurrency] ✅ Adicionado " + amountToAdd + " " + currencyId + " (" + coinsSpawned + " moedas spawnadas)");
+		Print("[AskalCurrency] ✅ Adicionado " + amountToAdd + " " + currencyId + " (" + stacksSpawned + " stacks criados)");
 		return true;
 	}
 	
+	// Completa stacks já existentes no inventário até o máximo permitido
+	// Retorna quantas moedas ainda faltam adicionar
+	static int MergeIntoExistingStacks(PlayerBase player, string coinClass, int coinCount)
+	{
+		if (!player || coinCount <= 0)
+			return coinCount;
+		
+		int stackMax = GetCoinStackMax(coinClass);
+		if (stackMax <= 1)
+			return coinCount;
+		
+		array<EntityAI> existingCoins = FindCoinsInInventory(player, coinClass);
+		foreach (EntityAI existingCoin : existingCoins)
+		{
+			if (coinCount <= 0)
+				break;
+			
+			int currentQuantity = GetCoinQuantity(existingCoin);
+			int freeSpace = stackMax - currentQuantity;
+			if (freeSpace <= 0)
+				continue;
+			
+			int toMerge = coinCount;
+			if (toMerge > freeSpace)
+				toMerge = freeSpace;
+			
+			SetCoinQuantity(existingCoin, currentQuantity + toMerge);
+			coinCount -= toMerge;
+		}
+		
+		return coinCount;
+	}
+	
+	// Quantidade de moedas representada por uma entidade (stack)
+	static int GetCoinQuantity(EntityAI coin)
+	{
+		ItemBase coinItem = ItemBase.Cast(coin);
+		if (!coinItem || !coinItem.HasQuantity())
+			return 1;
+		
+		return Math.Round(coinItem.GetQuantity());
+	}
+	
+	// Define a quantidade de um stack de moedas (ignora itens sem quantidade)
+	static void SetCoinQuantity(EntityAI coin, int quantity)
+	{
+		ItemBase coinItem = ItemBase.Cast(coin);
+		if (!coinItem || !coinItem.HasQuantity())
+			return;
+		
+		coinItem.SetQuantity(quantity);
+	}
+	
+	// Máximo de moedas por stack (varQuantityMax do config; 1 se não empilhável)
+	static int GetCoinStackMax(string coinClass)
+	{
+		if (!coinClass || coinClass == "")
+			return 1;
+		
+		int stackMax = GetGame().ConfigGetInt("CfgVehicles " + coinClass + " varQuantityMax");
+		if (stackMax <= 0)
+			return 1;
+		
+		return stackMax;
+	}
+	
+	// Credita no balance virtual o valor que as denominações não conseguem representar
+	static void CreditChangeShortfall(PlayerBase player, int shortfall, string currencyId)
+	{
+		string steamId = "";
+		PlayerIdentity identity = player.GetIdentity();
+		if (identity)
+			steamId = identity.GetPlainId();
+		
+		string balanceKey = AskalPlayerBalance.ResolveBalanceKey(currencyId);
+		if (steamId != "" && balanceKey != "" && AskalPlayerBalance.AddBalance(steamId, shortfall, balanceKey))
+		{
+			Print("[AskalCurrency] ⚠️ " + shortfall + " " + currencyId + " sem combinação de moedas, creditado no balance de " + steamId);
+			return;
+		}
+		
+		Print("[AskalCurrency] ❌ " + shortfall + " " + currencyId + " sem combinação de moedas e sem balance para creditar");
+	}
+	
 	// Calcula troco (algoritmo greedy - maior denominação primeiro)
-	static array<ref Param2<string, int>> CalculateChange(int amount, array<ref AskalCurrencyValueConfig> denominations)
+	// shortfall recebe o que sobrou sem denominação que o represente
+	static array<ref Param2<string, int>> CalculateChange(int amount, array<ref AskalCurrencyValueConfig> denominations, out int shortfall)
 	{
 		array<ref Param2<string, int>> result = new array<ref Param2<string, int>>();
 		
@@ -201,6 +343,9 @@ class AskalCurrencyInventoryManager
 			}
 		}
 		
+		shortfall = 0;
+		if (remaining > 0)
+			shortfall = remaining;
 		return result;
 	}
 	
@@ -0,0 +1,262 @@
+// ==========================================
+// AskalHealthSyncModule - Assinatura de health/quantidade do inventário (servidor)
+// Enquanto a loja do cliente está aberta: snapshot por network ID dos itens
+// negociáveis e, depois, só o que mudou (ou saiu do inventário)
+// Os hooks de inventário (AskalInventoryHooks) marcam o assinante como sujo; o Tick só
+// enumera inventários sujos, mais uma ressincronização lenta para desgaste abaixo de
+// um nível de health (que não gera evento)
+// ==========================================
+
+class AskalSentCondition
+{
+	EntityAI Entity;
+	int LowBits;
+	int HighBits;
+	float HealthPercent;
+	float QuantityPercent;
+	bool Seen;
+
+	void AskalSentCondition(EntityAI entity, int lowBits, int highBits)
+	{
+		Entity = entity;
+		LowBits = lowBits;
+		HighBits = highBits;
+		HealthPercent = -1;
+		QuantityPercent = -2;
+		Seen = true;
+	}
+}
+
+class AskalHealthSubscription
+{
+	PlayerIdentity Identity;
+	ref map<string, ref AskalSentCondition> Sent; // "low:high" -> último valor enviado
+	bool Dirty;                                   // Inventário mudou desde o último envio
+	int LastPushMs;
+
+	void AskalHealthSubscription(PlayerIdentity identity)
+	{
+		Identity = identity;
+		Sent = new map<string, ref AskalSentCondition>();
+		Dirty = false;
+		LastPushMs = 0;
+	}
+}
+
+class AskalHealthSyncModule
+{
+	protected static const int PUSH_INTERVAL_MS = 1000;
+	protected static const int RESYNC_INTERVAL_MS = 15000;  // Envio completo mesmo sem eventos
+	protected static const float HEALTH_EPSILON = 0.5;     // % de health que justifica reenviar
+	protected static const float QUANTITY_EPSILON = 0.1;   // % de quantidade que justifica reenviar
+
+	protected static ref AskalHealthSyncModule s_Instance;
+	protected static bool s_HasSubscribers = false;         // Checagem barata para os hooks de inventário
+	protected ref map<string, ref AskalHealthSubscription> m_Subscriptions; // identityId -> assinatura
+	protected bool m_Ticking;
+
+	void AskalHealthSyncModule()
+	{
+		m_Subscriptions = new map<string, ref AskalHealthSubscription>();
+		m_Ticking = false;
+
+		if (GetGame().IsServer())
+			GetRPCManager().AddRPC("AskalCoreModule", "SubscribeInventoryHealth", this, SingleplayerExecutionType.Server);
+	}
+
+	static AskalHealthSyncModule GetInstance()
+	{
+		if (!s_Instance)
+			s_Instance = new AskalHealthSyncModule();
+		return s_Instance;
+	}
+
+	int GetSubscriptionCount()
+	{
+		return m_Subscriptions.Count();
+	}
+
+	// Chamado pelos hooks de inventário (servidor): marca o dono do item como sujo
+	static void NotifyItemChanged(EntityAI item)
+	{
+		if (!s_HasSubscribers || !s_Instance || !item)
+			return;
+
+		PlayerBase owner = PlayerBase.Cast(item.GetHierarchyRootPlayer());
+		if (!owner || !owner.GetIdentity())
+			return;
+
+		AskalHealthSubscription subscription = s_Instance.m_Subscriptions.Get(owner.GetIdentity().GetId());
+		if (subscription)
+			subscription.Dirty = true;
+	}
+
+	// RPC Handler: cliente abre (true) ou fecha (false) a loja
+	void SubscribeInventoryHealth(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
+	{
+		if (type != CallType.Server || !sender)
+			return;
+
+		Param1<bool> data;
+		if (!ctx.Read(data))
+		{
+			Print("[AskalHealthSync] ❌ Falha ao ler SubscribeInventoryHealth");
+			return;
+		}
+
+		string identityId = sender.GetId();
+		if (!data.param1)
+		{
+			m_Subscriptions.Remove(identityId);
+			s_HasSubscribers = m_Subscriptions.Count() > 0;
+			return;
+		}
+
+		if (!AskalRequestLimiter.TryAcquire(sender, AskalRequestLimiter.KIND_HEALTH))
+			return;
+
+		// (Re)assinatura sempre começa com snapshot completo
+		AskalHealthSubscription subscription = new AskalHealthSubscription(sender);
+		m_Subscriptions.Set(identityId, subscription);
+		s_HasSubscribers = true;
+		PushChanges(subscription, true);
+
+		if (!m_Ticking)
+		{
+			m_Ticking = true;
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(Tick, PUSH_INTERVAL_MS, true);
+		}
+	}
+
+	protected void Tick()
+	{
+		int nowMs = GetGame().GetTime();
+		array<string> dropped = new array<string>();
+		foreach (string identityId, AskalHealthSubscription subscription : m_Subscriptions)
+		{
+			if (!subscription.Identity)
+			{
+				dropped.Insert(identityId);
+				continue;
+			}
+
+			if (!subscription.Dirty && nowMs - subscription.LastPushMs < RESYNC_INTERVAL_MS)
+				continue;
+
+			if (!PushChanges(subscription, false))
+				dropped.Insert(identityId);
+		}
+
+		foreach (string droppedId : dropped)
+		{
+			m_Subscriptions.Remove(droppedId);
+		}
+
+		s_HasSubscribers = m_Subscriptions.Count() > 0;
+		if (!s_HasSubscribers)
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Tick);
+			m_Ticking = false;
+		}
+	}
+
+	// Envia o que mudou desde o último envio; false se o player não existe mais
+	protected bool PushChanges(AskalHealthSubscription subscription, bool reset)
+	{
+		if (!subscription.Identity)
+			return false;
+
+		PlayerBase player = AskalSellService.GetPlayerFromIdentity(subscription.Identity);
+		if (!player || !player.GetInventory())
+			return false;
+
+		subscription.Dirty = false;
+		subscription.LastPushMs = GetGame().GetTime();
+
+		AskalPriceBook priceBook = AskalPriceBook.Get("", "");
+
+		foreach (string sentKey, AskalSentCondition sentEntry : subscription.Sent)
+		{
+			sentEntry.Seen = false;
+		}
+
+		array<int> ids = new array<int>();
+		array<float> healths = new array<float>();
+		array<float> quantities = new array<float>();
+
+		array<EntityAI> inventoryItems = new array<EntityAI>();
+		player.GetInventory().EnumerateInventory(InventoryTraversalType.PREORDER, inventoryItems);
+		foreach (EntityAI item : inventoryItems)
+		{
+			if (!item || item == player)
+				continue;
+
+			// Só itens que existem no catálogo
+			if (!priceBook || !priceBook.GetEntry(item.GetType()))
+				continue;
+
+			int lowBits;
+			int highBits;
+			item.GetNetworkID(lowBits, highBits);
+			string key = AskalHealthSyncCache.MakeKey(lowBits, highBits);
+
+			AskalSentCondition sent;
+			if (!subscription.Sent.Find(key, sent))
+			{
+				sent = new AskalSentCondition(item, lowBits, highBits);
+				subscription.Sent.Insert(key, sent);
+			}
+			sent.Seen = true;
+
+			float healthPercent = Math.Clamp(item.GetHealth01() * 100.0, 0, 100);
+			float quantityPercent = GetQuantityPercent(item);
+			if (Math.AbsFloat(healthPercent - sent.HealthPercent) < HEALTH_EPSILON && Math.AbsFloat(quantityPercent - sent.QuantityPercent) < QUANTITY_EPSILON)
+				continue;
+
+			sent.HealthPercent = healthPercent;
+			sent.QuantityPercent = quantityPercent;
+			ids.Insert(lowBits);
+			ids.Insert(highBits);
+			healths.Insert(healthPercent);
+			quantities.Insert(quantityPercent);
+		}
+
+		array<int> removedIds = new array<int>();
+		array<string> removedKeys = new array<string>();
+		foreach (string staleKey, AskalSentCondition staleEntry : subscription.Sent)
+		{
+			if (staleEntry.Seen)
+				continue;
+
+			removedKeys.Insert(staleKey);
+			removedIds.Insert(staleEntry.LowBits);
+			removedIds.Insert(staleEntry.HighBits);
+		}
+		foreach (string removedKey : removedKeys)
+		{
+			subscription.Sent.Remove(removedKey);
+		}
+
+		if (!reset && ids.Count() == 0 && removedIds.Count() == 0)
+			return true;
+
+		Param5<bool, ref array<int>, ref array<float>, ref array<float>, ref array<int>> params = new Param5<bool, ref array<int>, ref array<float>, ref array<float>, ref array<int>>(reset, ids, healths, quantities, removedIds);
+		GetRPCManager().SendRPC("AskalCoreModule", "InventoryHealthDelta", params, true, subscription.Identity, NULL);
+		AskalMetrics.RecordRpc("InventoryHealthDelta", AskalMetrics.NUMBER_BYTES * (5 + ids.Count() + healths.Count() + quantities.Count() + removedIds.Count()));
+		return true;
+	}
+
+	// Quantidade em % do máximo (mesma regra da venda: magazines não contam), -1 se não tem
+	protected static float GetQuantityPercent(EntityAI item)
+	{
+		ItemBase itemBase = ItemBase.Cast(item);
+		if (!itemBase || !itemBase.HasQuantity() || Magazine.Cast(item))
+			return -1;
+
+		float maxQty = itemBase.GetQuantityMax();
+		if (maxQty <= 0)
+			return -1;
+
+		return Math.Clamp(itemBase.GetQuantity() / maxQty * 100.0, 0, 100);
+	}
+}
@@ -0,0 +1,247 @@
+// ==========================================
+// AskalInventoryFitPlanner - Simulação de espaço no inventário (dry-run)
+// Reserva slots/células de cargo para um carrinho inteiro antes de criar entidades
+// Percorre attachments e containers guardados no cargo (estojos, kits, caixas);
+// containers aninhados seguem a regra do inventário de não receber itens com cargo
+// O plano é consultivo: restrições de script por instância (CanReceiveItemIntoCargo)
+// não são visíveis pela classe, então uma linha aprovada ainda pode falhar no spawn.
+// Nesse caso nada é cobrado (o serviço cria o item antes de debitar o balance)
+// ==========================================
+
+class AskalFitCargoGrid
+{
+	EntityAI Owner;
+	int Width;
+	int Height;
+	bool Nested;           // Container guardado no cargo de outro (não aceita itens com cargo)
+	ref array<bool> Cells; // row * Width + col -> ocupado
+
+	void AskalFitCargoGrid(EntityAI owner, int width, int height, bool nested = false)
+	{
+		Owner = owner;
+		Width = width;
+		Height = height;
+		Nested = nested;
+		Cells = new array<bool>();
+		Cells.Resize(width * height);
+		for (int i = 0; i < Cells.Count(); i++)
+			Cells.Set(i, false);
+	}
+
+	void Mark(int row, int col, int w, int h)
+	{
+		for (int r = row; r < row + h && r < Height; r++)
+		{
+			for (int c = col; c < col + w && c < Width; c++)
+			{
+				if (r >= 0 && c >= 0)
+					Cells.Set(r * Width + c, true);
+			}
+		}
+	}
+
+	bool IsFree(int row, int col, int w, int h)
+	{
+		if (row + h > Height || col + w > Width)
+			return false;
+
+		for (int r = row; r < row + h; r++)
+		{
+			for (int c = col; c < col + w; c++)
+			{
+				if (Cells[r * Width + c])
+					return false;
+			}
+		}
+		return true;
+	}
+
+	// First-fit: tenta a orientação normal e depois a rotacionada
+	bool Reserve(int w, int h)
+	{
+		if (TryReserve(w, h))
+			return true;
+		if (w != h && TryReserve(h, w))
+			return true;
+		return false;
+	}
+
+	protected bool TryReserve(int w, int h)
+	{
+		for (int row = 0; row + h <= Height; row++)
+		{
+			for (int col = 0; col + w <= Width; col++)
+			{
+				if (IsFree(row, col, w, h))
+				{
+					Mark(row, col, w, h);
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+}
+
+class AskalInventoryFitPlanner
+{
+	protected PlayerBase m_Player;
+	protected ref array<EntityAI> m_Containers;          // player + attachments (recursivo), donos de slots
+	protected ref array<ref AskalFitCargoGrid> m_Grids;  // cargo livre simulado
+	protected ref map<string, bool> m_ReservedSlots;     // "<containerId>:<slotId>" -> reservado
+
+	void AskalInventoryFitPlanner(PlayerBase player)
+	{
+		m_Player = player;
+		m_Containers = new array<EntityAI>();
+		m_Grids = new array<ref AskalFitCargoGrid>();
+		m_ReservedSlots = new map<string, bool>();
+
+		if (m_Player)
+			CollectContainers(m_Player, false);
+	}
+
+	// Reserva uma localização para o item (attachment livre primeiro, depois cargo)
+	// Retorna false se o item não couber no estado simulado atual
+	bool Reserve(string itemClass)
+	{
+		if (!m_Player || !itemClass || itemClass == "")
+			return false;
+
+		if (ReserveAttachmentSlot(itemClass))
+			return true;
+
+		int itemWidth;
+		int itemHeight;
+		GetItemSize(itemClass, itemWidth, itemHeight);
+		bool itemHasCargo = HasCargo(itemClass);
+
+		foreach (AskalFitCargoGrid grid : m_Grids)
+		{
+			if (grid.Nested && itemHasCargo)
+				continue;
+			if (grid.Reserve(itemWidth, itemHeight))
+				return true;
+		}
+
+		return false;
+	}
+
+	// inCargo = entidade guardada no cargo de outra: só o cargo dela conta, sem slots
+	protected void CollectContainers(EntityAI entity, bool inCargo)
+	{
+		if (!entity || !entity.GetInventory())
+			return;
+
+		CargoBase cargo = entity.GetInventory().GetCargo();
+		if (cargo && cargo.GetWidth() > 0 && cargo.GetHeight() > 0)
+		{
+			AskalFitCargoGrid grid = new AskalFitCargoGrid(entity, cargo.GetWidth(), cargo.GetHeight(), inCargo);
+			for (int i = 0; i < cargo.GetItemCount(); i++)
+			{
+				int row;
+				int col;
+				int w;
+				int h;
+				cargo.GetItemRowCol(i, row, col);
+				cargo.GetItemSize(i, w, h);
+				grid.Mark(row, col, w, h);
+
+				// Containers dentro do cargo (um nível: o inventário não aninha containers com cargo)
+				EntityAI cargoItem = cargo.GetItem(i);
+				if (!inCargo && cargoItem)
+					CollectContainers(cargoItem, true);
+			}
+			m_Grids.Insert(grid);
+		}
+
+		if (inCargo)
+			return;
+
+		m_Containers.Insert(entity);
+
+		int attachmentCount = entity.GetInventory().AttachmentCount();
+		for (int a = 0; a < attachmentCount; a++)
+		{
+			EntityAI attachment = entity.GetInventory().GetAttachmentFromIndex(a);
+			if (attachment)
+				CollectContainers(attachment, false);
+		}
+	}
+
+	protected bool ReserveAttachmentSlot(string itemClass)
+	{
+		array<string> slotNames = new array<string>();
+		string configRoot = GetConfigRoot(itemClass);
+		GetGame().ConfigGetTextArray(configRoot + " " + itemClass + " inventorySlot", slotNames);
+		if (slotNames.Count() == 0)
+		{
+			string singleSlot = "";
+			GetGame().ConfigGetText(configRoot + " " + itemClass + " inventorySlot", singleSlot);
+			if (singleSlot != "")
+				slotNames.Insert(singleSlot);
+		}
+
+		if (slotNames.Count() == 0)
+			return false;
+
+		foreach (EntityAI container : m_Containers)
+		{
+			foreach (string slotName : slotNames)
+			{
+				int slotId = InventorySlots.GetSlotIdFromString(slotName);
+				if (slotId == InventorySlots.INVALID)
+					continue;
+
+				if (!container.GetInventory().HasAttachmentSlot(slotId))
+					continue;
+
+				if (container.GetInventory().FindAttachment(slotId))
+					continue;
+
+				string reservationKey = container.GetID().ToString() + ":" + slotId;
+				if (m_ReservedSlots.Contains(reservationKey))
+					continue;
+
+				m_ReservedSlots.Insert(reservationKey, true);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	static string GetConfigRoot(string itemClass)
+	{
+		if (GetGame().ConfigIsExisting("CfgWeapons " + itemClass))
+			return "CfgWeapons";
+		if (GetGame().ConfigIsExisting("CfgMagazines " + itemClass))
+			return "CfgMagazines";
+		return "CfgVehicles";
+	}
+
+	// Item com cargo próprio (itemsCargoSize[] do config), ex.: mochilas, estojos
+	static bool HasCargo(string itemClass)
+	{
+		TIntArray cargoSize = new TIntArray();
+		GetGame().ConfigGetIntArray(GetConfigRoot(itemClass) + " " + itemClass + " itemsCargoSize", cargoSize);
+		return cargoSize.Count() >= 2 && cargoSize[0] > 0 && cargoSize[1] > 0;
+	}
+
+	// Tamanho em células (itemSize[] do config; 1x1 se ausente)
+	static void GetItemSize(string itemClass, out int width, out int height)
+	{
+		width = 1;
+		height = 1;
+
+		TIntArray itemSize = new TIntArray();
+		GetGame().ConfigGetIntArray(GetConfigRoot(itemClass) + " " + itemClass + " itemSize", itemSize);
+		if (itemSize.Count() >= 2)
+		{
+			if (itemSize[0] > 0)
+				width = itemSize[0];
+			if (itemSize[1] > 0)
+				height = itemSize[1];
+		}
+	}
+}
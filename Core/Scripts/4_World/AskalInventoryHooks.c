@@ -0,0 +1,87 @@
+// ==========================================
+// Hooks de inventário para o AskalInventoryModel (cliente) e para o
+// AskalHealthSyncModule (servidor, marca o assinante dono do item como sujo)
+// Só repassam o evento; cada lado ignora tudo enquanto não estiver rastreando
+// ==========================================
+
+modded class ItemBase
+{
+	override void EECargoIn(EntityAI item)
+	{
+		super.EECargoIn(item);
+		AskalInventoryModel.NotifyContainerChanged(this, item);
+		AskalHealthSyncModule.NotifyItemChanged(this);
+	}
+	
+	override void EECargoOut(EntityAI item)
+	{
+		super.EECargoOut(item);
+		AskalInventoryModel.NotifyContainerChanged(this, item);
+		AskalHealthSyncModule.NotifyItemChanged(this);
+	}
+	
+	override void EEItemAttached(EntityAI item, string slot_name)
+	{
+		super.EEItemAttached(item, slot_name);
+		AskalInventoryModel.NotifyContainerChanged(this, item);
+		AskalHealthSyncModule.NotifyItemChanged(this);
+	}
+	
+	override void EEItemDetached(EntityAI item, string slot_name)
+	{
+		super.EEItemDetached(item, slot_name);
+		AskalInventoryModel.NotifyContainerChanged(this, item);
+		AskalHealthSyncModule.NotifyItemChanged(this);
+	}
+	
+	override void OnQuantityChanged(float delta)
+	{
+		super.OnQuantityChanged(delta);
+		AskalInventoryModel.NotifyQuantityChanged(this);
+		AskalHealthSyncModule.NotifyItemChanged(this);
+	}
+	
+	override void EEHealthLevelChanged(int oldLevel, int newLevel, string zone)
+	{
+		super.EEHealthLevelChanged(oldLevel, newLevel, zone);
+		AskalHealthSyncModule.NotifyItemChanged(this);
+	}
+	
+	override void EEDelete(EntityAI parent)
+	{
+		AskalInventoryModel.NotifyDeleted(this);
+		AskalHealthSyncModule.NotifyItemChanged(this);
+		super.EEDelete(parent);
+	}
+}
+
+modded class PlayerBase
+{
+	override void EEItemAttached(EntityAI item, string slot_name)
+	{
+		super.EEItemAttached(item, slot_name);
+		AskalInventoryModel.NotifyContainerChanged(this, item);
+		AskalHealthSyncModule.NotifyItemChanged(this);
+	}
+	
+	override void EEItemDetached(EntityAI item, string slot_name)
+	{
+		super.EEItemDetached(item, slot_name);
+		AskalInventoryModel.NotifyContainerChanged(this, item);
+		AskalHealthSyncModule.NotifyItemChanged(this);
+	}
+	
+	override void EEItemIntoHands(EntityAI item)
+	{
+		super.EEItemIntoHands(item);
+		AskalInventoryModel.NotifyContainerChanged(this, item);
+		AskalHealthSyncModule.NotifyItemChanged(this);
+	}
+	
+	override void EEItemOutOfHands(EntityAI item)
+	{
+		super.EEItemOutOfHands(item);
+		AskalInventoryModel.NotifyContainerChanged(this, item);
+		AskalHealthSyncModule.NotifyItemChanged(this);
+	}
+}
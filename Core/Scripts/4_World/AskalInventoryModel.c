@@ -0,0 +1,289 @@
+// ==========================================
+// AskalInventoryModel - Modelo incremental do inventário do player (cliente)
+// Uma enumeração completa ao anexar o player; depois só eventos de inventário
+// (cargo/attachment/mãos/quantidade/delete) atualizam o índice className -> entidades
+// ==========================================
+
+class AskalInventoryModel
+{
+	private static ref AskalInventoryModel s_Instance;
+	protected static bool s_Tracking = false;   // Checagem barata para os hooks de inventário
+
+	protected PlayerBase m_Player;
+	protected ref map<string, ref array<EntityAI>> m_ItemsByClass; // className (lower) -> entidades
+	protected ref map<EntityAI, string> m_Tracked;                 // entidade -> className (lower)
+	protected ref map<EntityAI, bool> m_CargoFilled;               // container -> tem itens no cargo
+	protected ref map<EntityAI, bool> m_Dirty;                     // entidades a reconciliar no flush
+	protected bool m_FlushScheduled;
+	protected int m_Revision;
+
+	void AskalInventoryModel()
+	{
+		m_ItemsByClass = new map<string, ref array<EntityAI>>();
+		m_Tracked = new map<EntityAI, string>();
+		m_CargoFilled = new map<EntityAI, bool>();
+		m_Dirty = new map<EntityAI, bool>();
+		m_FlushScheduled = false;
+		m_Revision = 0;
+	}
+
+	static AskalInventoryModel GetInstance()
+	{
+		if (!s_Instance)
+			s_Instance = new AskalInventoryModel();
+		return s_Instance;
+	}
+
+	static bool IsTracking()
+	{
+		return s_Tracking;
+	}
+
+	// Garante que o modelo representa o player local (enumera só na primeira vez ou se o player mudou)
+	bool EnsureAttached()
+	{
+		PlayerBase player = PlayerBase.Cast(GetGame().GetPlayer());
+		if (!player)
+		{
+			Detach();
+			return false;
+		}
+
+		if (player == m_Player && s_Tracking)
+			return true;
+
+		Detach();
+		m_Player = player;
+		AddSubtree(m_Player);
+		s_Tracking = true;
+		m_Revision++;
+
+		Print("[AskalInventory] ✅ Modelo do inventário construído: " + m_Tracked.Count() + " itens, " + m_ItemsByClass.Count() + " tipos");
+		return true;
+	}
+
+	void Detach()
+	{
+		s_Tracking = false;
+		m_Player = NULL;
+		m_ItemsByClass.Clear();
+		m_Tracked.Clear();
+		m_CargoFilled.Clear();
+		m_Dirty.Clear();
+	}
+
+	// Incrementa a cada mudança (itens, quantidade ou cargo)
+	int GetRevision()
+	{
+		return m_Revision;
+	}
+
+	map<string, ref array<EntityAI>> GetItemsByClass()
+	{
+		return m_ItemsByClass;
+	}
+
+	bool Contains(string className)
+	{
+		array<EntityAI> items = GetItems(className);
+		return items && items.Count() > 0;
+	}
+
+	array<EntityAI> GetItems(string className)
+	{
+		if (!className || className == "")
+			return NULL;
+
+		string classLower = className;
+		classLower.ToLower();
+
+		array<EntityAI> items;
+		if (m_ItemsByClass.Find(classLower, items))
+			return items;
+		return NULL;
+	}
+
+	EntityAI GetFirst(string className)
+	{
+		array<EntityAI> items = GetItems(className);
+		if (items && items.Count() > 0)
+			return items.Get(0);
+		return NULL;
+	}
+
+	// Item tem algo no cargo (attachments não contam) - venda bloqueada
+	bool HasCargo(EntityAI item)
+	{
+		if (!item)
+			return false;
+
+		bool filled;
+		if (m_CargoFilled.Find(item, filled))
+			return filled;
+
+		filled = ComputeCargoFilled(item);
+		if (m_Tracked.Contains(item))
+			m_CargoFilled.Set(item, filled);
+		return filled;
+	}
+
+	bool IsSellable(EntityAI item)
+	{
+		return item && m_Tracked.Contains(item) && !HasCargo(item);
+	}
+
+	// ========================================
+	// Hooks (ItemBase / PlayerBase)
+	// ========================================
+	static void NotifyContainerChanged(EntityAI container, EntityAI item)
+	{
+		if (!s_Tracking || !s_Instance)
+			return;
+
+		s_Instance.MarkDirty(item);
+		if (container)
+			s_Instance.m_CargoFilled.Remove(container);
+	}
+
+	static void NotifyQuantityChanged(EntityAI item)
+	{
+		if (!s_Tracking || !s_Instance || !s_Instance.m_Tracked.Contains(item))
+			return;
+
+		s_Instance.ScheduleFlush();
+	}
+
+	static void NotifyDeleted(EntityAI item)
+	{
+		if (!s_Tracking || !s_Instance || !s_Instance.m_Tracked.Contains(item))
+			return;
+
+		// Remove já: depois do delete a referência não existe mais
+		s_Instance.RemoveEntity(item);
+		s_Instance.m_Dirty.Remove(item);
+		s_Instance.ScheduleFlush();
+	}
+
+	// ========================================
+	// Internos
+	// ========================================
+	protected void MarkDirty(EntityAI item)
+	{
+		if (!item)
+			return;
+
+		m_Dirty.Set(item, true);
+		ScheduleFlush();
+	}
+
+	protected void ScheduleFlush()
+	{
+		if (m_FlushScheduled)
+			return;
+
+		m_FlushScheduled = true;
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(Flush, 0, false);
+	}
+
+	// Reconcilia as entidades tocadas pelos eventos (ordem in/out dos eventos não importa)
+	protected void Flush()
+	{
+		m_FlushScheduled = false;
+		if (!s_Tracking)
+			return;
+
+		foreach (EntityAI item, bool dirty : m_Dirty)
+		{
+			if (!item)
+				continue;
+
+			if (item.GetHierarchyRootPlayer() == m_Player)
+				AddSubtree(item);
+			else
+				RemoveSubtree(item);
+		}
+		m_Dirty.Clear();
+
+		m_Revision++;
+		AskalEventBus.Publish(AskalEventBus.INVENTORY_CHANGED);
+	}
+
+	protected void AddSubtree(EntityAI root)
+	{
+		if (!root || !root.GetInventory())
+			return;
+
+		array<EntityAI> subtree = new array<EntityAI>();
+		root.GetInventory().EnumerateInventory(InventoryTraversalType.PREORDER, subtree);
+		foreach (EntityAI entity : subtree)
+		{
+			// O próprio player não é item negociável
+			if (!entity || entity == m_Player)
+				continue;
+
+			m_CargoFilled.Remove(entity);
+			if (m_Tracked.Contains(entity))
+				continue;
+
+			string classLower = entity.GetType();
+			classLower.ToLower();
+
+			array<EntityAI> items;
+			if (!m_ItemsByClass.Find(classLower, items))
+			{
+				items = new array<EntityAI>();
+				m_ItemsByClass.Insert(classLower, items);
+			}
+			items.Insert(entity);
+			m_Tracked.Insert(entity, classLower);
+		}
+	}
+
+	protected void RemoveSubtree(EntityAI root)
+	{
+		if (!root)
+			return;
+
+		if (!root.GetInventory())
+		{
+			RemoveEntity(root);
+			return;
+		}
+
+		array<EntityAI> subtree = new array<EntityAI>();
+		root.GetInventory().EnumerateInventory(InventoryTraversalType.PREORDER, subtree);
+		foreach (EntityAI entity : subtree)
+		{
+			RemoveEntity(entity);
+		}
+	}
+
+	protected void RemoveEntity(EntityAI entity)
+	{
+		string classLower;
+		if (!entity || !m_Tracked.Find(entity, classLower))
+			return;
+
+		m_Tracked.Remove(entity);
+		m_CargoFilled.Remove(entity);
+
+		array<EntityAI> items;
+		if (!m_ItemsByClass.Find(classLower, items))
+			return;
+
+		int index = items.Find(entity);
+		if (index != -1)
+			items.RemoveOrdered(index);
+		if (items.Count() == 0)
+			m_ItemsByClass.Remove(classLower);
+	}
+
+	protected static bool ComputeCargoFilled(EntityAI item)
+	{
+		if (!item.GetInventory())
+			return false;
+
+		CargoBase cargo = item.GetInventory().GetCargo();
+		return cargo && cargo.GetItemCount() > 0;
+	}
+}
@@ -0,0 +1,167 @@
+// ==========================================
+// AskalPerfConsoleModule - Console de performance para admins (servidor)
+// Responde RequestPerfStats com linhas prontas para o painel de debug da loja
+// Acesso: Permissions do AskalPlayerData ("PerfConsole" ou "Admin" >= 1), via AskalPermissionCache
+// Resposta: (autorizado, linhas); o cliente para de pedir ao receber autorizado = false
+// ==========================================
+
+class AskalPerfConsoleModule
+{
+	static const string PERMISSION_KEY = "PerfConsole";
+	static const string ADMIN_PERMISSION_KEY = "Admin";
+	protected static const int SLOWEST_TRANSACTIONS = 5;
+	protected static const int ITEM_OVERHEAD_BYTES = 48;   // Estimativa por ItemData/entrada de índice
+	protected static const int PRICE_ENTRY_BYTES = 40;     // Estimativa por AskalPriceEntry + chave
+
+	protected static ref AskalPerfConsoleModule s_Instance;
+
+	void AskalPerfConsoleModule()
+	{
+		if (GetGame().IsServer())
+			GetRPCManager().AddRPC("AskalCoreModule", "RequestPerfStats", this, SingleplayerExecutionType.Server);
+	}
+
+	static AskalPerfConsoleModule GetInstance()
+	{
+		if (!s_Instance)
+			s_Instance = new AskalPerfConsoleModule();
+		return s_Instance;
+	}
+
+	// RPC Handler: admin pede as estatísticas atuais
+	void RequestPerfStats(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
+	{
+		if (type != CallType.Server || !sender)
+			return;
+
+		// Acima do limite não responde (o cliente só pede a cada poucos segundos)
+		if (!AskalRequestLimiter.TryAcquire(sender, AskalRequestLimiter.KIND_ADMIN))
+			return;
+
+		if (!HasPermission(sender))
+		{
+			AskalLog.Warn("PerfConsole", "⚠️ RequestPerfStats negado para: " + sender.GetName());
+			array<string> deniedLines = new array<string>();
+			deniedLines.Insert("Sem permissão (Permissions: " + PERMISSION_KEY + ")");
+			SendResponse(sender, false, deniedLines);
+			return;
+		}
+
+		SendResponse(sender, true, BuildStatsLines());
+	}
+
+	static void SendResponse(PlayerIdentity identity, bool authorized, array<string> lines)
+	{
+		Param2<bool, ref array<string>> params = new Param2<bool, ref array<string>>(authorized, lines);
+		GetRPCManager().SendRPC("AskalCoreModule", "PerfStatsResponse", params, true, identity, NULL);
+		AskalMetrics.RecordRpc("PerfStatsResponse", AskalMetrics.NUMBER_BYTES + AskalMetrics.StringArrayBytes(lines));
+	}
+
+	static bool HasPermission(PlayerIdentity identity)
+	{
+		if (AskalPermissionCache.GetLevel(identity, PERMISSION_KEY) >= 1)
+			return true;
+		return AskalPermissionCache.GetLevel(identity, ADMIN_PERMISSION_KEY) >= 1;
+	}
+
+	// ========================================
+	// Montagem das linhas
+	// ========================================
+	static array<string> BuildStatsLines()
+	{
+		array<string> lines = new array<string>();
+
+		// Catálogo em memória
+		int datasetCount = 0;
+		int categoryCount = 0;
+		int itemCount = 0;
+		int catalogBytes = 0;
+		if (AskalDatabase.m_Datasets)
+		{
+			foreach (string datasetId, Dataset dataset : AskalDatabase.m_Datasets)
+			{
+				if (!dataset || !dataset.Categories)
+					continue;
+
+				datasetCount++;
+				foreach (string categoryId, AskalCategory category : dataset.Categories)
+				{
+					if (!category || !category.Items)
+						continue;
+
+					categoryCount++;
+					foreach (string itemClass, ItemData itemData : category.Items)
+					{
+						itemCount++;
+						catalogBytes += itemClass.Length() + ITEM_OVERHEAD_BYTES;
+					}
+				}
+			}
+		}
+		lines.Insert("Catálogo: " + datasetCount + " datasets, " + categoryCount + " categorias, " + itemCount + " itens (~" + (catalogBytes / 1024) + " KB)");
+
+		int priceEntries = AskalPriceBook.GetTotalEntryCount();
+		lines.Insert("PriceBook: " + AskalPriceBook.GetStatsSummary() + " (~" + (priceEntries * PRICE_ENTRY_BYTES / 1024) + " KB)");
+
+		// Caches
+		lines.Insert("Cache nomes: " + FormatHitRate(AskalMetrics.GetCounter("cache.display_name.hit"), AskalMetrics.GetCounter("cache.display_name.miss")) + " (" + AskalPurchaseService.GetDisplayNameCacheCount() + " nomes)");
+		lines.Insert("Cache cotações: " + AskalSellQuoteCache.GetStatsSummary());
+		lines.Insert("Balance (sem cache, disco): " + FormatHistogramShort("player.load_ms") + " | gravação " + FormatHistogramShort("player.save_ms"));
+		lines.Insert("Trader config (sem cache, disco): " + FormatHistogramShort("trader.config_load_ms"));
+
+		// Filas
+		lines.Insert("Filas: cotações pendentes=" + AskalSellModule.GetInstance().GetPendingQuoteCount() + " | assinaturas health=" + AskalHealthSyncModule.GetInstance().GetSubscriptionCount() + " | syncs=" + AskalMetrics.GetCounter("sync.sessions") + " | rpc bytes=" + AskalMetrics.GetCounter("rpc.total.bytes"));
+		lines.Insert("Rate limit: " + AskalRequestLimiter.GetStatsSummary());
+
+		// Latência por operação
+		lines.Insert("Latência (n / p50 / p95 / max ms):");
+		array<string> histogramNames = AskalMetrics.GetHistogramNames();
+		foreach (string histogramName : histogramNames)
+		{
+			lines.Insert("  " + histogramName + ": " + FormatHistogramShort(histogramName));
+		}
+
+		// Transações mais lentas
+		array<AskalMetricTransaction> slowest = AskalMetrics.GetSlowestTransactions(SLOWEST_TRANSACTIONS);
+		lines.Insert("Mais lentas (últimas transações):");
+		if (slowest.Count() == 0)
+			lines.Insert("  (nenhuma)");
+		foreach (AskalMetricTransaction transaction : slowest)
+		{
+			lines.Insert("  " + transaction.Time + " " + transaction.Kind + " " + FormatMs(transaction.Ms) + "ms " + transaction.Detail);
+		}
+
+		return lines;
+	}
+
+	protected static string FormatHistogramShort(string name)
+	{
+		AskalMetricHistogram histogram = AskalMetrics.GetHistogram(name);
+		if (!histogram || histogram.Count == 0)
+			return "n=0";
+
+		return "n=" + histogram.Count + " / " + FormatMs(histogram.GetPercentileMs(0.5)) + " / " + FormatMs(histogram.GetPercentileMs(0.95)) + " / " + FormatMs(histogram.MaxMs);
+	}
+
+	protected static string FormatHitRate(int hits, int misses)
+	{
+		int total = hits + misses;
+		if (total == 0)
+			return "sem acessos";
+
+		int percent = (hits * 100) / total;
+		return percent.ToString() + "% (hits=" + hits + " misses=" + misses + ")";
+	}
+
+	// Uma casa decimal (-1 = acima do maior bucket)
+	protected static string FormatMs(float ms)
+	{
+		if (ms < 0)
+			return ">1000";
+
+		int tenths = Math.Round(ms * 10);
+		int whole = tenths / 10;
+		int fraction = tenths % 10;
+		return whole.ToString() + "." + fraction.ToString();
+	}
+}
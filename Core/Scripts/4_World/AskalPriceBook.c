@@ -0,0 +1,291 @@
+// ==========================================
+// AskalPriceBook - Tabela de preços autoritativa do catálogo
+// Preço final de compra (com attachments padrão e coeficiente) e base de venda
+// Um livro por fonte de coeficientes (hoje só a Virtual Store, que os traders também
+// usam); loja e moeda não mudam os valores, então todas compartilham o mesmo livro
+// Reconstruída apenas quando o catálogo ou os coeficientes mudam
+// ==========================================
+
+class AskalPriceEntry
+{
+	int BuyPrice;      // Preço final de compra (item + attachments, coeficiente aplicado)
+	int BasePrice;     // Preço base do item (normalizado)
+	int SellPercent;   // Percentual de venda (normalizado)
+	float SellBase;    // BasePrice * SellPercent (sem coeficiente, health ou quantidade)
+	int CatalogPrice;  // Preço do catálogo sem normalizar (<= 0 = sem preço próprio)
+
+	void AskalPriceEntry(int buyPrice, int basePrice, int sellPercent, int catalogPrice)
+	{
+		BuyPrice = buyPrice;
+		BasePrice = basePrice;
+		SellPercent = sellPercent;
+		SellBase = basePrice * (sellPercent / 100.0);
+		CatalogPrice = catalogPrice;
+	}
+}
+
+class AskalPriceBook
+{
+	static const string VIRTUAL_STORE_KEY = "VirtualStore";
+
+	protected static ref map<string, ref AskalPriceBook> s_Books; // fonte de coeficientes -> book
+	protected static int s_BuildCounter = 0;
+
+	protected string m_CoefficientSource;
+	protected int m_CatalogRevision;
+	protected int m_BuildId;                                  // Muda a cada reconstrução (invalida cotações)
+	protected float m_BuyCoefficient;
+	protected float m_SellCoefficient;
+	protected ref map<string, ref AskalPriceEntry> m_Entries; // className (lower) -> entry
+	protected ref map<string, float> m_AmmoUnitPrices;        // ammo className (lower) -> preço por unidade
+
+	void AskalPriceBook(string coefficientSource)
+	{
+		m_CoefficientSource = coefficientSource;
+		m_CatalogRevision = -1;
+		m_BuildId = 0;
+		m_BuyCoefficient = 1.0;
+		m_SellCoefficient = 1.0;
+		m_Entries = new map<string, ref AskalPriceEntry>();
+		m_AmmoUnitPrices = new map<string, float>();
+	}
+
+	// Obtém o livro de preços usado pela loja/moeda; desatualizado vira uma instância nova
+	// (quem ainda segura o livro anterior continua com os preços antigos)
+	static AskalPriceBook Get(string traderName, string currencyId)
+	{
+		if (!s_Books)
+			s_Books = new map<string, ref AskalPriceBook>();
+
+		string coefficientSource = ResolveCoefficientSource(traderName);
+
+		AskalPriceBook book;
+		if (s_Books.Find(coefficientSource, book) && !book.IsStale())
+			return book;
+
+		book = new AskalPriceBook(coefficientSource);
+		book.Rebuild();
+		s_Books.Set(coefficientSource, book);
+		return book;
+	}
+
+	static string GetStatsSummary()
+	{
+		int bookCount = 0;
+		if (s_Books)
+			bookCount = s_Books.Count();
+		return "books=" + bookCount + " entries=" + GetTotalEntryCount() + " rebuilds=" + s_BuildCounter;
+	}
+
+	static int GetTotalEntryCount()
+	{
+		int entryCount = 0;
+		if (s_Books)
+		{
+			foreach (string bookKey, AskalPriceBook book : s_Books)
+			{
+				entryCount += book.GetEntryCount();
+			}
+		}
+		return entryCount;
+	}
+
+	// Descarta todos os livros (próximo Get reconstrói)
+	static void InvalidateAll()
+	{
+		if (s_Books)
+			s_Books.Clear();
+	}
+
+	static string ResolveStoreKey(string traderName)
+	{
+		if (!traderName || traderName == "" || traderName == "Trader_Default")
+			return VIRTUAL_STORE_KEY;
+		return traderName;
+	}
+
+	// De onde a loja tira os coeficientes (ver ResolveCoefficients): traders usam os da Virtual Store
+	static string ResolveCoefficientSource(string traderName)
+	{
+		return VIRTUAL_STORE_KEY;
+	}
+
+	AskalPriceEntry GetEntry(string className)
+	{
+		if (!className || className == "")
+			return NULL;
+
+		string classLower = className;
+		classLower.ToLower();
+
+		AskalPriceEntry entry;
+		if (m_Entries.Find(classLower, entry))
+			return entry;
+		return NULL;
+	}
+
+	// Preço final de compra, ou -1 se o item não está no catálogo
+	int GetBuyPrice(string className)
+	{
+		AskalPriceEntry entry = GetEntry(className);
+		if (!entry)
+			return -1;
+		return entry.BuyPrice;
+	}
+
+	int GetBuildId()
+	{
+		return m_BuildId;
+	}
+
+	float GetSellCoefficient()
+	{
+		return m_SellCoefficient;
+	}
+
+	float GetBuyCoefficient()
+	{
+		return m_BuyCoefficient;
+	}
+
+	int GetEntryCount()
+	{
+		return m_Entries.Count();
+	}
+
+	// Preço por unidade de munição (preço do item dividido pela quantidade máxima da pilha)
+	// Retorna -1 se a munição não está no catálogo ou não tem preço próprio (sem DEFAULT_BUY_PRICE)
+	float GetAmmoUnitPrice(string ammoClass)
+	{
+		string ammoLower = ammoClass;
+		ammoLower.ToLower();
+
+		float cachedPrice;
+		if (m_AmmoUnitPrices.Find(ammoLower, cachedPrice))
+			return cachedPrice;
+
+		float unitPrice = -1;
+		AskalPriceEntry ammoEntry = GetEntry(ammoClass);
+		if (ammoEntry && ammoEntry.CatalogPrice > 0)
+		{
+			unitPrice = ammoEntry.CatalogPrice;
+
+			// Quantidade máxima só é conhecida instanciando o item (uma vez por classe)
+			ItemBase tempAmmo = ItemBase.Cast(GetGame().CreateObjectEx(ammoClass, vector.Zero, ECE_PLACE_ON_SURFACE, RF_DEFAULT));
+			if (tempAmmo && tempAmmo.HasQuantity())
+			{
+				float ammoMaxQty = tempAmmo.GetQuantityMax();
+				if (ammoMaxQty > 0)
+					unitPrice = ammoEntry.CatalogPrice / ammoMaxQty;
+			}
+			if (tempAmmo)
+				GetGame().ObjectDelete(tempAmmo);
+		}
+
+		m_AmmoUnitPrices.Insert(ammoLower, unitPrice);
+		return unitPrice;
+	}
+
+	protected bool IsStale()
+	{
+		if (m_CatalogRevision != AskalDatabase.GetRevision())
+			return true;
+
+		float buyCoeff;
+		float sellCoeff;
+		ResolveCoefficients(buyCoeff, sellCoeff);
+		return buyCoeff != m_BuyCoefficient || sellCoeff != m_SellCoefficient;
+	}
+
+	// Traders usam os mesmos coeficientes da Virtual Store (igual ao que o cliente exibe)
+	// Uma fonte nova aqui precisa de um valor próprio em ResolveCoefficientSource
+	protected void ResolveCoefficients(out float buyCoeff, out float sellCoeff)
+	{
+		buyCoeff = AskalVirtualStoreSettings.GetBuyCoefficient();
+		sellCoeff = AskalVirtualStoreSettings.GetSellCoefficient();
+	}
+
+	protected void Rebuild()
+	{
+		m_Entries.Clear();
+		m_AmmoUnitPrices.Clear();
+		m_CatalogRevision = AskalDatabase.GetRevision();
+		ResolveCoefficients(m_BuyCoefficient, m_SellCoefficient);
+		s_BuildCounter++;
+		m_BuildId = s_BuildCounter;
+
+		// 1ª passada: índice className -> ItemData
+		map<string, ItemData> catalog = new map<string, ItemData>();
+		if (AskalDatabase.m_Datasets)
+		{
+			foreach (string datasetId, Dataset dataset : AskalDatabase.m_Datasets)
+			{
+				if (!dataset || !dataset.Categories)
+					continue;
+
+				foreach (string categoryId, AskalCategory category : dataset.Categories)
+				{
+					if (!category || !category.Items)
+						continue;
+
+					foreach (string itemClass, ItemData itemData : category.Items)
+					{
+						if (!itemData)
+							continue;
+
+						string itemLower = itemClass;
+						itemLower.ToLower();
+						if (!catalog.Contains(itemLower))
+							catalog.Insert(itemLower, itemData);
+					}
+				}
+			}
+		}
+
+		// 2ª passada: preço final com attachments padrão
+		foreach (string classLower, ItemData entryData : catalog)
+		{
+			int totalPrice = NormalizeBuyPrice(entryData.Price);
+			array<string> attachments = entryData.GetAttachments();
+			if (attachments)
+			{
+				foreach (string attachmentClass : attachments)
+				{
+					if (!attachmentClass || attachmentClass == "")
+						continue;
+
+					string attachmentLower = attachmentClass;
+					attachmentLower.ToLower();
+					ItemData attachmentData = catalog.Get(attachmentLower);
+					if (attachmentData)
+						totalPrice += NormalizeBuyPrice(attachmentData.Price);
+				}
+			}
+
+			int sellPercent = entryData.SellPercent;
+			if (sellPercent <= 0)
+				sellPercent = AskalMarketDefaults.DEFAULT_SELL_PERCENT;
+
+			m_Entries.Insert(classLower, new AskalPriceEntry(ApplyBuyCoefficient(totalPrice), NormalizeBuyPrice(entryData.Price), sellPercent, entryData.Price));
+		}
+
+		Print("[AskalPriceBook] ✅ Livro de preços reconstruído: " + m_CoefficientSource + " | " + m_Entries.Count() + " itens");
+	}
+
+	protected static int NormalizeBuyPrice(int price)
+	{
+		if (price <= 0)
+			price = AskalMarketDefaults.DEFAULT_BUY_PRICE;
+		return price;
+	}
+
+	int ApplyBuyCoefficient(int price)
+	{
+		price = NormalizeBuyPrice(price);
+		float adjustedFloat = price * m_BuyCoefficient;
+		int adjusted = Math.Round(adjustedFloat);
+		if (adjusted <= 0)
+			adjusted = 1;
+		return adjusted;
+	}
+}
@@ -9,19 +9,19 @@ class AskalPurchaseModule
 	
 	void AskalPurchaseModule()
 	{
-		Print("[AskalPurchase] ========================================");
-		Print("[AskalPurchase] Módulo de compras inicializado");
-		Print("[AskalPurchase] Registrando RPC handler de compra");
+		AskalLog.Debug("Purchase", "========================================");
+		AskalLog.Info("Purchase", "Módulo de compras inicializado");
+		AskalLog.Debug("Purchase", "Registrando RPC handler de compra");
 		
 		// Registrar RPC handler aqui (4_World tem acesso a PlayerBase)
 		if (GetGame().IsServer())
 		{
 			GetRPCManager().AddRPC("AskalPurchaseModule", "PurchaseItemRequest", this, SingleplayerExecutionType.Server);
 			GetRPCManager().AddRPC("AskalPurchaseModule", "PurchaseBatchRequest", this, SingleplayerExecutionType.Server);
-			Print("[AskalPurchase] ✅ RPC handler registrado");
+			AskalLog.Info("Purchase", "✅ RPC handler registrado");
 		}
 		
-		Print("[AskalPurchase] ========================================");
+		AskalLog.Debug("Purchase", "========================================");
 	}
 	
 	static AskalPurchaseModule GetInstance()
@@ -51,11 +51,11 @@ class AskalPurchaseModule
 	
 	protected void ProcessPurchaseRequest(PlayerIdentity sender, string steamId, string itemClass, int requestedPrice, string currencyId, float itemQuantity, int quantityType, int contentType, string traderName = "")
 	{
-		Print("[AskalPurchase] [PROCESSAR] Iniciando processamento de compra...");
+		AskalLog.Debug("Purchase", "[PROCESSAR] Iniciando processamento de compra...");
 		
 		if (!itemClass || itemClass == "")
 		{
-			Print("[AskalPurchase] [ERRO] ItemClass vazio na requisição de compra");
+			AskalLog.Error("Purchase", "ItemClass vazio na requisição de compra");
 			SendPurchaseResponse(sender, false, itemClass, 0);
 			return;
 		}
@@ -75,7 +75,7 @@ class AskalPurchaseModule
 		
 		if (!AskalMarketConfig.ResolveAcceptedCurrency(traderName, virtualStoreCurrency, resolvedCurrencyId, resolvedCurrencyCfg))
 		{
-			Print("[AskalPurchase] [ERRO] Falha ao resolver currency para trader: " + traderName);
+			AskalLog.Error("Purchase", "Falha ao resolver currency para trader: " + traderName);
 			SendPurchaseResponse(sender, false, itemClass, 0);
 			return;
 		}
@@ -87,25 +87,29 @@ class AskalPurchaseModule
 		{
 			if (!AskalTraderValidationHelper.CanBuyItem(traderName, itemClass))
 			{
-				Print("[AskalPurchase] [ERRO] Item não pode ser comprado neste trader: " + itemClass + " | Trader: " + traderName);
+				AskalLog.Error("Purchase", "Item não pode ser comprado neste trader: " + itemClass + " | Trader: " + traderName);
 				SendPurchaseResponse(sender, false, itemClass, 0);
 				return;
 			}
 		}
 		
-		Print("[AskalPurchase] [COMPRA] Solicitação de compra recebida:");
-		Print("[AskalPurchase]   Player: " + steamId);
-		Print("[AskalPurchase]   Item: " + itemClass);
-		Print("[AskalPurchase]   Preço solicitado: " + requestedPrice);
-		Print("[AskalPurchase]   Moeda: " + currencyId);
-		Print("[AskalPurchase]   Trader: " + traderName);
-		Print("[AskalPurchase]   Quantidade: " + itemQuantity + " | Tipo: " + quantityType + " | Conteúdo: " + contentType);
+		if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+		{
+			AskalLog.Debug("Purchase", "[COMPRA] Solicitação de compra recebida:");
+			AskalLog.Debug("Purchase", "  Player: " + steamId);
+			AskalLog.Debug("Purchase", "  Item: " + itemClass);
+			AskalLog.Debug("Purchase", "  Preço solicitado: " + requestedPrice);
+			AskalLog.Debug("Purchase", "  Moeda: " + currencyId);
+			AskalLog.Debug("Purchase", "  Trader: " + traderName);
+			AskalLog.Debug("Purchase", "  Quantidade: " + itemQuantity + " | Tipo: " + quantityType + " | Conteúdo: " + contentType);
+		}
 		
-		Print("[AskalPurchase] [PROCESSAR] Chamando AskalPurchaseService.ProcessPurchaseWithQuantity...");
+		AskalLog.Debug("Purchase", "[PROCESSAR] Chamando AskalPurchaseService.ProcessPurchaseWithQuantity...");
 		ref array<string> purchaseErrorMessage = new array<string>();
 		bool success = AskalPurchaseService.ProcessPurchaseWithQuantity(sender, steamId, itemClass, requestedPrice, currencyId, itemQuantity, quantityType, contentType, traderName, purchaseErrorMessage);
 		
-		Print("[AskalPurchase] [PROCESSAR] ProcessPurchaseWithQuantity retornou: " + success);
+		if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+			AskalLog.Debug("Purchase", "[PROCESSAR] ProcessPurchaseWithQuantity retornou: " + success);
 		
 		string resultMessage = "Compra realizada com sucesso";
 		if (!success)
@@ -124,42 +128,68 @@ class AskalPurchaseModule
 		string statusText = "ERRO";
 		if (success)
 			statusText = "SUCESSO";
-		Print("[AskalPurchase] [RESULTADO] " + statusText + " - " + resultMessage);
+		AskalLog.Info("Purchase", "[RESULTADO] " + statusText + " - " + resultMessage);
 		
-		Print("[AskalPurchase] [PROCESSAR] Enviando resposta ao cliente...");
+		AskalLog.Debug("Purchase", "[PROCESSAR] Enviando resposta ao cliente...");
 		SendPurchaseResponse(sender, success, itemClass, requestedPrice, resultMessage);
-		Print("[AskalPurchase] [PROCESSAR] Resposta enviada");
+		AskalLog.Debug("Purchase", "[PROCESSAR] Resposta enviada");
 	}
 	
 	// RPC Handler: Servidor processa requisição de compra
 	void PurchaseItemRequest(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
 	{
-		Print("[AskalPurchase] [RPC] PurchaseItemRequest recebido - Type: " + type + " | IsServer: " + GetGame().IsServer());
+		if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+			AskalLog.Debug("Purchase", "[RPC] PurchaseItemRequest recebido - Type: " + type + " | IsServer: " + GetGame().IsServer());
 		
 		if (type != CallType.Server)
 		{
-			Print("[AskalPurchase] [ERRO] PurchaseItemRequest chamado fora do servidor");
+			AskalLog.Error("Purchase", "PurchaseItemRequest chamado fora do servidor");
 			return;
 		}
 		
 		if (!sender)
 		{
-			Print("[AskalPurchase] [ERRO] Sender NULL");
+			AskalLog.Error("Purchase", "Sender NULL");
 			return;
 		}
 		
-		Print("[AskalPurchase] [RPC] Lendo parâmetros do RPC...");
+		AskalLog.Trace("Purchase", "[RPC] Lendo parâmetros do RPC...");
 		Param8<string, string, int, string, float, int, int, string> data;
 		if (!ctx.Read(data))
 		{
-			Print("[AskalPurchase] [ERRO] Erro ao ler PurchaseItemRequest");
+			AskalLog.Error("Purchase", "Erro ao ler PurchaseItemRequest");
+			return;
+		}
+		
+		// Boot escalonado: preço depende do catálogo e do livro de preços
+		if (!AskalServerReadiness.IsStageDone(AskalServerReadiness.STAGE_INDEX))
+		{
+			Param2<PlayerIdentity, ref Param8<string, string, int, string, float, int, int, string>> heldItem = new Param2<PlayerIdentity, ref Param8<string, string, int, string, float, int, int, string>>(sender, data);
+			if (!AskalServerReadiness.Hold(AskalServerReadiness.STAGE_INDEX, this, "HandlePurchaseItem", heldItem))
+				SendPurchaseResponse(sender, false, data.param2, 0, "Servidor iniciando, tente novamente");
+			return;
+		}
+		
+		HandlePurchaseItem(sender, data);
+	}
+	
+	// Compra unitária com parâmetros já lidos (direto ou liberada pelo AskalServerReadiness)
+	void HandlePurchaseItem(PlayerIdentity sender, Param8<string, string, int, string, float, int, int, string> data)
+	{
+		if (!sender || !data)
+			return;
+		
+		if (!AskalRequestLimiter.TryAcquire(sender, AskalRequestLimiter.KIND_PURCHASE))
+		{
+			SendPurchaseResponse(sender, false, data.param2, 0, "Muitas requisições, aguarde um instante");
 			return;
 		}
 		
-		Print("[AskalPurchase] [RPC] Parâmetros lidos com sucesso");
+		AskalLog.Trace("Purchase", "[RPC] Parâmetros lidos com sucesso");
 		string steamId = ResolveSteamId(data.param1, sender);
 		string traderName = data.param8;
-		Print("[AskalPurchase] [RPC] SteamId resolvido: " + steamId + " | Trader: " + traderName);
+		if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+			AskalLog.Debug("Purchase", "[RPC] SteamId resolvido: " + steamId + " | Trader: " + traderName);
 		ProcessPurchaseRequest(sender, steamId, data.param2, data.param3, data.param4, data.param5, data.param6, data.param7, traderName);
 	}
 	
@@ -167,42 +197,85 @@ class AskalPurchaseModule
 	{
 		if (type != CallType.Server)
 		{
-			Print("[AskalPurchase] ⚠️ PurchaseBatchRequest chamado fora do servidor");
+			AskalLog.Warn("Purchase", "⚠️ PurchaseBatchRequest chamado fora do servidor");
 			return;
 		}
 		
 		if (!sender)
 		{
-			Print("[AskalPurchase] ❌ Sender NULL em PurchaseBatchRequest");
+			AskalLog.Error("Purchase", "❌ Sender NULL em PurchaseBatchRequest");
 			return;
 		}
 		
 		Param3<string, string, ref array<ref AskalPurchaseRequestData>> data;
 		if (!ctx.Read(data))
 		{
-			Print("[AskalPurchase] ❌ Erro ao ler PurchaseBatchRequest");
+			AskalLog.Error("Purchase", "❌ Erro ao ler PurchaseBatchRequest");
 			return;
 		}
 		
-		string steamId = ResolveSteamId(data.param1, sender);
-		string currencyId = data.param2;
+		if (!AskalServerReadiness.IsStageDone(AskalServerReadiness.STAGE_INDEX))
+		{
+			Param2<PlayerIdentity, ref Param3<string, string, ref array<ref AskalPurchaseRequestData>>> heldBatch = new Param2<PlayerIdentity, ref Param3<string, string, ref array<ref AskalPurchaseRequestData>>>(sender, data);
+			if (!AskalServerReadiness.Hold(AskalServerReadiness.STAGE_INDEX, this, "HandlePurchaseBatch", heldBatch))
+				SendPurchaseResponse(sender, false, "", 0, "Servidor iniciando, tente novamente");
+			return;
+		}
+		
+		HandlePurchaseBatch(sender, data);
+	}
+	
+	void HandlePurchaseBatch(PlayerIdentity sender, Param3<string, string, ref array<ref AskalPurchaseRequestData>> data)
+	{
+		if (!sender || !data)
+			return;
+		
 		ref array<ref AskalPurchaseRequestData> requests = data.param3;
 		if (!requests || requests.Count() == 0)
 		{
-			Print("[AskalPurchase] ⚠️ PurchaseBatchRequest recebido sem itens");
+			AskalLog.Warn("Purchase", "⚠️ PurchaseBatchRequest recebido sem itens");
+			return;
+		}
+		
+		// O carrinho inteiro é uma ação: custo de lote, não um token por linha
+		if (!AskalRequestLimiter.TryAcquire(sender, AskalRequestLimiter.KIND_PURCHASE, AskalRequestLimiter.GetBatchCost(requests.Count())))
+		{
+			SendPurchaseResponse(sender, false, "", 0, "Muitas requisições, aguarde um instante");
 			return;
 		}
 		
-		Print("[AskalPurchase] 💼 Processando lote de compras: " + requests.Count() + " itens");
+		string steamId = ResolveSteamId(data.param1, sender);
+		string currencyId = data.param2;
+		
+		AskalLog.Info("Purchase", "💼 Processando lote de compras: " + requests.Count() + " itens");
+		
+		// Dry-run: reserva espaço para o carrinho inteiro antes de mover dinheiro ou criar entidades
+		PlayerBase player = AskalPurchaseService.GetPlayerFromIdentity(sender);
+		AskalInventoryFitPlanner fitPlanner = NULL;
+		if (player)
+			fitPlanner = new AskalInventoryFitPlanner(player);
+		
+		int rejectedForSpace = 0;
 		for (int i = 0; i < requests.Count(); i++)
 		{
 			AskalPurchaseRequestData request = requests.Get(i);
 			if (!request)
 				continue;
 			
+			// Veículos são spawnados no mundo e não ocupam inventário
+			if (fitPlanner && !AskalVehicleSpawn.IsVehicleClass(request.ItemClass) && !fitPlanner.Reserve(request.ItemClass))
+			{
+				rejectedForSpace++;
+				SendPurchaseResponse(sender, false, request.ItemClass, 0, "Sem espaço no inventário");
+				continue;
+			}
+			
 			// Batch não tem traderName por enquanto (usar "" para compatibilidade)
 			ProcessPurchaseRequest(sender, steamId, request.ItemClass, request.Price, currencyId, request.Quantity, request.QuantityType, request.ContentType, "");
 		}
+		
+		if (rejectedForSpace > 0)
+			AskalLog.Warn("Purchase", "⚠️ " + rejectedForSpace + " itens do lote rejeitados por falta de espaço (pré-checagem)");
 	}
 	
 	// Enviar resposta de compra para o cliente
@@ -225,6 +298,7 @@ class AskalPurchaseModule
 		
 		Param4<bool, string, string, int> params = new Param4<bool, string, string, int>(success, message, itemClass, price);
 		GetRPCManager().SendRPC("AskalCoreModule", "PurchaseItemResponse", params, true, identity, NULL);
+		AskalMetrics.RecordRpc("PurchaseItemResponse", AskalMetrics.NUMBER_BYTES * 2 + AskalMetrics.StringBytes(message) + AskalMetrics.StringBytes(itemClass));
 	}
 }
 
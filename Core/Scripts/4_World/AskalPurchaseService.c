@@ -10,7 +10,7 @@ class AskalPurchaseService
 	{
 		if (!identity)
 		{
-			Print("[AskalPurchase] âŒ Player identity nÃ£o encontrada");
+			AskalLog.Error("Purchase", "âŒ Player identity nÃ£o encontrada");
 			return false;
 		}
 
@@ -25,7 +25,7 @@ class AskalPurchaseService
 		PlayerBase player = GetPlayerFromIdentity(identity);
 		if (!player)
 		{
-			Print("[AskalPurchase] âŒ Player nÃ£o encontrado");
+			AskalLog.Error("Purchase", "âŒ Player nÃ£o encontrado");
 			return false;
 		}
 		
@@ -33,7 +33,7 @@ class AskalPurchaseService
 		string balanceKey = AskalPlayerBalance.ResolveBalanceKey(currencyId);
 		if (!balanceKey || balanceKey == "")
 		{
-			Print("[AskalPurchase] ❌ Failed to resolve balance key for currency: " + currencyId);
+			AskalLog.Error("Purchase", "❌ Failed to resolve balance key for currency: " + currencyId);
 			return false;
 		}
 		
@@ -41,29 +41,31 @@ class AskalPurchaseService
 		AskalPlayerData playerData = AskalPlayerBalance.LoadPlayerData(steamId);
 		if (!playerData || !playerData.Balance || !playerData.Balance.Contains(balanceKey))
 		{
-			Print("[AskalPurchase] ❌ Player balance missing currency key: " + balanceKey + " (currencyId: " + currencyId + ")");
+			AskalLog.Error("Purchase", "❌ Player balance missing currency key: " + balanceKey + " (currencyId: " + currencyId + ")");
 			return false;
 		}
 
-		int authoritativePrice = ComputeItemTotalPrice(itemClass);
-		Print("[AskalPurchase] [DEBUG] Preço calculado para " + itemClass + ": " + authoritativePrice);
+		int authoritativePrice = ComputeItemTotalPrice(itemClass, "", currencyId);
+		if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+			AskalLog.Debug("Purchase", "Preço calculado para " + itemClass + ": " + authoritativePrice);
 		if (authoritativePrice <= 0)
 		{
-			Print("[AskalPurchase] âŒ PreÃ§o autoritativo invÃ¡lido para " + itemClass + ": " + authoritativePrice);
+			AskalLog.Error("Purchase", "âŒ PreÃ§o autoritativo invÃ¡lido para " + itemClass + ": " + authoritativePrice);
 			return false;
 		}
 		if (price != authoritativePrice)
 		{
-			Print("[AskalPurchase] âš ï¸ Ajustando preÃ§o informado pelo cliente. Recebido: " + price + " | Autoritativo: " + authoritativePrice);
+			AskalLog.Warn("Purchase", "âš ï¸ Ajustando preÃ§o informado pelo cliente. Recebido: " + price + " | Autoritativo: " + authoritativePrice);
 			price = authoritativePrice;
 		}
 
 		// Verificar balance
 		int currentBalance = playerData.Balance.Get(balanceKey);
-		Print("[AskalPurchase] [DEBUG] Balance atual: " + currentBalance + " (" + balanceKey + ") | Preço necessário: " + price);
+		if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+			AskalLog.Debug("Purchase", "Balance atual: " + currentBalance + " (" + balanceKey + ") | Preço necessário: " + price);
 		if (currentBalance < price)
 		{
-			Print("[AskalPurchase] âŒ Balance insuficiente: " + currentBalance + " < " + price);
+			AskalLog.Error("Purchase", "âŒ Balance insuficiente: " + currentBalance + " < " + price);
 			return false;
 		}
 		
@@ -71,7 +73,7 @@ class AskalPurchaseService
 		EntityAI createdItem = player.GetInventory().CreateInInventory(itemClass);
 		if (!createdItem)
 		{
-			Print("[AskalPurchase] âŒ NÃ£o foi possÃ­vel criar item (sem espaÃ§o no inventÃ¡rio): " + itemClass);
+			AskalLog.Error("Purchase", "âŒ NÃ£o foi possÃ­vel criar item (sem espaÃ§o no inventÃ¡rio): " + itemClass);
 			return false;
 		}
 
@@ -80,16 +82,19 @@ class AskalPurchaseService
 		// Remover balance
 		if (!AskalPlayerBalance.RemoveBalance(steamId, price, balanceKey))
 		{
-			Print("[AskalPurchase] âŒ Erro ao remover balance");
+			AskalLog.Error("Purchase", "âŒ Erro ao remover balance");
 			// Rollback: deletar item criado
 			GetGame().ObjectDelete(createdItem);
 			return false;
 		}
 		
 		int newBalance = AskalPlayerBalance.GetBalance(steamId, balanceKey);
-	Print("[AskalPurchase] âœ… Compra realizada com sucesso!");
-	Print("[AskalPurchase]   Item criado: " + itemClass);
-	Print("[AskalPurchase]   Balance atualizado: " + newBalance);
+	AskalLog.Info("Purchase", "âœ… Compra realizada com sucesso!");
+	if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+	{
+		AskalLog.Debug("Purchase", "  Item criado: " + itemClass);
+		AskalLog.Debug("Purchase", "  Balance atualizado: " + newBalance);
+	}
 	
 	// Obter display name do item para notificação
 	string itemDisplayName = GetItemDisplayName(itemClass);
@@ -105,24 +110,51 @@ class AskalPurchaseService
 	// Se errorMessage for fornecido, será preenchido com mensagem de erro
 	static bool ProcessPurchaseWithQuantity(PlayerIdentity identity, string steamId, string itemClass, int price, string currencyId, float itemQuantity, int quantityType, int contentType, string traderName = "", array<string> errorMessage = NULL)
 	{
-		if (!identity)
-		{
-			Print("[AskalPurchase] âŒ Player identity nÃ£o encontrada");
-			return false;
-		}
-
-		if (!steamId || steamId == "")
+		// Compras do simulador de carga vão para sim.* (fora das métricas de produção)
+		string metricPrefix = "purchase";
+		bool simulated = !identity && AskalTradeSpawnLayer.IsSimulatedSteamId(steamId);
+		if (simulated)
+			metricPrefix = "sim.purchase";
+		
+		int startTicks = TickCount(0);
+		bool success = ProcessPurchaseWithQuantityInternal(identity, steamId, itemClass, price, currencyId, itemQuantity, quantityType, contentType, traderName, errorMessage);
+		float elapsedMs = AskalMetrics.ObserveTicks(metricPrefix + ".process_ms", startTicks);
+		if (!simulated)
+			AskalMetrics.RecordTransaction("purchase", itemClass + " @ " + traderName, elapsedMs);
+		if (success)
+			AskalMetrics.Increment(metricPrefix + ".success");
+		else
+			AskalMetrics.Increment(metricPrefix + ".failure");
+		return success;
+	}
+	
+	protected static bool ProcessPurchaseWithQuantityInternal(PlayerIdentity identity, string steamId, string itemClass, int price, string currencyId, float itemQuantity, int quantityType, int contentType, string traderName, array<string> errorMessage)
+	{
+		if ((!steamId || steamId == "") && identity)
 		{
 			steamId = identity.GetPlainId();
 			if (!steamId || steamId == "")
 				steamId = identity.GetId();
 		}
+		if (!steamId || steamId == "")
+		{
+			AskalLog.Error("Purchase", "❌ SteamId não resolvido");
+			return false;
+		}
+		
+		// Camada de spawn: inventário real, ou stub do simulador (só SteamIDs sintéticos sem identity)
+		AskalTradeSpawnLayer spawnLayer = AskalTradeSpawnLayer.Resolve(identity, steamId);
+		if (!identity && spawnLayer.RequiresPlayer())
+		{
+			AskalLog.Error("Purchase", "âŒ Player identity nÃ£o encontrada");
+			return false;
+		}
 		
 		// Obter player
 		PlayerBase player = GetPlayerFromIdentity(identity);
-		if (!player)
+		if (!player && spawnLayer.RequiresPlayer())
 		{
-			Print("[AskalPurchase] âŒ Player nÃ£o encontrado");
+			AskalLog.Error("Purchase", "âŒ Player nÃ£o encontrado");
 			return false;
 		}
 		
@@ -130,7 +162,7 @@ class AskalPurchaseService
 		string balanceKey = AskalPlayerBalance.ResolveBalanceKey(currencyId);
 		if (!balanceKey || balanceKey == "")
 		{
-			Print("[AskalPurchase] ❌ Failed to resolve balance key for currency: " + currencyId);
+			AskalLog.Error("Purchase", "❌ Failed to resolve balance key for currency: " + currencyId);
 			return false;
 		}
 		
@@ -138,31 +170,33 @@ class AskalPurchaseService
 		AskalPlayerData playerData = AskalPlayerBalance.LoadPlayerData(steamId);
 		if (!playerData || !playerData.Balance || !playerData.Balance.Contains(balanceKey))
 		{
-			Print("[AskalPurchase] ❌ Player balance missing currency key: " + balanceKey + " (currencyId: " + currencyId + ")");
+			AskalLog.Error("Purchase", "❌ Player balance missing currency key: " + balanceKey + " (currencyId: " + currencyId + ")");
 			return false;
 		}
 
 		// Calcular preço autoritativo (sempre unitário, pois o cliente envia múltiplas requisições para múltiplos itens)
-		int authoritativePrice = ComputeItemTotalPrice(itemClass);
-		Print("[AskalPurchase] [DEBUG] Preço calculado para " + itemClass + ": " + authoritativePrice);
+		int authoritativePrice = ComputeItemTotalPrice(itemClass, traderName, currencyId);
+		if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+			AskalLog.Debug("Purchase", "Preço calculado para " + itemClass + ": " + authoritativePrice);
 		if (authoritativePrice <= 0)
 		{
-			Print("[AskalPurchase] ❌ Preço autoritativo inválido para " + itemClass + ": " + authoritativePrice);
+			AskalLog.Error("Purchase", "❌ Preço autoritativo inválido para " + itemClass + ": " + authoritativePrice);
 			return false;
 		}
 		
 		if (price != authoritativePrice)
 		{
-			Print("[AskalPurchase] ⚠️ Ajustando preço informado pelo cliente. Recebido: " + price + " | Autoritativo: " + authoritativePrice);
+			AskalLog.Warn("Purchase", "⚠️ Ajustando preço informado pelo cliente. Recebido: " + price + " | Autoritativo: " + authoritativePrice);
 			price = authoritativePrice;
 		}
 
 		// Verificar balance
 		int currentBalance = playerData.Balance.Get(balanceKey);
-		Print("[AskalPurchase] [DEBUG] Balance atual: " + currentBalance + " (" + balanceKey + ") | Preço necessário: " + price);
+		if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+			AskalLog.Debug("Purchase", "Balance atual: " + currentBalance + " (" + balanceKey + ") | Preço necessário: " + price);
 		if (currentBalance < price)
 		{
-			Print("[AskalPurchase] ❌ Balance insuficiente: " + currentBalance + " < " + price);
+			AskalLog.Error("Purchase", "❌ Balance insuficiente: " + currentBalance + " < " + price);
 			return false;
 		}
 		
@@ -172,12 +206,13 @@ class AskalPurchaseService
 		if (isVehicle)
 		{
 			// Processar spawn de veículo
-			Print("[AskalPurchase] 🚗 Detectado veículo: " + itemClass + " - usando sistema de spawn");
+			if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+				AskalLog.Debug("Purchase", "🚗 Detectado veículo: " + itemClass + " - usando sistema de spawn");
 			
 			// Remover balance ANTES de spawnar (atomicidade)
 			if (!AskalPlayerBalance.RemoveBalance(steamId, price, balanceKey))
 			{
-				Print("[AskalPurchase] ❌ Erro ao remover balance para veículo");
+				AskalLog.Error("Purchase", "❌ Erro ao remover balance para veículo");
 				return false;
 			}
 			
@@ -188,7 +223,7 @@ class AskalPurchaseService
 			if (!spawnSuccess)
 			{
 				// Rollback: reembolsar balance
-				Print("[AskalPurchase] ❌ Falha ao spawnar veículo - reembolsando balance");
+				AskalLog.Error("Purchase", "❌ Falha ao spawnar veículo - reembolsando balance");
 				AskalPlayerBalance.AddBalance(steamId, price, balanceKey);
 				
 				// Passar mensagem de erro para o caller
@@ -196,30 +231,34 @@ class AskalPurchaseService
 				{
 					errorMessage.Clear();
 					errorMessage.Insert(vehicleErrorMessage.Get(0));
-					Print("[AskalPurchase] 💬 Mensagem de erro do veículo: " + vehicleErrorMessage.Get(0));
+					if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+						AskalLog.Debug("Purchase", "💬 Mensagem de erro do veículo: " + vehicleErrorMessage.Get(0));
 				}
 				return false;
 			}
 			
 			// Sucesso - veículo spawnado e balance removido
 			int vehicleBalance = AskalPlayerBalance.GetBalance(steamId, balanceKey);
-			Print("[AskalPurchase] ✅ Veículo spawnado com sucesso!");
-			Print("[AskalPurchase]   Veículo: " + itemClass);
-			Print("[AskalPurchase]   Balance atualizado: " + vehicleBalance);
+			AskalLog.Info("Purchase", "✅ Veículo spawnado com sucesso!");
+			if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+			{
+				AskalLog.Debug("Purchase", "  Veículo: " + itemClass);
+				AskalLog.Debug("Purchase", "  Balance atualizado: " + vehicleBalance);
+			}
 			
 			// Notificar cliente
 			string vehicleDisplayName = GetItemDisplayName(itemClass);
-			AskalNotificationHelper.AddPurchaseNotification(itemClass, price, vehicleDisplayName);
+			AskalNotificationHelper.AddPurchaseNotification(itemClass, price, vehicleDisplayName, steamId);
 			
 			return true;
 		}
 		else
 		{
 			// Item normal - criar no inventário (sempre um item por requisição)
-			EntityAI createdItem = player.GetInventory().CreateInInventory(itemClass);
-			if (!createdItem)
+			EntityAI createdItem;
+			if (!spawnLayer.CreateInInventory(player, itemClass, createdItem))
 			{
-				Print("[AskalPurchase] ❌ Não foi possível criar item (sem espaço no inventário): " + itemClass);
+				AskalLog.Error("Purchase", "❌ Não foi possível criar item (sem espaço no inventário): " + itemClass);
 				return false;
 			}
 			
@@ -232,23 +271,26 @@ class AskalPurchaseService
 			// Remover balance
 			if (!AskalPlayerBalance.RemoveBalance(steamId, price, balanceKey))
 			{
-				Print("[AskalPurchase] ❌ Erro ao remover balance - removendo item criado...");
+				AskalLog.Error("Purchase", "❌ Erro ao remover balance - removendo item criado...");
 				// Rollback: deletar item criado
-				GetGame().ObjectDelete(createdItem);
+				spawnLayer.DeleteEntity(createdItem);
 				return false;
 			}
 			
 			// Sucesso - item criado e balance removido
 			int newBalance = AskalPlayerBalance.GetBalance(steamId, balanceKey);
-			Print("[AskalPurchase] ✅ Compra realizada com sucesso!");
-			Print("[AskalPurchase]   Item: " + itemClass + " | Qty: " + itemQuantity + " | QtyType: " + quantityType + " | Content: " + contentType);
-			Print("[AskalPurchase]   Balance atualizado: " + newBalance);
+			AskalLog.Info("Purchase", "✅ Compra realizada com sucesso!");
+			if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+			{
+				AskalLog.Debug("Purchase", "  Item: " + itemClass + " | Qty: " + itemQuantity + " | QtyType: " + quantityType + " | Content: " + contentType);
+				AskalLog.Debug("Purchase", "  Balance atualizado: " + newBalance);
+			}
 			
 			// Obter display name do item para notificação
 			string itemDisplayName = GetItemDisplayName(itemClass);
 			
 			// Notificar cliente (cada compra gera sua própria notificação)
-			AskalNotificationHelper.AddPurchaseNotification(itemClass, price, itemDisplayName);
+			AskalNotificationHelper.AddPurchaseNotification(itemClass, price, itemDisplayName, steamId);
 			
 			return true;
 		}
@@ -261,7 +303,7 @@ class AskalPurchaseService
 	{
 		if (!player || !vehicleClass || vehicleClass == "")
 		{
-			Print("[AskalPurchase] ❌ Parâmetros inválidos para ProcessVehiclePurchase");
+			AskalLog.Error("Purchase", "❌ Parâmetros inválidos para ProcessVehiclePurchase");
 			if (errorMessage)
 			{
 				errorMessage.Clear();
@@ -272,7 +314,7 @@ class AskalPurchaseService
 		
 		if (!GetGame().IsServer())
 		{
-			Print("[AskalPurchase] ❌ ProcessVehiclePurchase só pode ser chamado no servidor");
+			AskalLog.Error("Purchase", "❌ ProcessVehiclePurchase só pode ser chamado no servidor");
 			if (errorMessage)
 			{
 				errorMessage.Clear();
@@ -281,12 +323,14 @@ class AskalPurchaseService
 			return false;
 		}
 		
-		Print("[AskalPurchase] 🚗 Processando compra de veículo: " + vehicleClass);
+		if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+			AskalLog.Debug("Purchase", "🚗 Processando compra de veículo: " + vehicleClass);
 		
 		// Verificar tipo de veículo ANTES de qualquer processamento (usado em múltiplos blocos)
 		bool isLandVehicle = AskalVehicleSpawn.IsLandVehicle(vehicleClass);
 		bool isWaterVehicle = AskalVehicleSpawn.IsWaterVehicle(vehicleClass);
-		Print("[AskalPurchase] 🚗 Tipo de veículo: " + vehicleClass + " | Terrestre: " + isLandVehicle + " | Aquático: " + isWaterVehicle);
+		if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+			AskalLog.Debug("Purchase", "🚗 Tipo de veículo: " + vehicleClass + " | Terrestre: " + isLandVehicle + " | Aquático: " + isWaterVehicle);
 		
 		// Verificar se é Virtual Store (traderName vazio ou "Trader_Default")
 		bool isVirtualStore = (!traderName || traderName == "" || traderName == "Trader_Default");
@@ -304,7 +348,7 @@ class AskalPurchaseService
 		if (traderConfig && traderConfig.VehicleSpawnPoints)
 		{
 			// Trader tem pontos configurados - usar primeiro ponto válido baseado no tipo de veículo
-			Print("[AskalPurchase] 🎯 Trader tem pontos de spawn configurados, tentando usar...");
+			AskalLog.Debug("Purchase", "🎯 Trader tem pontos de spawn configurados, tentando usar...");
 			
 			vector traderClearanceBox = AskalVehicleSpawn.GetDefaultClearanceBox();
 			bool foundValidPoint = false;
@@ -312,7 +356,7 @@ class AskalPurchaseService
 			// Se for veículo terrestre, usar APENAS pontos Land
 			if (isLandVehicle && traderConfig.VehicleSpawnPoints.Land && traderConfig.VehicleSpawnPoints.Land.Count() > 0)
 			{
-				Print("[AskalPurchase] 🏔️ Veículo terrestre detectado - buscando pontos Land...");
+				AskalLog.Debug("Purchase", "🏔️ Veículo terrestre detectado - buscando pontos Land...");
 				for (int landIdx = 0; landIdx < traderConfig.VehicleSpawnPoints.Land.Count(); landIdx++)
 				{
 					AskalVehicleSpawnPoint landSpawnPoint = traderConfig.VehicleSpawnPoints.Land.Get(landIdx);
@@ -332,19 +376,20 @@ class AskalPurchaseService
 						if (spawnRot == vector.Zero)
 							spawnRot = "0 0 0";
 						foundValidPoint = true;
-						Print("[AskalPurchase] ✅ Ponto de spawn terrestre válido encontrado: " + spawnPos);
+						if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+							AskalLog.Debug("Purchase", "✅ Ponto de spawn terrestre válido encontrado: " + spawnPos);
 						break;
 					}
 					else
 					{
-						Print("[AskalPurchase] ⚠️ Ponto terrestre " + landIdx + " ocupado: " + landCandidatePos);
+						AskalLog.Warn("Purchase", "⚠️ Ponto terrestre " + landIdx + " ocupado: " + landCandidatePos);
 					}
 				}
 			}
 			// Se for veículo aquático, usar APENAS pontos Water
 			else if (isWaterVehicle && traderConfig.VehicleSpawnPoints.Water && traderConfig.VehicleSpawnPoints.Water.Count() > 0)
 			{
-				Print("[AskalPurchase] 🌊 Veículo aquático detectado - buscando pontos Water...");
+				AskalLog.Debug("Purchase", "🌊 Veículo aquático detectado - buscando pontos Water...");
 				for (int waterIdx = 0; waterIdx < traderConfig.VehicleSpawnPoints.Water.Count(); waterIdx++)
 				{
 					AskalVehicleSpawnPoint waterSpawnPoint = traderConfig.VehicleSpawnPoints.Water.Get(waterIdx);
@@ -364,19 +409,20 @@ class AskalPurchaseService
 						if (spawnRot == vector.Zero)
 							spawnRot = "0 0 0";
 						foundValidPoint = true;
-						Print("[AskalPurchase] ✅ Ponto de spawn aquático válido encontrado: " + spawnPos);
+						if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+							AskalLog.Debug("Purchase", "✅ Ponto de spawn aquático válido encontrado: " + spawnPos);
 						break;
 					}
 					else
 					{
-						Print("[AskalPurchase] ⚠️ Ponto aquático " + waterIdx + " ocupado: " + waterCandidatePos);
+						AskalLog.Warn("Purchase", "⚠️ Ponto aquático " + waterIdx + " ocupado: " + waterCandidatePos);
 					}
 				}
 			}
 			// Se tipo não identificado, tentar ambos (fallback)
 			else if (!isLandVehicle && !isWaterVehicle)
 			{
-				Print("[AskalPurchase] ⚠️ Tipo de veículo não identificado, tentando pontos Land primeiro...");
+				AskalLog.Warn("Purchase", "⚠️ Tipo de veículo não identificado, tentando pontos Land primeiro...");
 				// Tentar pontos terrestres primeiro
 				if (traderConfig.VehicleSpawnPoints.Land && traderConfig.VehicleSpawnPoints.Land.Count() > 0)
 				{
@@ -399,7 +445,8 @@ class AskalPurchaseService
 							if (spawnRot == vector.Zero)
 								spawnRot = "0 0 0";
 							foundValidPoint = true;
-							Print("[AskalPurchase] ✅ Ponto de spawn terrestre válido encontrado (fallback): " + spawnPos);
+							if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+								AskalLog.Debug("Purchase", "✅ Ponto de spawn terrestre válido encontrado (fallback): " + spawnPos);
 							break;
 						}
 					}
@@ -427,7 +474,8 @@ class AskalPurchaseService
 							if (spawnRot == vector.Zero)
 								spawnRot = "0 0 0";
 							foundValidPoint = true;
-							Print("[AskalPurchase] ✅ Ponto de spawn aquático válido encontrado (fallback): " + spawnPos);
+							if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+								AskalLog.Debug("Purchase", "✅ Ponto de spawn aquático válido encontrado (fallback): " + spawnPos);
 							break;
 						}
 					}
@@ -436,14 +484,14 @@ class AskalPurchaseService
 			
 			if (!foundValidPoint)
 			{
-				Print("[AskalPurchase] ⚠️ Nenhum ponto de spawn válido encontrado no trader para o tipo de veículo, usando fallback");
+				AskalLog.Warn("Purchase", "⚠️ Nenhum ponto de spawn válido encontrado no trader para o tipo de veículo, usando fallback");
 			}
 		}
 		
 		// Virtual Store: spawn 3m na frente do player
 		if (isVirtualStore)
 		{
-			Print("[AskalPurchase] 🏪 Virtual Store detectado - calculando spawn 3m na frente do player");
+			AskalLog.Debug("Purchase", "🏪 Virtual Store detectado - calculando spawn 3m na frente do player");
 			
 			vector playerPos = player.GetPosition();
 			vector playerDir = player.GetDirection();
@@ -456,7 +504,7 @@ class AskalPurchaseService
 			
 			if (spawnPos == vector.Zero)
 			{
-				Print("[AskalPurchase] ❌ Falha ao projetar posição no chão");
+				AskalLog.Error("Purchase", "❌ Falha ao projetar posição no chão");
 				if (errorMessage)
 				{
 					errorMessage.Clear();
@@ -469,7 +517,7 @@ class AskalPurchaseService
 			vector clearanceBox = AskalVehicleSpawn.GetDefaultClearanceBox();
 			if (!AskalVehicleSpawn.IsAreaClear(spawnPos, clearanceBox))
 			{
-				Print("[AskalPurchase] ❌ Área obstruída em " + spawnPos);
+				AskalLog.Error("Purchase", "❌ Área obstruída em " + spawnPos);
 				if (errorMessage)
 				{
 					errorMessage.Clear();
@@ -483,7 +531,7 @@ class AskalPurchaseService
 			
 			if (isLandVehicle && isWater)
 			{
-				Print("[AskalPurchase] ❌ Veículo terrestre não pode spawnar em água");
+				AskalLog.Error("Purchase", "❌ Veículo terrestre não pode spawnar em água");
 				if (errorMessage)
 				{
 					errorMessage.Clear();
@@ -494,7 +542,7 @@ class AskalPurchaseService
 			
 			if (isWaterVehicle && !isWater)
 			{
-				Print("[AskalPurchase] ❌ Veículo aquático não pode spawnar em terra");
+				AskalLog.Error("Purchase", "❌ Veículo aquático não pode spawnar em terra");
 				if (errorMessage)
 				{
 					errorMessage.Clear();
@@ -508,12 +556,13 @@ class AskalPurchaseService
 			if (spawnRot == vector.Zero)
 				spawnRot = "0 0 0";
 			
-			Print("[AskalPurchase] ✅ Posição Virtual Store válida: " + spawnPos + " (água: " + isWater + ")");
+			if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+				AskalLog.Debug("Purchase", "✅ Posição Virtual Store válida: " + spawnPos + " (água: " + isWater + ")");
 		}
 		// Trader estático: usar pontos configurados ou buscar perto do player
 		else if (spawnPos == vector.Zero)
 		{
-			Print("[AskalPurchase] 🔍 Buscando posição válida perto do player...");
+			AskalLog.Debug("Purchase", "🔍 Buscando posição válida perto do player...");
 			vector traderPlayerPos = player.GetPosition();
 			spawnPos = AskalVehicleSpawn.FindValidSpawnPositionNearPosition(traderPlayerPos, AskalVehicleSpawn.GetDefaultRadius(), AskalVehicleSpawn.GetDefaultAttempts(), AskalVehicleSpawn.GetDefaultMaxInclination(), AskalVehicleSpawn.GetDefaultClearanceBox());
 			
@@ -535,9 +584,9 @@ class AskalPurchaseService
 		// Fallback: tentar usar pontos de outros traders (apenas para traders estáticos)
 		if (spawnPos == vector.Zero && !isVirtualStore)
 		{
-			Print("[AskalPurchase] ⚠️ Nenhuma posição válida encontrada, tentando fallback...");
+			AskalLog.Warn("Purchase", "⚠️ Nenhuma posição válida encontrada, tentando fallback...");
 			// TODO: Implementar fallback para pontos de outros traders ou ponto global configurável
-			Print("[AskalPurchase] ❌ Fallback não implementado - spawn de veículo falhou");
+			AskalLog.Error("Purchase", "❌ Fallback não implementado - spawn de veículo falhou");
 			if (errorMessage)
 			{
 				errorMessage.Clear();
@@ -549,7 +598,7 @@ class AskalPurchaseService
 		// Virtual Store: se ainda não tem posição, falhar
 		if (spawnPos == vector.Zero && isVirtualStore)
 		{
-			Print("[AskalPurchase] ❌ Virtual Store: não foi possível calcular posição de spawn");
+			AskalLog.Error("Purchase", "❌ Virtual Store: não foi possível calcular posição de spawn");
 			if (errorMessage)
 			{
 				errorMessage.Clear();
@@ -571,26 +620,26 @@ class AskalPurchaseService
 		
 		if (spawnedVehicle)
 		{
-			Print("[AskalPurchase] ✅ Veículo spawnado com sucesso em " + spawnPos);
+			AskalLog.Info("Purchase", "✅ Veículo spawnado com sucesso em " + spawnPos);
 			
 			// Aplicar attachments padrão ao veículo
 			EntityAI vehicleEntity = EntityAI.Cast(spawnedVehicle);
 			if (vehicleEntity)
 			{
-				Print("[AskalPurchase] 🔧 Aplicando attachments ao veículo...");
+				AskalLog.Debug("Purchase", "🔧 Aplicando attachments ao veículo...");
 				AttachDefaultAttachments(vehicleEntity, vehicleClass);
-				Print("[AskalPurchase] ✅ Attachments aplicados ao veículo");
+				AskalLog.Debug("Purchase", "✅ Attachments aplicados ao veículo");
 			}
 			else
 			{
-				Print("[AskalPurchase] ⚠️ Veículo spawnado mas não é EntityAI - não é possível aplicar attachments");
+				AskalLog.Warn("Purchase", "⚠️ Veículo spawnado mas não é EntityAI - não é possível aplicar attachments");
 			}
 			
 			return true;
 		}
 		else
 		{
-			Print("[AskalPurchase] ❌ Falha ao spawnar veículo em " + spawnPos);
+			AskalLog.Error("Purchase", "❌ Falha ao spawnar veículo em " + spawnPos);
 			if (errorMessage)
 			{
 				errorMessage.Clear();
@@ -620,7 +669,8 @@ class AskalPurchaseService
 				{
 					int ammoCount = Math.Round(quantity);
 					mag.ServerSetAmmoCount(ammoCount);
-					Print("[AskalPurchase] ðŸ”« Magazine preenchido com " + ammoCount + " balas");
+					if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+						AskalLog.Debug("Purchase", "ðŸ”« Magazine preenchido com " + ammoCount + " balas");
 				}
 				break;
 			}
@@ -630,7 +680,8 @@ class AskalPurchaseService
 				if (item.HasQuantity())
 				{
 					item.SetQuantity(quantity);
-					Print("[AskalPurchase] ðŸ“¦ Stackable quantity setada: " + quantity);
+					if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+						AskalLog.Debug("Purchase", "ðŸ“¦ Stackable quantity setada: " + quantity);
 				}
 				break;
 			}
@@ -648,13 +699,15 @@ class AskalPurchaseService
 					float liquidAmount = maxCapacity * percentDecimal;
 					item.SetQuantity(liquidAmount);
 					
-					Print("[AskalPurchase] ðŸ’§ LÃ­quido aplicado - Type: " + contentType + " | Amount: " + liquidAmount + " mL (" + quantity + "%)");
+					if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+						AskalLog.Debug("Purchase", "ðŸ’§ LÃ­quido aplicado - Type: " + contentType + " | Amount: " + liquidAmount + " mL (" + quantity + "%)");
 				}
 				else if (item.HasQuantity())
 				{
 					// Outros quantifiables sem lÃ­quido
 					item.SetQuantity(quantity);
-					Print("[AskalPurchase] ðŸ“Š Quantity setada: " + quantity);
+					if (AskalLog.IsEnabled("Purchase", AskalLog.DEBUG))
+						AskalLog.Debug("Purchase", "ðŸ“Š Quantity setada: " + quantity);
 				}
 				break;
 			}
@@ -685,47 +738,14 @@ class AskalPurchaseService
 		return NULL;
 	}
 
-	protected static int ComputeItemTotalPrice(string itemClass)
+	// Preço autoritativo: uma consulta ao livro de preços da loja/moeda (público para o AskalMicroBenchmark)
+	static int ComputeItemTotalPrice(string itemClass, string traderName, string currencyId)
 	{
-		ItemData itemData = AskalDatabase.GetItem(itemClass);
-		if (!itemData)
+		AskalPriceBook priceBook = AskalPriceBook.Get(traderName, currencyId);
+		if (!priceBook)
 			return -1;
 
-		int totalPrice = NormalizeBuyPrice(itemData.Price);
-		array<string> attachments = itemData.GetAttachments();
-		if (attachments)
-		{
-			for (int i = 0; i < attachments.Count(); i++)
-			{
-				string attachmentClass = attachments.Get(i);
-				if (!attachmentClass || attachmentClass == "")
-					continue;
-
-				ItemData attachmentData = AskalDatabase.GetItem(attachmentClass);
-				if (attachmentData)
-					totalPrice += NormalizeBuyPrice(attachmentData.Price);
-			}
-		}
-
-		return ApplyBuyCoefficient(totalPrice);
-	}
-
-	protected static int NormalizeBuyPrice(int price)
-	{
-		if (price <= 0)
-			price = AskalMarketDefaults.DEFAULT_BUY_PRICE;
-		return price;
-	}
-
-	protected static int ApplyBuyCoefficient(int price)
-	{
-		price = NormalizeBuyPrice(price);
-		float coeff = AskalVirtualStoreSettings.GetBuyCoefficient();
-		float adjustedFloat = price * coeff;
-		int adjusted = Math.Round(adjustedFloat);
-		if (adjusted <= 0)
-			adjusted = 1;
-		return adjusted;
+		return priceBook.GetBuyPrice(itemClass);
 	}
 
     protected static void AttachDefaultAttachments(EntityAI itemEntity, string itemClass)
@@ -750,13 +770,40 @@ class AskalPurchaseService
             EntityAI attachmentEntity = EntityAI.Cast(itemEntity.GetInventory().CreateAttachment(attachmentClass));
             if (!attachmentEntity)
             {
-                Print("[AskalPurchase] âš ï¸ Falha ao anexar attachment padrÃ£o: " + attachmentClass);
+                AskalLog.Warn("Purchase", "âš ï¸ Falha ao anexar attachment padrÃ£o: " + attachmentClass);
             }
         }
     }
 	
+	protected static ref map<string, string> s_DisplayNames; // className -> displayName (config não muda em runtime)
+	
 	// Obter display name do item
 	static string GetItemDisplayName(string className)
+	{
+		if (!s_DisplayNames)
+			s_DisplayNames = new map<string, string>();
+		
+		string cachedName;
+		if (s_DisplayNames.Find(className, cachedName))
+		{
+			AskalMetrics.Increment("cache.display_name.hit");
+			return cachedName;
+		}
+		
+		AskalMetrics.Increment("cache.display_name.miss");
+		string displayName = LookupItemDisplayName(className);
+		s_DisplayNames.Set(className, displayName);
+		return displayName;
+	}
+	
+	static int GetDisplayNameCacheCount()
+	{
+		if (!s_DisplayNames)
+			return 0;
+		return s_DisplayNames.Count();
+	}
+	
+	protected static string LookupItemDisplayName(string className)
 	{
 		string displayName = "";
 		
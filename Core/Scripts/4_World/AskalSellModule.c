@@ -2,16 +2,34 @@
 // AskalSellModule - Módulo RPC para venda de itens (ULTRA SIMPLIFICADO)
 // ==========================================
 
+class AskalPendingQuote
+{
+	PlayerIdentity Identity;
+	string TraderName;
+	string CurrencyId;
+	
+	void AskalPendingQuote(PlayerIdentity identity, string traderName, string currencyId)
+	{
+		Identity = identity;
+		TraderName = traderName;
+		CurrencyId = currencyId;
+	}
+}
+
 class AskalSellModule
 {
 	protected static ref AskalSellModule s_Instance;
+	protected ref map<string, ref AskalPendingQuote> m_PendingQuotes; // identityId -> pedido (coalescidos)
 	
 	void AskalSellModule()
 	{
+		m_PendingQuotes = new map<string, ref AskalPendingQuote>();
+		
 		if (GetGame().IsServer())
 		{
 			GetRPCManager().AddRPC("AskalSellModule", "SellItemRequest", this, SingleplayerExecutionType.Server);
-			GetRPCManager().AddRPC("AskalCoreModule", "RequestInventoryHealth", this, SingleplayerExecutionType.Server);
+			GetRPCManager().AddRPC("AskalSellModule", "SellBatchRequest", this, SingleplayerExecutionType.Server);
+			GetRPCManager().AddRPC("AskalSellModule", "QuoteInventory", this, SingleplayerExecutionType.Server);
 		}
 	}
 	
@@ -24,268 +42,386 @@ class AskalSellModule
 		return s_Instance;
 	}
 	
+	int GetPendingQuoteCount()
+	{
+		return m_PendingQuotes.Count();
+	}
+	
 	// RPC Handler: Servidor processa requisição de venda
 	void SellItemRequest(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
 	{
-		Print("[AskalSell] [RPC] SellItemRequest recebido");
-		
 		if (type != CallType.Server || !sender)
 		{
-			Print("[AskalSell] [ERRO] Tipo invalido ou sender NULL");
+			AskalLog.Error("Sell", "SellItemRequest: tipo invalido ou sender NULL");
 			SendSellResponse(sender, false, "Erro na requisição", "", 0);
 			return;
 		}
 		
-		// Param5: steamId, itemClassName, currencyId, transactionMode, traderOrVirtualStoreID
-		Param5<string, string, string, int, string> data;
+		// Param7: steamId, itemClassName, currencyId, transactionMode, traderOrVirtualStoreID, networkIdLow, networkIdHigh
+		Param7<string, string, string, int, string, int, int> data;
 		if (!ctx.Read(data))
 		{
-			Print("[AskalSell] [ERRO] Falha ao ler parametros do RPC");
+			AskalLog.Error("Sell", "Falha ao ler parametros do SellItemRequest");
 			SendSellResponse(sender, false, "Erro ao ler parâmetros", "", 0);
 			return;
 		}
 		
-		string steamId = data.param1;
+		// Boot escalonado: preço de venda depende do catálogo e do livro de preços
+		if (!AskalServerReadiness.IsStageDone(AskalServerReadiness.STAGE_INDEX))
+		{
+			Param2<PlayerIdentity, ref Param7<string, string, string, int, string, int, int>> heldSell = new Param2<PlayerIdentity, ref Param7<string, string, string, int, string, int, int>>(sender, data);
+			if (!AskalServerReadiness.Hold(AskalServerReadiness.STAGE_INDEX, this, "HandleSellItem", heldSell))
+				SendSellResponse(sender, false, "Servidor iniciando, tente novamente", data.param2, 0);
+			return;
+		}
+		
+		HandleSellItem(sender, data);
+	}
+	
+	// Venda com parâmetros já lidos (direto ou liberada pelo AskalServerReadiness)
+	void HandleSellItem(PlayerIdentity sender, Param7<string, string, string, int, string, int, int> data)
+	{
+		if (!sender || !data)
+			return;
+		
+		if (!AskalRequestLimiter.TryAcquire(sender, AskalRequestLimiter.KIND_SELL))
+		{
+			SendSellResponse(sender, false, "Muitas requisições, aguarde um instante", data.param2, 0);
+			return;
+		}
+		
 		string itemClassName = data.param2;
-		string currencyId = data.param3;
-		int transactionMode = data.param4;
 		string traderName = data.param5; // traderOrVirtualStoreID
+		if (AskalLog.IsEnabled("Sell", AskalLog.DEBUG))
+			AskalLog.Debug("Sell", "[RPC] Item: " + itemClassName + " | Currency: " + data.param3 + " | Mode: " + data.param4 + " | Trader: " + traderName);
 		
-		Print("[AskalSell] [RPC] Item: " + itemClassName + " | Currency: " + currencyId + " | Mode: " + transactionMode + " | Trader: " + traderName);
+		string steamId = ResolveSteamId(data.param1, sender);
+		string currencyId = ResolveSellCurrency(traderName, data.param3);
 		
-		if (!steamId || steamId == "")
+		PlayerBase player = AskalSellService.GetPlayerFromIdentity(sender);
+		if (!player)
 		{
-			steamId = sender.GetPlainId();
-			if (!steamId || steamId == "")
-				steamId = sender.GetId();
+			AskalLog.Error("Sell", "Player nao encontrado: " + sender.GetName());
+			SendSellResponse(sender, false, "Player não encontrado", itemClassName, 0);
+			return;
 		}
 		
-		// Resolve accepted currency for trader or virtual store
-		AskalCurrencyConfig resolvedCurrencyCfg = NULL;
-		string resolvedCurrencyId = "";
-		if (!AskalMarketConfig.ResolveAcceptedCurrency(traderName, currencyId, resolvedCurrencyId, resolvedCurrencyCfg))
+		SellEntity(sender, steamId, player, data.param6, data.param7, itemClassName, currencyId, data.param4, traderName);
+	}
+	
+	// RPC Handler: venda em lote (uma ação do jogador, um custo de lote no rate limit)
+	// Param6: steamId, currencyId, transactionMode, traderOrVirtualStoreID, classNames, networkIds (low/high por item)
+	void SellBatchRequest(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
+	{
+		if (type != CallType.Server || !sender)
+			return;
+		
+		Param6<string, string, int, string, ref array<string>, ref array<int>> data;
+		if (!ctx.Read(data))
 		{
-			// Fallback to default
-			AskalMarketConfig marketConfig = AskalMarketConfig.GetInstance();
-			if (marketConfig)
-				resolvedCurrencyId = marketConfig.GetDefaultCurrencyId();
-			if (!resolvedCurrencyId || resolvedCurrencyId == "")
-				resolvedCurrencyId = "Askal_Money";
-			Print("[AskalSell] ⚠️ Using default currency: " + resolvedCurrencyId);
+			AskalLog.Error("Sell", "Falha ao ler parametros do SellBatchRequest");
+			SendSellResponse(sender, false, "Erro ao ler parâmetros", "", 0);
+			return;
 		}
-		else
+		
+		if (!AskalServerReadiness.IsStageDone(AskalServerReadiness.STAGE_INDEX))
 		{
-			Print("[AskalSell] 💰 Resolved currency: " + resolvedCurrencyId + " (trader: " + traderName + ")");
+			Param2<PlayerIdentity, ref Param6<string, string, int, string, ref array<string>, ref array<int>>> heldBatch = new Param2<PlayerIdentity, ref Param6<string, string, int, string, ref array<string>, ref array<int>>>(sender, data);
+			if (!AskalServerReadiness.Hold(AskalServerReadiness.STAGE_INDEX, this, "HandleSellBatch", heldBatch))
+				SendSellResponse(sender, false, "Servidor iniciando, tente novamente", "", 0);
+			return;
 		}
-		currencyId = resolvedCurrencyId;
 		
-		// VALIDAÇÃO: Verificar se item pode ser vendido neste trader
-		if (traderName && traderName != "" && traderName != "Trader_Default")
+		HandleSellBatch(sender, data);
+	}
+	
+	void HandleSellBatch(PlayerIdentity sender, Param6<string, string, int, string, ref array<string>, ref array<int>> data)
+	{
+		if (!sender || !data)
+			return;
+		
+		array<string> classNames = data.param5;
+		array<int> networkIds = data.param6;
+		if (!classNames || !networkIds || classNames.Count() == 0 || networkIds.Count() != classNames.Count() * 2)
 		{
-			if (!AskalTraderValidationHelper.CanSellItem(traderName, itemClassName))
-			{
-				Print("[AskalSell] [ERRO] Item não pode ser vendido neste trader: " + itemClassName + " | Trader: " + traderName);
-				SendSellResponse(sender, false, "Item não pode ser vendido neste trader", itemClassName, 0);
-				return;
-			}
+			AskalLog.Warn("Sell", "⚠️ SellBatchRequest inválido de " + sender.GetName());
+			SendSellResponse(sender, false, "Erro ao ler parâmetros", "", 0);
+			return;
+		}
+		
+		if (!AskalRequestLimiter.TryAcquire(sender, AskalRequestLimiter.KIND_SELL, AskalRequestLimiter.GetBatchCost(classNames.Count())))
+		{
+			SendSellResponse(sender, false, "Muitas requisições, aguarde um instante", "", 0);
+			return;
 		}
 		
-		// Busca o player
-		Print("[AskalSell] [RPC] Buscando player...");
+		string traderName = data.param4;
+		string steamId = ResolveSteamId(data.param1, sender);
+		string currencyId = ResolveSellCurrency(traderName, data.param2);
+		
 		PlayerBase player = AskalSellService.GetPlayerFromIdentity(sender);
 		if (!player)
 		{
-			Print("[AskalSell] [ERRO] Player nao encontrado");
-			SendSellResponse(sender, false, "Player não encontrado", itemClassName, 0);
+			AskalLog.Error("Sell", "Player nao encontrado: " + sender.GetName());
+			SendSellResponse(sender, false, "Player não encontrado", "", 0);
 			return;
 		}
-		Print("[AskalSell] [RPC] Player encontrado: " + player.GetIdentity().GetName());
 		
-		// Busca item no inventário (case-insensitive)
-		Print("[AskalSell] [RPC] Buscando item no inventario: " + itemClassName);
-		EntityAI itemToSell = FindItemInInventory(player, itemClassName);
+		int soldCount = 0;
+		for (int i = 0; i < classNames.Count(); i++)
+		{
+			if (SellEntity(sender, steamId, player, networkIds[i * 2], networkIds[i * 2 + 1], classNames[i], currencyId, data.param3, traderName))
+				soldCount++;
+		}
+		
+		AskalLog.Info("Sell", "💼 Venda em lote de " + sender.GetName() + ": " + soldCount + "/" + classNames.Count() + " itens vendidos");
+	}
+	
+	// Vende a entidade cotada (network ID) do inventário do player e responde ao cliente
+	// A classe enviada serve só de conferência com a entidade resolvida
+	protected bool SellEntity(PlayerIdentity sender, string steamId, PlayerBase player, int networkIdLow, int networkIdHigh, string itemClassName, string currencyId, int transactionMode, string traderName)
+	{
+		// VALIDAÇÃO: Verificar se item pode ser vendido neste trader
+		if (traderName && traderName != "" && traderName != "Trader_Default")
+		{
+			if (!AskalTraderValidationHelper.CanSellItem(traderName, itemClassName))
+			{
+				AskalLog.Error("Sell", "Item não pode ser vendido neste trader: " + itemClassName + " | Trader: " + traderName);
+				SendSellResponse(sender, false, "Item não pode ser vendido neste trader", itemClassName, 0);
+				return false;
+			}
+		}
+		
+		EntityAI itemToSell = ResolveSellEntity(player, networkIdLow, networkIdHigh, itemClassName);
 		if (!itemToSell)
 		{
-			Print("[AskalSell] [ERRO] Item nao encontrado no inventario");
+			AskalLog.Error("Sell", "Item nao encontrado no inventario: " + itemClassName + " (" + networkIdLow + ":" + networkIdHigh + ")");
 			SendSellResponse(sender, false, "Item não encontrado no inventário: " + itemClassName, itemClassName, 0);
-			return;
+			return false;
 		}
-		Print("[AskalSell] [RPC] Item encontrado: " + itemToSell.GetType());
 		
 		// Verificar se item tem cargo ANTES de processar venda
 		if (AskalSellService.HasCargoItemsRecursive(itemToSell))
 		{
-			Print("[AskalSell] [ERRO] Item tem cargo - venda bloqueada");
+			AskalLog.Error("Sell", "Item tem cargo - venda bloqueada");
 			SendSellResponse(sender, false, "Item ocupado, esvazie para vender", itemClassName, 0);
-			return;
+			return false;
 		}
 		
-		// Processa venda
-		Print("[AskalSell] [RPC] Processando venda...");
 		int sellPrice = 0;
-		bool success = AskalSellService.ProcessSell(sender, steamId, itemToSell, currencyId, transactionMode, sellPrice);
-		
+		bool success = AskalSellService.ProcessSell(sender, steamId, itemToSell, currencyId, transactionMode, sellPrice, traderName);
 		if (success)
 		{
-			Print("[AskalSell] [RPC] Venda processada com sucesso - Preço: " + sellPrice);
 			SendSellResponse(sender, true, "Venda realizada com sucesso", itemClassName, sellPrice);
+			return true;
 		}
+		
+		AskalLog.Error("Sell", "Falha ao processar venda (ver ProcessSell): " + itemClassName);
+		// Verificar se foi por causa de cargo (pode ter sido detectado no ProcessSell também)
+		if (AskalSellService.HasCargoItemsRecursive(itemToSell))
+			SendSellResponse(sender, false, "Item ocupado, esvazie para vender", itemClassName, 0);
 		else
+			SendSellResponse(sender, false, "Falha ao processar venda", itemClassName, 0);
+		return false;
+	}
+	
+	protected string ResolveSteamId(string steamId, PlayerIdentity sender)
+	{
+		if (steamId && steamId != "")
+			return steamId;
+		
+		string resolvedId = sender.GetPlainId();
+		if (!resolvedId || resolvedId == "")
+			resolvedId = sender.GetId();
+		return resolvedId;
+	}
+	
+	// Moeda aceita pelo trader/loja virtual (ou a padrão do MarketConfig)
+	protected string ResolveSellCurrency(string traderName, string currencyId)
+	{
+		AskalCurrencyConfig resolvedCurrencyCfg = NULL;
+		string resolvedCurrencyId = "";
+		if (!AskalMarketConfig.ResolveAcceptedCurrency(traderName, currencyId, resolvedCurrencyId, resolvedCurrencyCfg))
 		{
-			Print("[AskalSell] [ERRO] Falha ao processar venda (ver ProcessSell)");
-			// Verificar se foi por causa de cargo (pode ter sido detectado no ProcessSell também)
-			if (AskalSellService.HasCargoItemsRecursive(itemToSell))
-			{
-				SendSellResponse(sender, false, "Item ocupado, esvazie para vender", itemClassName, 0);
-			}
-			else
-			{
-				SendSellResponse(sender, false, "Falha ao processar venda", itemClassName, 0);
-			}
+			// Fallback to default
+			AskalMarketConfig marketConfig = AskalMarketConfig.GetInstance();
+			if (marketConfig)
+				resolvedCurrencyId = marketConfig.GetDefaultCurrencyId();
+			if (!resolvedCurrencyId || resolvedCurrencyId == "")
+				resolvedCurrencyId = "Askal_Money";
+			AskalLog.Warn("Sell", "⚠️ Using default currency: " + resolvedCurrencyId);
 		}
+		else if (AskalLog.IsEnabled("Sell", AskalLog.DEBUG))
+		{
+			AskalLog.Debug("Sell", "💰 Resolved currency: " + resolvedCurrencyId + " (trader: " + traderName + ")");
+		}
+		return resolvedCurrencyId;
 	}
 	
-	// Busca item no inventário (case-insensitive, simplificado)
-	EntityAI FindItemInInventory(PlayerBase player, string itemClassName)
+	// RPC Handler: cotação de venda de todos os itens negociáveis do inventário
+	// Param2: traderOrVirtualStoreID, currencyId
+	void QuoteInventory(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
 	{
-		if (!player || !itemClassName || itemClassName == "")
-			return NULL;
-		
-		string searchLower = itemClassName;
-		searchLower.ToLower();
+		if (type != CallType.Server || !sender)
+			return;
 		
-		// 1. Verifica item nas mãos primeiro
-		EntityAI itemInHands = player.GetHumanInventory().GetEntityInHands();
-		if (itemInHands)
+		Param2<string, string> data;
+		if (!ctx.Read(data))
 		{
-			string handsType = itemInHands.GetType();
-			string handsLower = handsType;
-			handsLower.ToLower();
-			
-			if (handsLower == searchLower && CanRemove(itemInHands))
-				return itemInHands;
+			AskalLog.Error("Sell", "Falha ao ler QuoteInventory");
+			return;
 		}
 		
-		// 2. Enumera todo o inventário
-		array<EntityAI> items = new array<EntityAI>();
-		player.GetInventory().EnumerateInventory(InventoryTraversalType.PREORDER, items);
-		
-		foreach (EntityAI item : items)
+		if (!AskalServerReadiness.IsStageDone(AskalServerReadiness.STAGE_INDEX))
 		{
-			if (!item)
-				continue;
-			
-			string itemType = item.GetType();
-			string itemLower = itemType;
-			itemLower.ToLower();
-			
-			if (itemLower == searchLower && CanRemove(item))
-				return item;
+			AskalServerReadiness.Hold(AskalServerReadiness.STAGE_INDEX, this, "HandleQuoteInventory", new Param2<PlayerIdentity, ref Param2<string, string>>(sender, data));
+			return;
 		}
 		
-		return NULL;
+		HandleQuoteInventory(sender, data);
 	}
 	
-	// Verifica se item pode ser removido (simplificado)
-	bool CanRemove(EntityAI item)
+	void HandleQuoteInventory(PlayerIdentity sender, Param2<string, string> data)
 	{
-		if (!item || !item.GetInventory())
-			return false;
+		if (!sender || !data)
+			return;
 		
-		return item.GetInventory().CanRemoveEntity();
-	}
-	
-	// Enviar resposta de venda para o cliente
-	void SendSellResponse(PlayerIdentity identity, bool success, string message = "", string itemClass = "", int price = 0)
-	{
-		if (!identity)
+		// Pedidos repetidos dentro da janela viram uma só cotação (vale o último trader/moeda)
+		string identityId = sender.GetId();
+		m_PendingQuotes.Set(identityId, new AskalPendingQuote(sender, data.param1, data.param2));
+		if (!AskalRequestLimiter.BeginCoalesce(sender, AskalRequestLimiter.KIND_QUOTE))
 			return;
 		
-		if (!message || message == "")
+		if (!AskalRequestLimiter.TryAcquire(sender, AskalRequestLimiter.KIND_QUOTE))
 		{
-			if (success)
-				message = "Venda realizada com sucesso";
-			else
-				message = "Erro ao processar venda";
+			AskalRequestLimiter.EndCoalesce(identityId, AskalRequestLimiter.KIND_QUOTE);
+			m_PendingQuotes.Remove(identityId);
+			return;
 		}
 		
-		Param4<bool, string, string, int> params = new Param4<bool, string, string, int>(success, message, itemClass, price);
-		GetRPCManager().SendRPC("AskalCoreModule", "SellItemResponse", params, true, identity, NULL);
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(FlushQuote, AskalRequestLimiter.COALESCE_WINDOW_MS, false, identityId);
 	}
 	
-	// RPC Handler: Servidor processa requisição de health dos itens do inventário
-	void RequestInventoryHealth(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
+	// Uma passada pelo inventário; cada preço vem do AskalSellQuoteCache
+	protected void FlushQuote(string identityId)
 	{
-		if (type != CallType.Server || !sender)
+		AskalRequestLimiter.EndCoalesce(identityId, AskalRequestLimiter.KIND_QUOTE);
+		
+		AskalPendingQuote pending = m_PendingQuotes.Get(identityId);
+		m_PendingQuotes.Remove(identityId);
+		if (!pending || !pending.Identity)
 			return;
 		
-		Print("[AskalSell] [RPC] RequestInventoryHealth recebido de: " + sender.GetName());
+		PlayerBase player = AskalSellService.GetPlayerFromIdentity(pending.Identity);
+		if (!player || !player.GetInventory())
+			return;
 		
-		PlayerBase player = AskalSellService.GetPlayerFromIdentity(sender);
-		if (!player)
-		{
-			Print("[AskalSell] [ERRO] Player não encontrado para RequestInventoryHealth");
+		string currencyId = ResolveSellCurrency(pending.TraderName, pending.CurrencyId);
+		AskalPriceBook priceBook = AskalPriceBook.Get(pending.TraderName, currencyId);
+		if (!priceBook)
 			return;
-		}
 		
-		// Escanear inventário e coletar health de todos os itens
+		// Mesma validação da venda: só entra na cotação o que este trader compra
+		// (config carregada uma vez; resultado por classe reaproveitado na passada)
+		bool filterByTrader = pending.TraderName && pending.TraderName != "" && pending.TraderName != "Trader_Default";
+		AskalTraderConfig traderConfig = NULL;
+		if (filterByTrader)
+			traderConfig = AskalTraderConfig.LoadByTraderName(pending.TraderName);
+		map<string, bool> sellableByClass = new map<string, bool>();
+		
+		array<int> ids = new array<int>();
+		array<int> prices = new array<int>();
 		array<EntityAI> inventoryItems = new array<EntityAI>();
 		player.GetInventory().EnumerateInventory(InventoryTraversalType.PREORDER, inventoryItems);
-		
-		// Criar map de className -> healthPercent
-		ref map<string, float> healthMap = new map<string, float>();
-		
 		foreach (EntityAI item : inventoryItems)
 		{
-			if (!item)
+			if (!item || item == player)
 				continue;
 			
-			string className = item.GetType();
-			string normalizedClass = className;
-			normalizedClass.ToLower();
-			
-			// Obter health (0.0 a 1.0)
-			float health01 = item.GetHealth01();
-			float healthPercent = health01 * 100.0;
-			
-			// Garantir que está entre 0 e 100
-			if (healthPercent < 0)
-				healthPercent = 0;
-			if (healthPercent > 100)
-				healthPercent = 100;
+			int price = AskalSellQuoteCache.GetPrice(item, priceBook);
+			if (price < 0)
+				continue;
 			
-			// Armazenar (sobrescreve se já existe - pega o primeiro encontrado)
-			if (!healthMap.Contains(normalizedClass))
+			if (filterByTrader)
 			{
-				healthMap.Insert(normalizedClass, healthPercent);
+				string itemType = item.GetType();
+				bool sellable;
+				if (!sellableByClass.Find(itemType, sellable))
+				{
+					sellable = AskalTraderValidationHelper.CanSellItemWithConfig(traderConfig, itemType);
+					sellableByClass.Set(itemType, sellable);
+				}
+				if (!sellable)
+					continue;
 			}
+			
+			int lowBits;
+			int highBits;
+			item.GetNetworkID(lowBits, highBits);
+			ids.Insert(lowBits);
+			ids.Insert(highBits);
+			prices.Insert(price);
 		}
 		
-		Print("[AskalSell] [RPC] Health coletado para " + healthMap.Count() + " tipos de itens");
+		Param3<string, ref array<int>, ref array<int>> params = new Param3<string, ref array<int>, ref array<int>>(currencyId, ids, prices);
+		GetRPCManager().SendRPC("AskalCoreModule", "InventoryQuoteResponse", params, true, pending.Identity, NULL);
+		AskalMetrics.RecordRpc("InventoryQuoteResponse", AskalMetrics.StringBytes(currencyId) + AskalMetrics.NUMBER_BYTES * (2 + ids.Count() + prices.Count()));
+		if (AskalLog.IsEnabled("Sell", AskalLog.DEBUG))
+			AskalLog.Debug("Sell", "[RPC] InventoryQuoteResponse enviado com " + prices.Count() + " cotações (" + AskalSellQuoteCache.GetStatsSummary() + ")");
+	}
+	
+	// Entidade pelo network ID da cotação; precisa estar no inventário do player,
+	// ser da classe informada (case-insensitive) e poder ser removida
+	EntityAI ResolveSellEntity(PlayerBase player, int networkIdLow, int networkIdHigh, string itemClassName)
+	{
+		if (!player || (networkIdLow == 0 && networkIdHigh == 0))
+			return NULL;
+		
+		EntityAI entity = EntityAI.Cast(GetGame().GetObjectByNetworkId(networkIdLow, networkIdHigh));
+		if (!entity || entity == player)
+			return NULL;
+		
+		if (entity.GetHierarchyRootPlayer() != player)
+			return NULL;
+		
+		string entityLower = entity.GetType();
+		entityLower.ToLower();
+		string expectedLower = itemClassName;
+		expectedLower.ToLower();
+		if (entityLower != expectedLower)
+			return NULL;
+		
+		if (!CanRemove(entity))
+			return NULL;
 		
-		// Enviar resposta ao cliente
-		SendInventoryHealthResponse(sender, healthMap);
+		return entity;
 	}
 	
-	// Enviar resposta de health para o cliente
-	void SendInventoryHealthResponse(PlayerIdentity identity, map<string, float> healthMap)
+	// Verifica se item pode ser removido (simplificado)
+	bool CanRemove(EntityAI item)
 	{
-		if (!identity || !healthMap)
-			return;
+		if (!item || !item.GetInventory())
+			return false;
 		
-		// Converter map para array de pares (className, healthPercent)
-		ref array<ref Param2<string, float>> healthArray = new array<ref Param2<string, float>>();
+		return item.GetInventory().CanRemoveEntity();
+	}
+	
+	// Enviar resposta de venda para o cliente
+	void SendSellResponse(PlayerIdentity identity, bool success, string message = "", string itemClass = "", int price = 0)
+	{
+		if (!identity)
+			return;
 		
-		for (int i = 0; i < healthMap.Count(); i++)
+		if (!message || message == "")
 		{
-			string className = healthMap.GetKey(i);
-			float healthPercent = healthMap.GetElement(i);
-			healthArray.Insert(new Param2<string, float>(className, healthPercent));
+			if (success)
+				message = "Venda realizada com sucesso";
+			else
+				message = "Erro ao processar venda";
 		}
 		
-		Param1<ref array<ref Param2<string, float>>> params = new Param1<ref array<ref Param2<string, float>>>(healthArray);
-		GetRPCManager().SendRPC("AskalCoreModule", "InventoryHealthResponse", params, true, identity, NULL);
-		
-		Print("[AskalSell] [RPC] InventoryHealthResponse enviado com " + healthArray.Count() + " itens");
+		Param4<bool, string, string, int> params = new Param4<bool, string, string, int>(success, message, itemClass, price);
+		GetRPCManager().SendRPC("AskalCoreModule", "SellItemResponse", params, true, identity, NULL);
+		AskalMetrics.RecordRpc("SellItemResponse", AskalMetrics.NUMBER_BYTES * 2 + AskalMetrics.StringBytes(message) + AskalMetrics.StringBytes(itemClass));
 	}
 }
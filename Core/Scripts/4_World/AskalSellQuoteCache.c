@@ -0,0 +1,97 @@
+// ==========================================
+// AskalSellQuoteCache - Cotações de venda por entidade (servidor)
+// Preço autoritativo (AskalSellService.ComputeSellPrice) guardado por network ID
+// e recalculado só quando health, quantidade, munição ou o livro de preços mudam
+// ==========================================
+
+class AskalSellQuote
+{
+	EntityAI Entity;
+	float Health01;
+	float Quantity;
+	int AmmoCount;
+	int BookBuildId;
+	int Price;
+}
+
+class AskalSellQuoteCache
+{
+	protected static const int PRUNE_THRESHOLD = 2048; // Acima disso, descarta cotações de entidades que não existem mais
+
+	protected static ref map<string, ref AskalSellQuote> s_Quotes; // "low:high" -> cotação
+	protected static int s_Hits;
+	protected static int s_Misses;
+
+	// Preço de venda da entidade (-1 se não está no catálogo)
+	static int GetPrice(EntityAI item, AskalPriceBook priceBook)
+	{
+		if (!item || !priceBook)
+			return -1;
+
+		if (!s_Quotes)
+			s_Quotes = new map<string, ref AskalSellQuote>();
+
+		AskalPriceEntry priceEntry = priceBook.GetEntry(item.GetType());
+		if (!priceEntry)
+			return -1;
+
+		float health01 = item.GetHealth01();
+		float quantity = 0;
+		int ammoCount = 0;
+		ItemBase itemBase = ItemBase.Cast(item);
+		if (itemBase && itemBase.HasQuantity())
+			quantity = itemBase.GetQuantity();
+		Magazine mag = Magazine.Cast(item);
+		if (mag)
+			ammoCount = mag.GetAmmoCount();
+
+		string key = AskalHealthSyncCache.KeyOf(item);
+		AskalSellQuote quote;
+		if (s_Quotes.Find(key, quote) && quote.Entity == item && quote.BookBuildId == priceBook.GetBuildId() && quote.Health01 == health01 && quote.Quantity == quantity && quote.AmmoCount == ammoCount)
+		{
+			s_Hits++;
+			return quote.Price;
+		}
+
+		if (!quote)
+		{
+			if (s_Quotes.Count() >= PRUNE_THRESHOLD)
+				PruneDeleted();
+
+			quote = new AskalSellQuote();
+			s_Quotes.Set(key, quote);
+		}
+
+		quote.Entity = item;
+		quote.Health01 = health01;
+		quote.Quantity = quantity;
+		quote.AmmoCount = ammoCount;
+		quote.BookBuildId = priceBook.GetBuildId();
+		quote.Price = AskalSellService.ComputeSellPrice(item, priceBook, priceEntry);
+		s_Misses++;
+		return quote.Price;
+	}
+
+	static string GetStatsSummary()
+	{
+		int cached = 0;
+		if (s_Quotes)
+			cached = s_Quotes.Count();
+		return "quotes=" + cached + " hits=" + s_Hits + " misses=" + s_Misses;
+	}
+
+	protected static void PruneDeleted()
+	{
+		array<string> deletedKeys = new array<string>();
+		foreach (string key, AskalSellQuote quote : s_Quotes)
+		{
+			if (!quote.Entity)
+				deletedKeys.Insert(key);
+		}
+
+		foreach (string deletedKey : deletedKeys)
+		{
+			s_Quotes.Remove(deletedKey);
+		}
+	}
+}
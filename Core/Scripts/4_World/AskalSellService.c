@@ -10,250 +10,245 @@ class AskalSellService
 	// 3. Calcular preço
 	// 4. Adicionar dinheiro
 	// 5. Remover item
-	static bool ProcessSell(PlayerIdentity identity, string steamId, EntityAI itemToSell, string currencyId, int transactionMode, out int outPrice)
+	static bool ProcessSell(PlayerIdentity identity, string steamId, EntityAI itemToSell, string currencyId, int transactionMode, out int outPrice, string traderName = "")
 	{
-		Print("[AskalSell] [PROCESSO] Iniciando ProcessSell");
+		// Classe capturada antes: o item é removido quando a venda dá certo
+		string soldClassName = "";
+		if (itemToSell)
+			soldClassName = itemToSell.GetType();
+		
+		int startTicks = TickCount(0);
+		bool success = ProcessSellInternal(identity, steamId, itemToSell, currencyId, transactionMode, outPrice, traderName);
+		float elapsedMs = AskalMetrics.ObserveTicks("sell.process_ms", startTicks);
+		AskalMetrics.RecordTransaction("sell", soldClassName + " @ " + traderName, elapsedMs);
+		if (success)
+			AskalMetrics.Increment("sell.success");
+		else
+			AskalMetrics.Increment("sell.failure");
+		return success;
+	}
+	
+	protected static bool ProcessSellInternal(PlayerIdentity identity, string steamId, EntityAI itemToSell, string currencyId, int transactionMode, out int outPrice, string traderName)
+	{
+		AskalLog.Debug("Sell", "[PROCESSO] Iniciando ProcessSell");
 		
 		if (!identity || !itemToSell)
 		{
-			Print("[AskalSell] [ERRO] Identity ou item invalido");
+			AskalLog.Error("Sell", "Identity ou item invalido");
 			return false;
 		}
 		
 		PlayerBase player = GetPlayerFromIdentity(identity);
 		if (!player)
 		{
-			Print("[AskalSell] [ERRO] Player nao encontrado");
+			AskalLog.Error("Sell", "Player nao encontrado");
 			return false;
 		}
 		
 		string itemClass = itemToSell.GetType();
-		Print("[AskalSell] [PROCESSO] Item: " + itemClass);
+		if (AskalLog.IsEnabled("Sell", AskalLog.DEBUG))
+			AskalLog.Debug("Sell", "[PROCESSO] Item: " + itemClass);
 		
 		// ÚNICA VALIDAÇÃO: Item pode ser removido?
 		if (!itemToSell.GetInventory())
 		{
-			Print("[AskalSell] [ERRO] Item nao tem inventory");
+			AskalLog.Error("Sell", "Item nao tem inventory");
 			return false;
 		}
 		
 		if (!itemToSell.GetInventory().CanRemoveEntity())
 		{
-			Print("[AskalSell] [ERRO] Item nao pode ser removido (CanRemoveEntity = false)");
+			AskalLog.Error("Sell", "Item nao pode ser removido (CanRemoveEntity = false)");
 			return false;
 		}
-		Print("[AskalSell] [VALIDACAO] Item pode ser removido");
+		AskalLog.Debug("Sell", "[VALIDACAO] Item pode ser removido");
+		
+		// Busca item no livro de preços da loja/moeda (case-insensitive)
+		if (AskalLog.IsEnabled("Sell", AskalLog.DEBUG))
+			AskalLog.Debug("Sell", "[DATABASE] Buscando item no livro de preços: " + itemClass);
+		AskalPriceBook priceBook = AskalPriceBook.Get(traderName, currencyId);
+		AskalPriceEntry priceEntry = NULL;
+		if (priceBook)
+			priceEntry = priceBook.GetEntry(itemClass);
+		if (!priceEntry)
+		{
+			AskalLog.Error("Sell", "Item nao encontrado no database: " + itemClass);
+			return false;
+		}
+		if (AskalLog.IsEnabled("Sell", AskalLog.DEBUG))
+			AskalLog.Debug("Sell", "[DATABASE] Item encontrado - Price: " + priceEntry.BasePrice + " | SellPercent: " + priceEntry.SellPercent);
+		
+		// Preço autoritativo (mesma fórmula das cotações do QuoteInventory)
+		int totalPrice = ComputeSellPrice(itemToSell, priceBook, priceEntry);
+		if (AskalLog.IsEnabled("Sell", AskalLog.DEBUG))
+			AskalLog.Debug("Sell", "[PRECO] Preco calculado: " + totalPrice + " (base: " + priceEntry.BasePrice + ", sell%: " + priceEntry.SellPercent + ", health01: " + itemToSell.GetHealth01() + ", coeff: " + priceBook.GetSellCoefficient() + ")");
 		
-		// Busca item no database (case-insensitive)
-		Print("[AskalSell] [DATABASE] Buscando item no database: " + itemClass);
-		ItemData serverItemData = AskalDatabase.GetItemCaseInsensitive(itemClass);
-		if (!serverItemData)
+		// Retornar preço via parâmetro de saída
+		outPrice = totalPrice;
+		
+		// VERIFICAR: Se item tem cargo, NÃO permitir venda (deve estar vazio) - ANTES de processar pagamento
+		AskalLog.Debug("Sell", "[VALIDACAO] Verificando se item tem cargo...");
+		if (HasCargoItemsRecursive(itemToSell))
 		{
-			Print("[AskalSell] [ERRO] Item nao encontrado no database: " + itemClass);
+			AskalLog.Error("Sell", "Item tem cargo - venda bloqueada");
+			outPrice = 0;
+		return false;
+	}
+	
+		// Adiciona dinheiro ANTES de remover item
+		if (!CreditSale(player, steamId, totalPrice, currencyId, transactionMode))
+		{
+			outPrice = 0;
 			return false;
 		}
-		Print("[AskalSell] [DATABASE] Item encontrado - Price: " + serverItemData.Price + " | SellPercent: " + serverItemData.SellPercent);
 		
-		// Calcula preço PROPORCIONAL À INTEGRIDADE
-		int basePrice = serverItemData.Price;
-		if (basePrice <= 0)
-			basePrice = AskalMarketDefaults.DEFAULT_BUY_PRICE;
+		// Gerar descrição detalhada da venda (inclui attachments)
+		string sellDescription = BuildSellDescription(itemToSell, itemClass);
 		
-		int sellPercent = serverItemData.SellPercent;
-		if (sellPercent <= 0)
-			sellPercent = AskalMarketDefaults.DEFAULT_SELL_PERCENT;
+		// Remove item do inventário (attachments são vendidos junto)
+		AskalLog.Debug("Sell", "[REMOCAO] Removendo item...");
+		AskalTradeSpawnLayer.GetInstance().DeleteEntity(itemToSell);
+		AskalLog.Debug("Sell", "[REMOCAO] Item removido");
 		
-		// Obter integridade do item (0.0 a 1.0, onde 1.0 = 100%)
-		float health01 = itemToSell.GetHealth01();
-		float healthPercent = health01 * 100.0;
+		// Notificar cliente com descrição detalhada (apenas no menu)
+		AskalNotificationHelper.AddSellNotification(itemClass, totalPrice, sellDescription, steamId);
 		
-		// Garantir que health está entre 0 e 100
-		if (healthPercent < 0)
-			healthPercent = 0;
-		if (healthPercent > 100)
-			healthPercent = 100;
+		AskalLog.Info("Sell", "[SUCESSO] Venda concluida: " + itemClass + " - " + totalPrice + " " + currencyId);
+		return true;
+	}
+	
+	// Pagamento da venda: 1 = moeda física no inventário (requer player), 2 = balance virtual
+	static bool CreditSale(PlayerBase player, string steamId, int totalPrice, string currencyId, int transactionMode)
+	{
+		if (AskalLog.IsEnabled("Sell", AskalLog.DEBUG))
+			AskalLog.Debug("Sell", "[PAGAMENTO] Adicionando dinheiro (Mode: " + transactionMode + ")...");
+		bool paymentSuccess = false;
 		
-		Print("[AskalSell] [HEALTH] Integridade do item: " + healthPercent + "% (health01: " + health01 + ")");
+		if (transactionMode == 1)
+		{
+			paymentSuccess = AskalCurrencyInventoryManager.AddPhysicalCurrency(player, totalPrice, currencyId);
+		}
+		else if (transactionMode == 2)
+		{
+			// Resolve balance key from currencyId (always uses currencyID, not Value.Name)
+			string balanceKey = AskalPlayerBalance.ResolveBalanceKey(currencyId);
+			if (!balanceKey || balanceKey == "")
+			{
+				AskalLog.Error("Sell", "Failed to resolve balance key for currency: " + currencyId);
+				return false;
+			}
+			
+			if (AskalLog.IsEnabled("Sell", AskalLog.DEBUG))
+				AskalLog.Debug("Sell", "[PAGAMENTO] Resolved balance key: " + balanceKey + " (currencyId: " + currencyId + ")");
+			paymentSuccess = AskalPlayerBalance.AddBalance(steamId, totalPrice, balanceKey);
+		}
+		else
+		{
+			AskalLog.Error("Sell", "TransactionMode invalido: " + transactionMode);
+			return false;
+		}
 		
-		// Obter coeficiente de venda (uma vez só)
-			float sellCoeff = AskalVirtualStoreSettings.GetSellCoefficient();
+		if (!paymentSuccess)
+		{
+			AskalLog.Error("Sell", "Falha ao adicionar dinheiro");
+			return false;
+		}
+		AskalLog.Debug("Sell", "[PAGAMENTO] Dinheiro adicionado com sucesso");
+		return true;
+	}
+	
+	// Preço de venda sem entidade (health 100%, sem munição/quantidade) - simulador de carga
+	static int ComputeSellPriceForEntry(AskalPriceBook priceBook, AskalPriceEntry priceEntry)
+	{
+		if (!priceBook || !priceEntry)
+			return 0;
+		
+		float price = priceEntry.SellBase;
+		float sellCoeff = priceBook.GetSellCoefficient();
+		if (sellCoeff > 0)
+			price = price * sellCoeff;
+		
+		int totalPrice = Math.Round(price);
+		if (totalPrice <= 0)
+			totalPrice = 1;
+		return totalPrice;
+	}
+	
+	// Preço de venda de uma entidade: health (ou quantidade em stackables) + munição em carregadores
+	// Usado pela venda e pelas cotações; sem logs (cotação roda para o inventário inteiro)
+	static int ComputeSellPrice(EntityAI item, AskalPriceBook priceBook, AskalPriceEntry priceEntry)
+	{
+		if (!item || !priceBook || !priceEntry)
+			return 0;
 		
-		// Calcular preço base: basePrice * sellPercent
-		float baseSellPrice = basePrice * (sellPercent / 100.0);
+		int sellPercent = priceEntry.SellPercent;
+		float sellCoeff = priceBook.GetSellCoefficient();
+		float baseSellPrice = priceEntry.SellBase;
 		
-		// Aplicar proporção de integridade: preço proporcional à health (1% health = 1% do valor)
+		// Preço proporcional à integridade (1% health = 1% do valor)
+		float healthPercent = Math.Clamp(item.GetHealth01() * 100.0, 0, 100);
 		float priceWithHealth = baseSellPrice * (healthPercent / 100.0);
 		
-		// CALCULAR PREÇO DE MUNIÇÃO EM CARREGADORES
+		// Munição em carregadores: quantidade * preço unitário * sellPercent * health
 		float ammoPrice = 0.0;
-		Magazine mag = Magazine.Cast(itemToSell);
-		if (mag)
+		Magazine mag = Magazine.Cast(item);
+		if (mag && mag.GetAmmoCount() > 0)
 		{
-			int ammoCount = mag.GetAmmoCount();
-			if (ammoCount > 0)
+			string ammoItemClass = ResolveAmmoItemClass(item.GetType());
+			if (ammoItemClass != "")
 			{
-				// Obter tipo de munição do carregador via config
-				string magazineClass = itemToSell.GetType();
-				string ammoType = "";
-				GetGame().ConfigGetText("CfgMagazines " + magazineClass + " ammo", ammoType);
-				
-				if (ammoType && ammoType != "")
+				float ammoUnitPrice = priceBook.GetAmmoUnitPrice(ammoItemClass);
+				if (ammoUnitPrice > 0)
 				{
-					// Tentar encontrar item de munição no database
-					// Formato pode ser "Bullet_XXX" ou "Ammo_XXX"
-					string ammoItemClass = "";
-					if (ammoType.IndexOf("Bullet_") == 0)
-					{
-						// Converter "Bullet_XXX" para "Ammo_XXX"
-						ammoItemClass = "Ammo_" + ammoType.Substring(7, ammoType.Length() - 7);
-					}
-					else if (ammoType.IndexOf("Ammo_") == 0)
-					{
-						ammoItemClass = ammoType;
-					}
-					
-					if (ammoItemClass != "")
-					{
-						// Buscar preço da munição no database
-						ItemData ammoData = AskalDatabase.GetItemCaseInsensitive(ammoItemClass);
-						if (ammoData && ammoData.Price > 0)
-						{
-							// Calcular preço por unidade de munição
-							// Assumir que o preço do item Ammo_XXX é para 1 unidade
-							// Se o item tem quantidade, dividir pelo máximo
-							float ammoUnitPrice = ammoData.Price;
-							
-							// Verificar se é stackable e tem quantidade máxima
-							ItemBase tempAmmo = ItemBase.Cast(GetGame().CreateObjectEx(ammoItemClass, vector.Zero, ECE_PLACE_ON_SURFACE, RF_DEFAULT));
-							if (tempAmmo && tempAmmo.HasQuantity())
-							{
-								float ammoMaxQty = tempAmmo.GetQuantityMax();
-								if (ammoMaxQty > 0)
-									ammoUnitPrice = ammoData.Price / ammoMaxQty;
-							}
-							if (tempAmmo)
-								GetGame().ObjectDelete(tempAmmo);
-							
-							// Calcular preço total da munição: quantidade * preço unitário * sellPercent * health
-							float ammoBasePrice = ammoCount * ammoUnitPrice;
-							float ammoSellPrice = ammoBasePrice * (sellPercent / 100.0) * (healthPercent / 100.0);
-							
-							// Aplicar coeficiente de venda
-							if (sellCoeff > 0)
-								ammoSellPrice = ammoSellPrice * sellCoeff;
-							
-							ammoPrice = ammoSellPrice;
-							Print("[AskalSell] [MUNICAO] Carregador com " + ammoCount + "x " + ammoItemClass + " = $" + Math.Round(ammoPrice));
-						}
-					}
+					ammoPrice = mag.GetAmmoCount() * ammoUnitPrice * (sellPercent / 100.0) * (healthPercent / 100.0);
+					if (sellCoeff > 0)
+						ammoPrice = ammoPrice * sellCoeff;
 				}
 			}
 		}
 		
-		// CALCULAR PREÇO DE QUANTIDADE EM STACKABLES
+		// Stackables: preço proporcional à quantidade (substitui o de integridade)
 		float quantityPrice = 0.0;
-		ItemBase itemBase = ItemBase.Cast(itemToSell);
-		if (itemBase && itemBase.HasQuantity() && !mag) // Não processar se já é magazine
+		ItemBase itemBase = ItemBase.Cast(item);
+		if (itemBase && itemBase.HasQuantity() && !mag)
 		{
 			float currentQty = itemBase.GetQuantity();
 			float maxQty = itemBase.GetQuantityMax();
-			
 			if (maxQty > 0 && currentQty > 0)
 			{
-				// Calcular preço proporcional à quantidade
-				float quantityPercent = (currentQty / maxQty) * 100.0;
-				quantityPrice = baseSellPrice * (quantityPercent / 100.0);
-				
-				// Aplicar coeficiente de venda
+				quantityPrice = baseSellPrice * (currentQty / maxQty);
 				if (sellCoeff > 0)
 					quantityPrice = quantityPrice * sellCoeff;
-				
-				Print("[AskalSell] [QUANTIDADE] Item com " + currentQty + "/" + maxQty + " (" + quantityPercent + "%) = $" + Math.Round(quantityPrice));
 			}
 		}
 		
-		// Se tem quantityPrice, usar ele em vez de priceWithHealth (para stackables)
 		if (quantityPrice > 0)
 			priceWithHealth = quantityPrice;
-		else
-		{
-			// Aplicar coeficiente de venda no preço do item (se não é stackable)
-			if (sellCoeff > 0)
-				priceWithHealth = priceWithHealth * sellCoeff;
-		}
-		
-		// Soma total: preço do item + preço da munição
-		float totalPriceFloat = priceWithHealth + ammoPrice;
+		else if (sellCoeff > 0)
+			priceWithHealth = priceWithHealth * sellCoeff;
 		
-		int totalPrice = Math.Round(totalPriceFloat);
+		int totalPrice = Math.Round(priceWithHealth + ammoPrice);
 		
 		// Garantir mínimo de 1 (mesmo com 1% health)
 		if (totalPrice <= 0)
 			totalPrice = 1;
 		
-		Print("[AskalSell] [PRECO] Preco calculado: " + totalPrice + " (item: " + Math.Round(priceWithHealth) + ", municao: " + Math.Round(ammoPrice) + ", base: " + basePrice + ", sell%: " + sellPercent + ", health%: " + healthPercent + ", coeff: " + sellCoeff + ")");
-		
-		// Retornar preço via parâmetro de saída
-		outPrice = totalPrice;
-		
-		// VERIFICAR: Se item tem cargo, NÃO permitir venda (deve estar vazio) - ANTES de processar pagamento
-		Print("[AskalSell] [VALIDACAO] Verificando se item tem cargo...");
-		if (HasCargoItemsRecursive(itemToSell))
-		{
-			Print("[AskalSell] [ERRO] Item tem cargo - venda bloqueada");
-			outPrice = 0;
-		return false;
+		return totalPrice;
 	}
 	
-		// Adiciona dinheiro ANTES de remover item
-		Print("[AskalSell] [PAGAMENTO] Adicionando dinheiro (Mode: " + transactionMode + ")...");
-		bool paymentSuccess = false;
-		
-		if (transactionMode == 1)
-		{
-			paymentSuccess = AskalCurrencyInventoryManager.AddPhysicalCurrency(player, totalPrice, currencyId);
-		}
-		else if (transactionMode == 2)
-		{
-			// Resolve balance key from currencyId (always uses currencyID, not Value.Name)
-			string balanceKey = AskalPlayerBalance.ResolveBalanceKey(currencyId);
-			if (!balanceKey || balanceKey == "")
-			{
-				Print("[AskalSell] [ERRO] Failed to resolve balance key for currency: " + currencyId);
-				outPrice = 0;
-				return false;
-			}
-			
-			Print("[AskalSell] [PAGAMENTO] Resolved balance key: " + balanceKey + " (currencyId: " + currencyId + ")");
-			paymentSuccess = AskalPlayerBalance.AddBalance(steamId, totalPrice, balanceKey);
-		}
-		else
-		{
-			Print("[AskalSell] [ERRO] TransactionMode invalido: " + transactionMode);
-		return false;
-	}
-	
-		if (!paymentSuccess)
+	// "Bullet_XXX" / "Ammo_XXX" do carregador -> classe do item de munição no catálogo
+	static string ResolveAmmoItemClass(string magazineClass)
 	{
-			Print("[AskalSell] [ERRO] Falha ao adicionar dinheiro");
-			outPrice = 0;
-			return false;
-		}
-		Print("[AskalSell] [PAGAMENTO] Dinheiro adicionado com sucesso");
-		
-		// Gerar descrição detalhada da venda (inclui attachments)
-		string sellDescription = BuildSellDescription(itemToSell, itemClass);
-		
-		// Remove item do inventário (attachments são vendidos junto)
-		Print("[AskalSell] [REMOCAO] Removendo item...");
-		GetGame().ObjectDelete(itemToSell);
-		Print("[AskalSell] [REMOCAO] Item removido");
-		
-		// Notificar cliente com descrição detalhada (apenas no menu)
-		AskalNotificationHelper.AddSellNotification(itemClass, totalPrice, sellDescription);
-		
-		Print("[AskalSell] [SUCESSO] Venda concluida: " + itemClass + " - " + totalPrice + " " + currencyId);
-		return true;
+		string ammoType = "";
+		GetGame().ConfigGetText("CfgMagazines " + magazineClass + " ammo", ammoType);
+		if (!ammoType || ammoType == "")
+			return "";
+		
+		if (ammoType.IndexOf("Bullet_") == 0)
+			return "Ammo_" + ammoType.Substring(7, ammoType.Length() - 7);
+		if (ammoType.IndexOf("Ammo_") == 0)
+			return ammoType;
+		return "";
 	}
 	
 	// Obter PlayerBase de PlayerIdentity
@@ -0,0 +1,400 @@
+// ==========================================
+// AskalTradeLoadSimulator - Carga sintética de transações no servidor (sem clientes)
+// Ativado por -askalTradeSim=<jogadores> (opcionais: -askalTradeSimRate=<carrinhos/s>,
+// -askalTradeSimSeconds=<duração>, -askalTradeSimTrader=<trader>)
+// Jogadores virtuais com SteamIDs sintéticos compram e vendem pelos serviços reais
+// (preço, balance, I/O de player); a criação de itens usa AskalTradeSpawnLayerStub,
+// registrado só para os SteamIDs sintéticos (jogadores reais não são afetados)
+// Métricas das transações simuladas ficam em sim.* (fora das de produção)
+// Relatório em $profile:Askal/Benchmark/Reports/trade_*.json
+// ==========================================
+
+class AskalTradeSimReport
+{
+	string Timestamp;
+	string TraderName;
+	string CurrencyId;
+	int Players;
+	float TargetCartsPerSecond;
+	int DurationSeconds;
+	int CatalogItems;           // Itens elegíveis (com preço na loja, sem veículos)
+
+	int Carts;
+	int Purchases;
+	int PurchaseFailures;
+	int Sells;
+	int SellFailures;
+	int ItemsCreated;           // Contados pelo stub de spawn
+	int ItemsDeleted;
+	float CartsPerSecond;
+	float TransactionsPerSecond; // Compras + vendas individuais
+
+	int Ticks;
+	float TickAvgMs;            // Tempo ocupado pelo simulador por tick do servidor
+	float TickP95Ms;
+	float TickMaxMs;
+	float BusyPercent;          // Tempo ocupado / tempo de parede
+	float PurchaseAvgMs;
+	float SellAvgMs;
+
+	int PlayerLoads;            // AskalPlayerBalance.LoadPlayerData (leituras de disco)
+	int PlayerSaves;            // AskalPlayerBalance.SavePlayerData (gravações)
+	float LoadsPerTransaction;
+	float SavesPerTransaction;
+}
+
+class AskalTradeLoadSimulator
+{
+	static const string CLI_PARAM = "askalTradeSim";
+	static const string CLI_RATE_PARAM = "askalTradeSimRate";
+	static const string CLI_SECONDS_PARAM = "askalTradeSimSeconds";
+	static const string CLI_TRADER_PARAM = "askalTradeSimTrader";
+	protected static const string REPORTS_DIRECTORY = "$profile:Askal/Benchmark/Reports/";
+	protected static const string STEAM_ID_PREFIX = "7656119SIM";
+
+	protected static const int DEFAULT_RATE = 20;             // Carrinhos por segundo
+	protected static const int DEFAULT_SECONDS = 60;
+	protected static const int TICK_INTERVAL_MS = 50;
+	protected static const int MAX_CARTS_PER_TICK = 50;       // Evita travar o servidor se a taxa for irreal
+	protected static const int START_BALANCE = 100000000;
+	protected static const int SELL_PERCENT = 40;             // Fração dos carrinhos que são vendas
+
+	protected static bool s_Running = false;
+	protected static ref array<string> s_SteamIds;
+	protected static ref map<string, ref array<string>> s_OwnedItems;   // steamId -> itens comprados (vendáveis)
+	protected static ref array<string> s_Items;
+	protected static ref array<int> s_CartSizes;
+	protected static ref AskalTradeSpawnLayerStub s_SpawnStub;
+	protected static ref AskalMetricHistogram s_TickHistogram;
+	protected static ref AskalTradeSimReport s_Report;
+	protected static AskalPriceBook s_PriceBook;
+	protected static string s_BalanceKey;
+	protected static float s_CartBudget;
+	protected static float s_BusyMs;
+	protected static float s_PurchaseMs;
+	protected static float s_SellMs;
+	protected static int s_StartedAt;
+	protected static int s_LastTickAt;
+	protected static int s_LoadsBefore;
+	protected static int s_SavesBefore;
+
+	// Roda a simulação se o parâmetro de lançamento estiver presente
+	static bool RunFromCommandLine()
+	{
+		string playersParam;
+		if (!GetCLIParam(CLI_PARAM, playersParam) || playersParam == "")
+			return false;
+
+		int players = playersParam.ToInt();
+		int rate = DEFAULT_RATE;
+		int seconds = DEFAULT_SECONDS;
+		string traderName = "";
+
+		string rateParam;
+		if (GetCLIParam(CLI_RATE_PARAM, rateParam) && rateParam.ToInt() > 0)
+			rate = rateParam.ToInt();
+
+		string secondsParam;
+		if (GetCLIParam(CLI_SECONDS_PARAM, secondsParam) && secondsParam.ToInt() > 0)
+			seconds = secondsParam.ToInt();
+
+		if (!GetCLIParam(CLI_TRADER_PARAM, traderName))
+			traderName = "";
+
+		return Start(players, rate, seconds, traderName);
+	}
+
+	static bool IsRunning()
+	{
+		return s_Running;
+	}
+
+	static bool Start(int players, int cartsPerSecond, int seconds, string traderName)
+	{
+		if (s_Running)
+			return false;
+
+		if (players <= 0 || cartsPerSecond <= 0 || seconds <= 0)
+		{
+			Print("[AskalTradeSim] ⚠️ Parâmetros inválidos: jogadores=" + players + " taxa=" + cartsPerSecond + " segundos=" + seconds);
+			return false;
+		}
+
+		string currencyId = AskalVirtualStoreSettings.GetPrimaryCurrency();
+		s_BalanceKey = AskalPlayerBalance.ResolveBalanceKey(currencyId);
+		s_PriceBook = AskalPriceBook.Get(traderName, currencyId);
+		if (!s_BalanceKey || s_BalanceKey == "" || !s_PriceBook)
+		{
+			Print("[AskalTradeSim] ❌ Moeda/livro de preços indisponível: " + currencyId);
+			return false;
+		}
+
+		s_Items = CollectItems(s_PriceBook);
+		if (s_Items.Count() == 0)
+		{
+			Print("[AskalTradeSim] ❌ Nenhum item com preço para a loja: " + AskalPriceBook.ResolveStoreKey(traderName));
+			return false;
+		}
+
+		Print("[AskalTradeSim] ========================================");
+		Print("[AskalTradeSim] 🏁 Simulação: " + players + " jogadores | " + cartsPerSecond + " carrinhos/s | " + seconds + "s | " + s_Items.Count() + " itens");
+
+		s_Report = new AskalTradeSimReport();
+		s_Report.Timestamp = AskalLog.FormatTimestamp("-", "T", ":");
+		s_Report.TraderName = traderName;
+		s_Report.CurrencyId = currencyId;
+		s_Report.Players = players;
+		s_Report.TargetCartsPerSecond = cartsPerSecond;
+		s_Report.DurationSeconds = seconds;
+		s_Report.CatalogItems = s_Items.Count();
+
+		// Carrinhos reais são pequenos: maioria 1-2 itens, raros 6
+		s_CartSizes = {1, 1, 1, 2, 2, 3, 4, 6};
+
+		// Jogadores virtuais com saldo alto (arquivos criados pelo próprio AskalPlayerBalance)
+		s_SteamIds = new array<string>();
+		s_OwnedItems = new map<string, ref array<string>>();
+		for (int playerIdx = 0; playerIdx < players; playerIdx++)
+		{
+			string steamId = STEAM_ID_PREFIX + playerIdx.ToStringLen(7);
+			s_SteamIds.Insert(steamId);
+			s_OwnedItems.Insert(steamId, new array<string>());
+			AskalPlayerBalance.AddBalance(steamId, START_BALANCE, s_BalanceKey);
+		}
+
+		s_SpawnStub = new AskalTradeSpawnLayerStub();
+		AskalTradeSpawnLayer.SetSimulatedLayer(s_SpawnStub, STEAM_ID_PREFIX);
+
+		s_TickHistogram = new AskalMetricHistogram();
+		s_CartBudget = 0;
+		s_BusyMs = 0;
+		s_PurchaseMs = 0;
+		s_SellMs = 0;
+		s_LoadsBefore = GetHistogramCount("player.load_ms");
+		s_SavesBefore = GetHistogramCount("player.save_ms");
+		s_StartedAt = GetGame().GetTime();
+		s_LastTickAt = s_StartedAt;
+		s_Running = true;
+
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(Tick, TICK_INTERVAL_MS, true);
+		return true;
+	}
+
+	static void Stop()
+	{
+		if (!s_Running)
+			return;
+
+		s_Running = false;
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Tick);
+		AskalTradeSpawnLayer.SetSimulatedLayer(NULL, "");
+		AskalNotificationHelper.ClearNotificationsForOwnerPrefix(STEAM_ID_PREFIX);
+
+		Finalize((GetGame().GetTime() - s_StartedAt) / 1000.0);
+		WriteReport(s_Report);
+
+		foreach (string steamId : s_SteamIds)
+		{
+			DeleteFile(AskalPlayerBalance.GetPlayerFilePath(steamId));
+		}
+		s_SteamIds = NULL;
+		s_OwnedItems = NULL;
+		s_SpawnStub = NULL;
+		Print("[AskalTradeSim] ========================================");
+	}
+
+	// ========================================
+	// Loop
+	// ========================================
+	protected static void Tick()
+	{
+		int now = GetGame().GetTime();
+		if (now - s_StartedAt >= s_Report.DurationSeconds * 1000)
+		{
+			Stop();
+			return;
+		}
+
+		s_CartBudget += s_Report.TargetCartsPerSecond * (now - s_LastTickAt) / 1000.0;
+		s_LastTickAt = now;
+
+		int tickStart = TickCount(0);
+		int carts = 0;
+		while (s_CartBudget >= 1 && carts < MAX_CARTS_PER_TICK)
+		{
+			RunCart();
+			s_CartBudget -= 1;
+			carts++;
+		}
+		// Atrasado demais: descarta o excedente em vez de acumular
+		if (s_CartBudget >= 1)
+			s_CartBudget = 0;
+
+		// Sem clientes para consumir as notificações de compra/venda
+		AskalNotificationHelper.ClearNotificationsForOwnerPrefix(STEAM_ID_PREFIX);
+
+		float tickMs = TickCount(tickStart) / 10000.0;
+		s_TickHistogram.Observe(tickMs);
+		s_BusyMs += tickMs;
+	}
+
+	protected static void RunCart()
+	{
+		string steamId = s_SteamIds.GetRandomElement();
+		array<string> owned = s_OwnedItems.Get(steamId);
+		int cartSize = s_CartSizes.GetRandomElement();
+		bool isSell = owned.Count() > 0 && Math.RandomInt(0, 100) < SELL_PERCENT;
+
+		s_Report.Carts++;
+		for (int lineIdx = 0; lineIdx < cartSize; lineIdx++)
+		{
+			if (isSell)
+			{
+				if (owned.Count() == 0)
+					break;
+				SimulateSell(steamId, owned);
+			}
+			else
+			{
+				SimulatePurchase(steamId, owned);
+			}
+		}
+	}
+
+	protected static void SimulatePurchase(string steamId, array<string> owned)
+	{
+		string itemClass = s_Items.GetRandomElement();
+		AskalPriceEntry priceEntry = s_PriceBook.GetEntry(itemClass);
+
+		int startTicks = TickCount(0);
+		bool success = AskalPurchaseService.ProcessPurchaseWithQuantity(NULL, steamId, itemClass, priceEntry.BuyPrice, s_Report.CurrencyId, -1, 0, 0, s_Report.TraderName);
+		s_PurchaseMs += TickCount(startTicks) / 10000.0;
+
+		s_Report.Purchases++;
+		if (success)
+			owned.Insert(itemClass);
+		else
+			s_Report.PurchaseFailures++;
+	}
+
+	// Mesmo caminho de preço e pagamento da venda real (modo balance), sem entidade
+	protected static void SimulateSell(string steamId, array<string> owned)
+	{
+		int ownedIdx = Math.RandomInt(0, owned.Count());
+		string itemClass = owned[ownedIdx];
+		owned.Remove(ownedIdx);
+
+		int startTicks = TickCount(0);
+		bool success = false;
+		AskalPriceEntry priceEntry = s_PriceBook.GetEntry(itemClass);
+		if (priceEntry)
+		{
+			int totalPrice = AskalSellService.ComputeSellPriceForEntry(s_PriceBook, priceEntry);
+			success = AskalSellService.CreditSale(NULL, steamId, totalPrice, s_Report.CurrencyId, 2);
+			if (success)
+				s_SpawnStub.DeleteEntity(NULL);
+		}
+		float elapsedMs = AskalMetrics.ObserveTicks("sim.sell.process_ms", startTicks);
+		if (success)
+			AskalMetrics.Increment("sim.sell.success");
+		else
+			AskalMetrics.Increment("sim.sell.failure");
+		s_SellMs += elapsedMs;
+
+		s_Report.Sells++;
+		if (!success)
+			s_Report.SellFailures++;
+	}
+
+	// ========================================
+	// Preparação e relatório
+	// ========================================
+
+	// Itens do catálogo com preço na loja; veículos ficam de fora (spawn no mundo)
+	protected static array<string> CollectItems(AskalPriceBook priceBook)
+	{
+		array<string> items = new array<string>();
+		if (!AskalDatabase.m_Datasets)
+			return items;
+
+		foreach (string datasetId, Dataset dataset : AskalDatabase.m_Datasets)
+		{
+			if (!dataset || !dataset.Categories)
+				continue;
+
+			foreach (string categoryId, AskalCategory category : dataset.Categories)
+			{
+				if (!category || !category.Items)
+					continue;
+
+				foreach (string itemClass, ItemData itemData : category.Items)
+				{
+					if (AskalVehicleSpawn.IsVehicleClass(itemClass))
+						continue;
+
+					AskalPriceEntry priceEntry = priceBook.GetEntry(itemClass);
+					if (priceEntry && priceEntry.BuyPrice > 0)
+						items.Insert(itemClass);
+				}
+			}
+		}
+		return items;
+	}
+
+	protected static void Finalize(float elapsedSeconds)
+	{
+		s_Report.ItemsCreated = s_SpawnStub.CreatedCount;
+		s_Report.ItemsDeleted = s_SpawnStub.DeletedCount;
+		s_Report.PlayerLoads = GetHistogramCount("player.load_ms") - s_LoadsBefore;
+		s_Report.PlayerSaves = GetHistogramCount("player.save_ms") - s_SavesBefore;
+
+		int transactions = s_Report.Purchases + s_Report.Sells;
+		if (elapsedSeconds > 0)
+		{
+			s_Report.CartsPerSecond = s_Report.Carts / elapsedSeconds;
+			s_Report.TransactionsPerSecond = transactions / elapsedSeconds;
+			s_Report.BusyPercent = (s_BusyMs / (elapsedSeconds * 1000.0)) * 100.0;
+		}
+		if (transactions > 0)
+		{
+			s_Report.LoadsPerTransaction = s_Report.PlayerLoads * 1.0 / transactions;
+			s_Report.SavesPerTransaction = s_Report.PlayerSaves * 1.0 / transactions;
+		}
+		if (s_Report.Purchases > 0)
+			s_Report.PurchaseAvgMs = s_PurchaseMs / s_Report.Purchases;
+		if (s_Report.Sells > 0)
+			s_Report.SellAvgMs = s_SellMs / s_Report.Sells;
+
+		s_Report.Ticks = s_TickHistogram.Count;
+		if (s_TickHistogram.Count > 0)
+			s_Report.TickAvgMs = s_TickHistogram.SumMs / s_TickHistogram.Count;
+		s_Report.TickP95Ms = s_TickHistogram.GetPercentileMs(0.95);
+		s_Report.TickMaxMs = s_TickHistogram.MaxMs;
+
+		Print("[AskalTradeSim] ✅ " + s_Report.Carts + " carrinhos (" + s_Report.CartsPerSecond + "/s) | " + transactions + " transações (" + s_Report.TransactionsPerSecond + "/s) | falhas compra=" + s_Report.PurchaseFailures + " venda=" + s_Report.SellFailures);
+		Print("[AskalTradeSim] ⏱️ tick médio=" + s_Report.TickAvgMs + "ms | p95=" + s_Report.TickP95Ms + "ms | max=" + s_Report.TickMaxMs + "ms | ocupado=" + s_Report.BusyPercent + "%");
+		Print("[AskalTradeSim] 💾 leituras=" + s_Report.PlayerLoads + " | gravações=" + s_Report.PlayerSaves + " | por transação: " + s_Report.LoadsPerTransaction + " / " + s_Report.SavesPerTransaction);
+	}
+
+	protected static int GetHistogramCount(string name)
+	{
+		AskalMetricHistogram histogram = AskalMetrics.GetHistogram(name);
+		if (!histogram)
+			return 0;
+		return histogram.Count;
+	}
+
+	protected static void WriteReport(AskalTradeSimReport report)
+	{
+		MakeDirectory("$profile:Askal");
+		MakeDirectory("$profile:Askal/Benchmark");
+		MakeDirectory(REPORTS_DIRECTORY);
+
+		string reportPath = REPORTS_DIRECTORY + "trade_" + AskalLog.FormatTimestamp("", "_", "") + ".json";
+		if (AskalJsonLoader<AskalTradeSimReport>.SaveToFile(reportPath, report))
+		{
+			AskalJsonLoader<AskalTradeSimReport>.SaveToFile(REPORTS_DIRECTORY + "trade_latest.json", report);
+			Print("[AskalTradeSim] 📝 Relatório: " + reportPath);
+		}
+	}
+}
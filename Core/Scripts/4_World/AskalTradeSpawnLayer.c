@@ -0,0 +1,90 @@
+// ==========================================
+// AskalTradeSpawnLayer - Onde a compra cria e a venda remove entidades (servidor)
+// Padrão: inventário do player real. O simulador de carga registra um
+// AskalTradeSpawnLayerStub só para os SteamIDs sintéticos dele (sem PlayerIdentity);
+// jogadores reais continuam sempre na camada padrão
+// ==========================================
+
+class AskalTradeSpawnLayer
+{
+	protected static ref AskalTradeSpawnLayer s_Instance;
+	protected static ref AskalTradeSpawnLayer s_SimulatedLayer;
+	protected static string s_SimulatedPrefix;
+
+	static AskalTradeSpawnLayer GetInstance()
+	{
+		if (!s_Instance)
+			s_Instance = new AskalTradeSpawnLayer();
+		return s_Instance;
+	}
+
+	// Camada da transação: com PlayerIdentity é sempre a padrão
+	static AskalTradeSpawnLayer Resolve(PlayerIdentity identity, string steamId)
+	{
+		if (!identity && IsSimulatedSteamId(steamId))
+			return s_SimulatedLayer;
+		return GetInstance();
+	}
+
+	// NULL remove a camada simulada
+	static void SetSimulatedLayer(AskalTradeSpawnLayer layer, string steamIdPrefix)
+	{
+		s_SimulatedLayer = layer;
+		s_SimulatedPrefix = steamIdPrefix;
+		if (!layer)
+			s_SimulatedPrefix = "";
+	}
+
+	static bool IsSimulatedSteamId(string steamId)
+	{
+		if (!s_SimulatedLayer || s_SimulatedPrefix == "" || !steamId)
+			return false;
+		return steamId.IndexOf(s_SimulatedPrefix) == 0;
+	}
+
+	// false = transações podem rodar sem PlayerIdentity/PlayerBase (só steamId)
+	bool RequiresPlayer()
+	{
+		return true;
+	}
+
+	bool CreateInInventory(PlayerBase player, string itemClass, out EntityAI created)
+	{
+		created = NULL;
+		if (!player)
+			return false;
+
+		created = player.GetInventory().CreateInInventory(itemClass);
+		return created != NULL;
+	}
+
+	void DeleteEntity(EntityAI entity)
+	{
+		if (entity)
+			GetGame().ObjectDelete(entity);
+	}
+}
+
+// Não cria entidades: só conta (balance, preços e I/O continuam reais)
+class AskalTradeSpawnLayerStub extends AskalTradeSpawnLayer
+{
+	int CreatedCount;
+	int DeletedCount;
+
+	override bool RequiresPlayer()
+	{
+		return false;
+	}
+
+	override bool CreateInInventory(PlayerBase player, string itemClass, out EntityAI created)
+	{
+		created = NULL;
+		CreatedCount++;
+		return true;
+	}
+
+	override void DeleteEntity(EntityAI entity)
+	{
+		DeletedCount++;
+	}
+}
@@ -6,6 +6,7 @@
 class AskalTraderSpawnService
 {
 	protected static ref array<ref AskalTraderBase> s_SpawnedTraders;
+	protected static int s_PendingSetups = 0; // Spawnados aguardando SetupTraderStatic
 	
 	static void Init()
 	{
@@ -53,6 +54,12 @@ class AskalTraderSpawnService
 		Print("[AskalTrader] ========================================");
 	}
 	
+	// Traders cujo SetupTraderStatic ainda não rodou (AskalServerBoot espera zerar)
+	static int GetPendingSetupCount()
+	{
+		return s_PendingSetups;
+	}
+	
 	// Encontrar arquivos de trader
 	static void FindTraderFiles(string path, out array<string> files)
 	{
@@ -150,6 +157,7 @@ class AskalTraderSpawnService
 		traderObj.SetOrientation(orientation);
 		
 		// Configurar como trader após inicialização
+		s_PendingSetups++;
 		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(SetupTraderStatic, 50, false, traderObj, fileName);
 		
 		Print("[AskalTrader] ✅ Trader estático spawnado: " + config.TraderName + " (" + config.TraderObject + ") em " + config.GetPosition());
@@ -160,6 +168,9 @@ class AskalTraderSpawnService
 	// Configurar objeto estático como trader
 	static void SetupTraderStatic(Object obj, string configFileName)
 	{
+		if (s_PendingSetups > 0)
+			s_PendingSetups--;
+		
 		if (!obj)
 			return;
 		
@@ -291,6 +302,36 @@ class AskalTraderSpawnService
 		}
 	}
 	
+	// Relê o JSON do trader e troca a config de cada trader spawnado a partir dele
+	// (SetupItems/moedas são substituídos de uma vez; quem segura a config antiga não é afetado)
+	static int ReloadTraderConfig(string fileName)
+	{
+		Init();
+		
+		AskalTraderConfig config = AskalTraderConfig.Load(fileName);
+		if (!config)
+		{
+			Print("[AskalTrader] ❌ Falha ao recarregar config: " + fileName);
+			return 0;
+		}
+		
+		int updated = 0;
+		foreach (AskalTraderBase traderLogic : s_SpawnedTraders)
+		{
+			if (!traderLogic || !traderLogic.GetConfig())
+				continue;
+			
+			if (traderLogic.GetConfig().m_FileName != config.m_FileName)
+				continue;
+			
+			traderLogic.LoadConfig(config);
+			updated++;
+		}
+		
+		Print("[AskalTrader] 🔄 Config recarregada: " + config.TraderName + " (" + updated + " traders)");
+		return updated;
+	}
+	
 	// Marcar entidade como trader (usando helper)
 	static void MarkAsTrader(Object obj, AskalTraderBase traderLogic)
 	{
@@ -120,7 +120,8 @@ class AskalTraderValidationHelper
 		if (traderSetupItems && traderSetupItems.Contains(itemClassname))
 		{
 			int itemMode = traderSetupItems.Get(itemClassname);
-			Print("[AskalTraderValidation] ✅ PRIORIDADE 1 (ITEM): Item '" + itemClassname + "' encontrado em SetupItems (exato) com modo: " + itemMode);
+			if (AskalLog.IsEnabled("TraderValidation", AskalLog.TRACE))
+				AskalLog.Trace("TraderValidation", "✅ PRIORIDADE 1 (ITEM): Item '" + itemClassname + "' encontrado em SetupItems (exato) com modo: " + itemMode);
 			return itemMode;
 		}
 		
@@ -141,7 +142,8 @@ class AskalTraderValidationHelper
 				if (keyLower == itemLower)
 				{
 					int foundItemMode = traderSetupItems.Get(key);
-					Print("[AskalTraderValidation] ✅ PRIORIDADE 1 (ITEM): Item '" + itemClassname + "' encontrado em SetupItems como '" + key + "' (case-insensitive) com modo: " + foundItemMode);
+					if (AskalLog.IsEnabled("TraderValidation", AskalLog.TRACE))
+						AskalLog.Trace("TraderValidation", "✅ PRIORIDADE 1 (ITEM): Item '" + itemClassname + "' encontrado em SetupItems como '" + key + "' (case-insensitive) com modo: " + foundItemMode);
 					return foundItemMode;
 				}
 			}
@@ -154,14 +156,16 @@ class AskalTraderValidationHelper
 			if (traderSetupCategories && traderSetupCategories.Contains(normalizedCategoryID))
 			{
 				int catMode = traderSetupCategories.Get(normalizedCategoryID);
-				Print("[AskalTraderValidation] ✅ PRIORIDADE 2 (CATEGORY): Categoria '" + normalizedCategoryID + "' encontrada em SetupCategories com modo: " + catMode);
+				if (AskalLog.IsEnabled("TraderValidation", AskalLog.TRACE))
+					AskalLog.Trace("TraderValidation", "✅ PRIORIDADE 2 (CATEGORY): Categoria '" + normalizedCategoryID + "' encontrada em SetupCategories com modo: " + catMode);
 				return catMode;
 			}
 			// Fallback para SetupItems (compatibilidade)
 			if (traderSetupItems && traderSetupItems.Contains(normalizedCategoryID))
 			{
 				int catModeFromItems = traderSetupItems.Get(normalizedCategoryID);
-				Print("[AskalTraderValidation] ✅ PRIORIDADE 2 (CATEGORY): Categoria '" + normalizedCategoryID + "' encontrada em SetupItems com modo: " + catModeFromItems);
+				if (AskalLog.IsEnabled("TraderValidation", AskalLog.TRACE))
+					AskalLog.Trace("TraderValidation", "✅ PRIORIDADE 2 (CATEGORY): Categoria '" + normalizedCategoryID + "' encontrada em SetupItems com modo: " + catModeFromItems);
 				return catModeFromItems;
 			}
 		}
@@ -173,14 +177,16 @@ class AskalTraderValidationHelper
 			if (traderSetupDatasets && traderSetupDatasets.Contains(normalizedDatasetID))
 			{
 				int dsMode = traderSetupDatasets.Get(normalizedDatasetID);
-				Print("[AskalTraderValidation] ✅ PRIORIDADE 3 (DATASET): Dataset '" + normalizedDatasetID + "' encontrado em SetupDatasets com modo: " + dsMode);
+				if (AskalLog.IsEnabled("TraderValidation", AskalLog.TRACE))
+					AskalLog.Trace("TraderValidation", "✅ PRIORIDADE 3 (DATASET): Dataset '" + normalizedDatasetID + "' encontrado em SetupDatasets com modo: " + dsMode);
 				return dsMode;
 			}
 			// Fallback para SetupItems (compatibilidade)
 			if (traderSetupItems && traderSetupItems.Contains(normalizedDatasetID))
 			{
 				int dsModeFromItems = traderSetupItems.Get(normalizedDatasetID);
-				Print("[AskalTraderValidation] ✅ PRIORIDADE 3 (DATASET): Dataset '" + normalizedDatasetID + "' encontrado em SetupItems com modo: " + dsModeFromItems);
+				if (AskalLog.IsEnabled("TraderValidation", AskalLog.TRACE))
+					AskalLog.Trace("TraderValidation", "✅ PRIORIDADE 3 (DATASET): Dataset '" + normalizedDatasetID + "' encontrado em SetupItems com modo: " + dsModeFromItems);
 				return dsModeFromItems;
 			}
 		}
@@ -189,7 +195,8 @@ class AskalTraderValidationHelper
 		if (traderSetupItems && traderSetupItems.Contains("ALL"))
 		{
 			int allMode = traderSetupItems.Get("ALL");
-			Print("[AskalTraderValidation] ✅ PRIORIDADE 4 (ALL): 'ALL' encontrado em SetupItems com modo: " + allMode);
+			if (AskalLog.IsEnabled("TraderValidation", AskalLog.TRACE))
+				AskalLog.Trace("TraderValidation", "✅ PRIORIDADE 4 (ALL): 'ALL' encontrado em SetupItems com modo: " + allMode);
 			return allMode;
 		}
 		
@@ -217,7 +224,7 @@ class AskalTraderValidationHelper
 		ItemData itemData = AskalDatabase.GetItemCaseInsensitive(itemClassName);
 		if (!itemData)
 		{
-			Print("[AskalTraderValidation] ⚠️ Item não encontrado no database: " + itemClassName);
+			AskalLog.Warn("TraderValidation", "⚠️ Item não encontrado no database: " + itemClassName);
 			return;
 		}
 		
@@ -268,7 +275,7 @@ class AskalTraderValidationHelper
 			}
 		}
 		
-		Print("[AskalTraderValidation] ⚠️ Dataset/Categoria não encontrados para item: " + itemClassName);
+		AskalLog.Warn("TraderValidation", "⚠️ Dataset/Categoria não encontrados para item: " + itemClassName);
 	}
 	
 	// Verificar se item pode ser comprado
@@ -284,32 +291,36 @@ class AskalTraderValidationHelper
 		AskalTraderConfig config = AskalTraderConfig.LoadByTraderName(traderName);
 		if (!config || !config.SetupItems)
 		{
-			Print("[AskalTraderValidation] ⚠️ Trader não encontrado ou sem SetupItems: " + traderName);
+			AskalLog.Warn("TraderValidation", "⚠️ Trader não encontrado ou sem SetupItems: " + traderName);
 			return false; // Se trader existe mas não tem config, bloquear por segurança
 		}
 		
 		// Se dataset/category não foram fornecidos, tentar resolver
 		if (datasetID == "" || categoryID == "")
 		{
-			Print("[AskalTraderValidation] 🔍 Resolvendo dataset/categoria para: " + itemClassName);
+			if (AskalLog.IsEnabled("TraderValidation", AskalLog.DEBUG))
+				AskalLog.Debug("TraderValidation", "🔍 Resolvendo dataset/categoria para: " + itemClassName);
 			ResolveDatasetAndCategoryForClass(itemClassName, datasetID, categoryID);
-			Print("[AskalTraderValidation] 🔍 Resolvido - Dataset: " + datasetID + " | Categoria: " + categoryID);
+			if (AskalLog.IsEnabled("TraderValidation", AskalLog.DEBUG))
+				AskalLog.Debug("TraderValidation", "🔍 Resolvido - Dataset: " + datasetID + " | Categoria: " + categoryID);
 		}
 		
 		// Obter modo do item
 		int itemMode = GetItemMode(config.SetupItems, datasetID, categoryID, itemClassName);
-		Print("[AskalTraderValidation] 🔍 Modo do item: " + itemMode + " (DS: " + datasetID + ", CAT: " + categoryID + ", Item: " + itemClassName + ")");
+		if (AskalLog.IsEnabled("TraderValidation", AskalLog.DEBUG))
+			AskalLog.Debug("TraderValidation", "🔍 Modo do item: " + itemMode + " (DS: " + datasetID + ", CAT: " + categoryID + ", Item: " + itemClassName + ")");
 		
 		// Modo 1 (Buy Only) ou 3 (Buy + Sell) permitem compra
 		bool canBuy = (itemMode == 1 || itemMode == 3);
 		
 		if (!canBuy)
 		{
-			Print("[AskalTraderValidation] ❌ Item não pode ser comprado: " + itemClassName + " (modo: " + itemMode + ") no trader: " + traderName);
+			AskalLog.Error("TraderValidation", "❌ Item não pode ser comprado: " + itemClassName + " (modo: " + itemMode + ") no trader: " + traderName);
 		}
 		else
 		{
-			Print("[AskalTraderValidation] ✅ Item pode ser comprado: " + itemClassName + " (modo: " + itemMode + ")");
+			if (AskalLog.IsEnabled("TraderValidation", AskalLog.DEBUG))
+				AskalLog.Debug("TraderValidation", "✅ Item pode ser comprado: " + itemClassName + " (modo: " + itemMode + ")");
 		}
 		
 		return canBuy;
@@ -328,35 +339,53 @@ class AskalTraderValidationHelper
 		AskalTraderConfig config = AskalTraderConfig.LoadByTraderName(traderName);
 		if (!config || !config.SetupItems)
 		{
-			Print("[AskalTraderValidation] ⚠️ Trader não encontrado ou sem SetupItems: " + traderName);
+			AskalLog.Warn("TraderValidation", "⚠️ Trader não encontrado ou sem SetupItems: " + traderName);
 			return false; // Se trader existe mas não tem config, bloquear por segurança
 		}
 		
 		// Se dataset/category não foram fornecidos, tentar resolver
 		if (datasetID == "" || categoryID == "")
 		{
-			Print("[AskalTraderValidation] 🔍 Resolvendo dataset/categoria para: " + itemClassName);
+			if (AskalLog.IsEnabled("TraderValidation", AskalLog.DEBUG))
+				AskalLog.Debug("TraderValidation", "🔍 Resolvendo dataset/categoria para: " + itemClassName);
 			ResolveDatasetAndCategoryForClass(itemClassName, datasetID, categoryID);
-			Print("[AskalTraderValidation] 🔍 Resolvido - Dataset: " + datasetID + " | Categoria: " + categoryID);
+			if (AskalLog.IsEnabled("TraderValidation", AskalLog.DEBUG))
+				AskalLog.Debug("TraderValidation", "🔍 Resolvido - Dataset: " + datasetID + " | Categoria: " + categoryID);
 		}
 		
 		// Obter modo do item
 		int itemMode = GetItemMode(config.SetupItems, datasetID, categoryID, itemClassName);
-		Print("[AskalTraderValidation] 🔍 Modo do item: " + itemMode + " (DS: " + datasetID + ", CAT: " + categoryID + ", Item: " + itemClassName + ")");
+		if (AskalLog.IsEnabled("TraderValidation", AskalLog.DEBUG))
+			AskalLog.Debug("TraderValidation", "🔍 Modo do item: " + itemMode + " (DS: " + datasetID + ", CAT: " + categoryID + ", Item: " + itemClassName + ")");
 		
 		// Modo 2 (Sell Only) ou 3 (Buy + Sell) permitem venda
 		bool canSell = (itemMode == 2 || itemMode == 3);
 		
 		if (!canSell)
 		{
-			Print("[AskalTraderValidation] ❌ Item não pode ser vendido: " + itemClassName + " (modo: " + itemMode + ") no trader: " + traderName);
+			AskalLog.Error("TraderValidation", "❌ Item não pode ser vendido: " + itemClassName + " (modo: " + itemMode + ") no trader: " + traderName);
 		}
 		else
 		{
-			Print("[AskalTraderValidation] ✅ Item pode ser vendido: " + itemClassName + " (modo: " + itemMode + ")");
+			if (AskalLog.IsEnabled("TraderValidation", AskalLog.DEBUG))
+				AskalLog.Debug("TraderValidation", "✅ Item pode ser vendido: " + itemClassName + " (modo: " + itemMode + ")");
 		}
 		
 		return canSell;
 	}
+	
+	// Mesma regra do CanSellItem com a config já carregada e sem logs por item
+	// (a cotação do inventário carrega o trader uma vez e testa cada classe)
+	static bool CanSellItemWithConfig(AskalTraderConfig config, string itemClassName, string datasetID = "", string categoryID = "")
+	{
+		if (!config || !config.SetupItems)
+			return false;
+		
+		if (datasetID == "" || categoryID == "")
+			ResolveDatasetAndCategoryForClass(itemClassName, datasetID, categoryID);
+		
+		int itemMode = GetItemMode(config.SetupItems, datasetID, categoryID, itemClassName);
+		return itemMode == 2 || itemMode == 3;
+	}
 }
 
@@ -0,0 +1,245 @@
+// ==========================================
+// AskalCatalogBenchmark - Catálogo sintético + benchmark do loader (servidor)
+// Ativado por -askalBenchmark=1k,10k,50k (rótulo opcional: -askalBenchmarkLabel=<build>)
+// Gera datasets no formato JsonDataset em $profile:Askal/Benchmark/Catalog_<itens>/,
+// mede cada fase do carregamento e grava $profile:Askal/Benchmark/Reports/*.json
+// ==========================================
+
+class AskalCatalogBenchmarkResult
+{
+	string Name;
+	int Items;
+	int Files;
+	int Categories;
+	float GenerateMs;
+	float LoadAllRecursiveMs;   // AskalDatabaseLoader.LoadAllDatasetsRecursive (ponta a ponta)
+	float JsonParseMs;          // AskalJsonLoader<JsonDataset>.LoadFromFile (leitura + parse)
+	float FromJsonMs;           // Dataset.FromJson
+	float ItemsPerSecond;       // Itens por segundo no LoadAllDatasetsRecursive
+}
+
+class AskalCatalogBenchmarkReport
+{
+	string Label;
+	string Timestamp;
+	ref array<ref AskalCatalogBenchmarkResult> Results;
+
+	void AskalCatalogBenchmarkReport()
+	{
+		Results = new array<ref AskalCatalogBenchmarkResult>();
+	}
+}
+
+class AskalCatalogBenchmark
+{
+	static const string CLI_PARAM = "askalBenchmark";
+	static const string CLI_LABEL_PARAM = "askalBenchmarkLabel";
+	protected static const string BENCHMARK_ROOT = "$profile:Askal/Benchmark/";
+	protected static const string REPORTS_DIRECTORY = "$profile:Askal/Benchmark/Reports/";
+
+	// Forma do catálogo gerado
+	protected static const int ITEMS_PER_CATEGORY = 50;
+	protected static const int CATEGORIES_PER_DATASET = 20;   // 1000 itens por arquivo
+	protected static const int VARIANT_EVERY = 4;             // 1 a cada 4 itens com 2 variantes
+	protected static const int ATTACHMENT_EVERY = 5;          // 1 a cada 5 itens com 3 attachments
+
+	// Roda o benchmark se o parâmetro de lançamento estiver presente
+	static bool RunFromCommandLine()
+	{
+		string sizesParam;
+		if (!GetCLIParam(CLI_PARAM, sizesParam) || sizesParam == "")
+			return false;
+
+		string label;
+		if (!GetCLIParam(CLI_LABEL_PARAM, label))
+			label = "";
+
+		array<int> sizes = ParseSizes(sizesParam);
+		if (sizes.Count() == 0)
+		{
+			Print("[AskalBenchmark] ⚠️ -" + CLI_PARAM + " sem tamanhos válidos: " + sizesParam);
+			return false;
+		}
+
+		Run(sizes, label);
+		return true;
+	}
+
+	// "1k,10k,50k" ou "1000,10000" -> quantidades de itens
+	static array<int> ParseSizes(string sizesParam)
+	{
+		array<int> sizes = new array<int>();
+		array<string> tokens = new array<string>();
+		sizesParam.Split(",", tokens);
+		foreach (string token : tokens)
+		{
+			string sizeToken = token;
+			sizeToken.TrimInPlace();
+			sizeToken.ToLower();
+			if (sizeToken == "")
+				continue;
+
+			int multiplier = 1;
+			if (sizeToken.Substring(sizeToken.Length() - 1, 1) == "k")
+			{
+				multiplier = 1000;
+				sizeToken = sizeToken.Substring(0, sizeToken.Length() - 1);
+			}
+
+			int size = sizeToken.ToInt() * multiplier;
+			if (size > 0)
+				sizes.Insert(size);
+		}
+		return sizes;
+	}
+
+	static void Run(array<int> sizes, string label)
+	{
+		Print("[AskalBenchmark] ========================================");
+		Print("[AskalBenchmark] 🏁 Benchmark do loader: " + sizes.Count() + " tamanhos");
+
+		MakeDirectory("$profile:Askal");
+		MakeDirectory(BENCHMARK_ROOT);
+		MakeDirectory(REPORTS_DIRECTORY);
+
+		AskalCatalogBenchmarkReport report = new AskalCatalogBenchmarkReport();
+		report.Label = label;
+		report.Timestamp = AskalLog.FormatTimestamp("-", "T", ":");
+
+		// O catálogo real é preservado: cada rodada carrega num mapa vazio
+		map<string, ref Dataset> liveDatasets = AskalDatabase.m_Datasets;
+
+		foreach (int itemCount : sizes)
+		{
+			AskalCatalogBenchmarkResult result = RunSize(itemCount);
+			report.Results.Insert(result);
+			Print("[AskalBenchmark] ✅ " + result.Name + ": gerar=" + result.GenerateMs + "ms | load=" + result.LoadAllRecursiveMs + "ms | parse=" + result.JsonParseMs + "ms | FromJson=" + result.FromJsonMs + "ms | " + result.ItemsPerSecond + " itens/s");
+		}
+
+		AskalDatabase.m_Datasets = liveDatasets;
+		AskalDatabase.m_Revision++;
+
+		WriteReport(report);
+		Print("[AskalBenchmark] ========================================");
+	}
+
+	protected static AskalCatalogBenchmarkResult RunSize(int itemCount)
+	{
+		AskalCatalogBenchmarkResult result = new AskalCatalogBenchmarkResult();
+		result.Name = "Catalog_" + itemCount;
+		result.Items = itemCount;
+
+		string catalogPath = BENCHMARK_ROOT + result.Name + "/";
+
+		int generateStart = TickCount(0);
+		result.Files = Generate(catalogPath, itemCount);
+		result.GenerateMs = TickCount(generateStart) / 10000.0;
+
+		// Fase 1: loader completo (FindFile + parse + FromJson + registro + logs)
+		AskalDatabase.m_Datasets = new map<string, ref Dataset>();
+		int loadStart = TickCount(0);
+		AskalDatabaseLoader.LoadAllDatasetsRecursive(catalogPath);
+		result.LoadAllRecursiveMs = TickCount(loadStart) / 10000.0;
+
+		foreach (string datasetId, Dataset loadedDataset : AskalDatabase.m_Datasets)
+		{
+			if (loadedDataset && loadedDataset.Categories)
+				result.Categories += loadedDataset.Categories.Count();
+		}
+		if (result.LoadAllRecursiveMs > 0)
+			result.ItemsPerSecond = itemCount / (result.LoadAllRecursiveMs / 1000.0);
+
+		// Fases 2 e 3: parse e conversão isolados, arquivo por arquivo
+		for (int fileIdx = 0; fileIdx < result.Files; fileIdx++)
+		{
+			string filePath = catalogPath + GetDatasetName(fileIdx) + ".json";
+
+			JsonDataset jsonDataset = new JsonDataset();
+			int parseStart = TickCount(0);
+			bool parsed = AskalJsonLoader<JsonDataset>.LoadFromFile(filePath, jsonDataset, false);
+			result.JsonParseMs += TickCount(parseStart) / 10000.0;
+			if (!parsed)
+				continue;
+
+			int convertStart = TickCount(0);
+			Dataset.FromJson(jsonDataset);
+			result.FromJsonMs += TickCount(convertStart) / 10000.0;
+		}
+
+		AskalDatabase.m_Datasets.Clear();
+		return result;
+	}
+
+	// Gera itemCount itens em arquivos de ITEMS_PER_CATEGORY * CATEGORIES_PER_DATASET; retorna o número de arquivos
+	static int Generate(string catalogPath, int itemCount)
+	{
+		MakeDirectory(catalogPath);
+
+		int itemsPerFile = ITEMS_PER_CATEGORY * CATEGORIES_PER_DATASET;
+		int fileCount = 0;
+		int generated = 0;
+		while (generated < itemCount)
+		{
+			JsonDataset jsonDataset = new JsonDataset();
+			jsonDataset.Version = 1;
+			jsonDataset.DatasetName = GetDatasetName(fileCount);
+			jsonDataset.DisplayName = "Benchmark " + fileCount;
+			jsonDataset.Icon = "set:dayz_inventory image:missing";
+
+			int fileItems = Math.Min(itemsPerFile, itemCount - generated);
+			for (int catIdx = 0; catIdx * ITEMS_PER_CATEGORY < fileItems; catIdx++)
+			{
+				string categoryId = "CAT_Bench_" + fileCount + "_" + catIdx;
+				JsonCategory jsonCategory = new JsonCategory();
+				jsonCategory.DisplayName = "BENCH " + catIdx;
+				jsonCategory.BasePrice = 100 + catIdx;
+				jsonCategory.SellPercent = 50;
+
+				int categoryItems = Math.Min(ITEMS_PER_CATEGORY, fileItems - catIdx * ITEMS_PER_CATEGORY);
+				for (int itemIdx = 0; itemIdx < categoryItems; itemIdx++)
+				{
+					int globalIdx = generated + catIdx * ITEMS_PER_CATEGORY + itemIdx;
+					string className = "Bench_Item_" + globalIdx;
+
+					JsonItemEntry jsonItem = new JsonItemEntry();
+					jsonItem.BasePrice = 10 + (globalIdx % 990);
+					if (globalIdx % VARIANT_EVERY == 0)
+					{
+						jsonItem.Variants.Insert(className + "_Black");
+						jsonItem.Variants.Insert(className + "_Green");
+					}
+					if (globalIdx % ATTACHMENT_EVERY == 0)
+					{
+						jsonItem.Attachments.Insert("Bench_Attachment_" + (globalIdx % 17));
+						jsonItem.Attachments.Insert("Bench_Attachment_" + (globalIdx % 23));
+						jsonItem.Attachments.Insert("Bench_Attachment_" + (globalIdx % 29));
+					}
+					jsonCategory.Items.Insert(className, jsonItem);
+				}
+
+				jsonDataset.Categories.Insert(categoryId, jsonCategory);
+				jsonDataset.CategoryOrder.Insert(categoryId);
+			}
+
+			AskalJsonLoader<JsonDataset>.SaveToFile(catalogPath + jsonDataset.DatasetName + ".json", jsonDataset);
+			generated += fileItems;
+			fileCount++;
+		}
+		return fileCount;
+	}
+
+	protected static string GetDatasetName(int fileIdx)
+	{
+		return "DS_Bench_" + fileIdx.ToStringLen(3);
+	}
+
+	protected static void WriteReport(AskalCatalogBenchmarkReport report)
+	{
+		string reportPath = REPORTS_DIRECTORY + "catalog_" + AskalLog.FormatTimestamp("", "_", "") + ".json";
+		if (AskalJsonLoader<AskalCatalogBenchmarkReport>.SaveToFile(reportPath, report))
+		{
+			AskalJsonLoader<AskalCatalogBenchmarkReport>.SaveToFile(REPORTS_DIRECTORY + "catalog_latest.json", report);
+			Print("[AskalBenchmark] 📝 Relatório: " + reportPath);
+		}
+	}
+}
@@ -0,0 +1,436 @@
+// ==========================================
+// AskalHotReload - Recarrega datasets e configs sem reiniciar o servidor
+// Disparo: -askalHotReload=<segundos> (polling), RPC RequestHotReload (Admin)
+// ou AskalAPI.Reload() (AskalEventBus.RELOAD_REQUESTED)
+// Só arquivos cuja impressão digital (tamanho + hash, ver AskalConfigLocator)
+// mudou são relidos; o catálogo novo é montado à parte e trocado de uma vez,
+// então transações em andamento seguem com o snapshot/livro de preços anterior
+// Setups (Setup:<nome>) já lidos por algum AskalSetupResolver também são sondados;
+// quando mudam, os resolvers relêem os setups de arquivo no próximo uso
+// O polling só sonda POLL_PROBES_PER_CYCLE arquivos por ciclo (rodízio) mais a listagem
+// da pasta de datasets; o reload completo roda apenas quando a sonda acha mudança
+// ==========================================
+
+class AskalReloadFileState
+{
+	int Length;
+	int Fingerprint;
+	string DatasetID;   // Vazio para arquivos de trader
+
+	void AskalReloadFileState(int length, int fingerprint, string datasetID = "")
+	{
+		Length = length;
+		Fingerprint = fingerprint;
+		DatasetID = datasetID;
+	}
+}
+
+class AskalHotReloadReport
+{
+	int DatasetsChanged;
+	int DatasetsAdded;
+	int DatasetsRemoved;
+	int DatasetsFailed;    // Parse falhou: versão anterior continua ativa
+	int TradersReloaded;
+	int ConfigsReloaded;
+	float ElapsedMs;
+
+	bool HasChanges()
+	{
+		return DatasetsChanged + DatasetsAdded + DatasetsRemoved + TradersReloaded + ConfigsReloaded > 0;
+	}
+
+	string GetSummary()
+	{
+		return "datasets +" + DatasetsAdded + " ~" + DatasetsChanged + " -" + DatasetsRemoved + " (falhas " + DatasetsFailed + ") | traders " + TradersReloaded + " | configs " + ConfigsReloaded + " | " + ElapsedMs + "ms";
+	}
+}
+
+class AskalHotReload
+{
+	static const string CLI_POLL_PARAM = "askalHotReload";
+	protected static const int POLL_PROBES_PER_CYCLE = 4;
+
+	protected static ref AskalHotReload s_Instance;
+	protected static ref map<string, ref AskalReloadFileState> s_DatasetFiles; // caminho completo -> estado
+	protected static ref map<string, ref AskalReloadFileState> s_TraderFiles;  // nome do arquivo (sem .json) -> estado
+	protected static int s_ProbeCursor;
+
+	protected int m_PollIntervalMs;
+	protected bool m_ReloadScheduled;
+	protected ref array<PlayerIdentity> m_Requesters; // Admins aguardando o resultado do reload agendado
+
+	void AskalHotReload()
+	{
+		if (!GetGame().IsServer())
+			return;
+
+		m_Requesters = new array<PlayerIdentity>();
+		GetRPCManager().AddRPC("AskalCoreModule", "RequestHotReload", this, SingleplayerExecutionType.Server);
+		AskalEventBus.Get(AskalEventBus.RELOAD_REQUESTED).Insert(OnReloadRequested);
+
+		string pollParam;
+		if (GetCLIParam(CLI_POLL_PARAM, pollParam) && pollParam.ToInt() > 0)
+		{
+			m_PollIntervalMs = pollParam.ToInt() * 1000;
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(Poll, m_PollIntervalMs, true);
+			Print("[AskalHotReload] 👀 Verificando alterações a cada " + pollParam.ToInt() + "s");
+		}
+	}
+
+	void ~AskalHotReload()
+	{
+		if (GetGame())
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Poll);
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(RunRequestedReload);
+		}
+		AskalEventBus.Get(AskalEventBus.RELOAD_REQUESTED).Remove(OnReloadRequested);
+	}
+
+	static AskalHotReload GetInstance()
+	{
+		if (!s_Instance)
+			s_Instance = new AskalHotReload();
+		return s_Instance;
+	}
+
+	// ========================================
+	// Linha de base (registrada pelo AskalServerBoot)
+	// ========================================
+	// Impressão digital calculada pelo loader na mesma leitura do parse
+	static void TrackDatasetFile(string fullPath, string datasetID, int length, int fingerprint)
+	{
+		if (!s_DatasetFiles)
+			s_DatasetFiles = new map<string, ref AskalReloadFileState>();
+
+		s_DatasetFiles.Set(fullPath, new AskalReloadFileState(length, fingerprint, datasetID));
+	}
+
+	static void TrackTraderFile(string fileName)
+	{
+		if (!s_TraderFiles)
+			s_TraderFiles = new map<string, ref AskalReloadFileState>();
+
+		int length;
+		int fingerprint;
+		AskalConfigLocator.ReadFingerprint(AskalTraderConfig.GetTradersPath() + fileName + ".json", length, fingerprint);
+		s_TraderFiles.Set(fileName, new AskalReloadFileState(length, fingerprint));
+	}
+
+	// ========================================
+	// Disparos
+	// ========================================
+	protected void Poll()
+	{
+		if (AskalServerBoot.IsRunning())
+			return;
+
+		if (!ProbeForChanges())
+			return;
+
+		AskalHotReloadReport report = Reload();
+		if (report && report.HasChanges())
+			AskalLog.Info("HotReload", "🔄 Alterações detectadas: " + report.GetSummary());
+	}
+
+	// Sonda barata: arquivos novos/removidos na pasta de datasets (só listagem) e a
+	// impressão digital de alguns arquivos por ciclo, em rodízio
+	protected static bool ProbeForChanges()
+	{
+		if (!s_DatasetFiles)
+			s_DatasetFiles = new map<string, ref AskalReloadFileState>();
+
+		string datasetPath = AskalDatabase.GetDatabasePath();
+		array<string> datasetFiles = new array<string>();
+		if (datasetPath && datasetPath != "" && FileExist(datasetPath))
+			AskalDatabaseLoader.CollectDatasetFiles(datasetPath, datasetFiles);
+
+		if (datasetFiles.Count() != s_DatasetFiles.Count())
+			return true;
+		foreach (string listedPath : datasetFiles)
+		{
+			if (!s_DatasetFiles.Contains(listedPath))
+				return true;
+		}
+
+		int traderCount = 0;
+		if (s_TraderFiles)
+			traderCount = s_TraderFiles.Count();
+
+		array<string> setupNames = new array<string>();
+		AskalConfigLocator.GetResolvedSetups(setupNames);
+
+		// Sondas: 2 configs + setups + datasets + traders
+		int probeCount = 2 + setupNames.Count() + datasetFiles.Count() + traderCount;
+		int probesThisCycle = Math.Min(POLL_PROBES_PER_CYCLE, probeCount);
+		for (int p = 0; p < probesThisCycle; p++)
+		{
+			int probeIndex = s_ProbeCursor % probeCount;
+			s_ProbeCursor = (s_ProbeCursor + 1) % probeCount;
+			if (ProbeChanged(probeIndex, setupNames, datasetFiles))
+				return true;
+		}
+		return false;
+	}
+
+	protected static bool ProbeChanged(int probeIndex, array<string> setupNames, array<string> datasetFiles)
+	{
+		if (probeIndex == 0)
+			return AskalConfigLocator.IsStale(AskalConfigLocator.MARKET_CONFIG);
+		if (probeIndex == 1)
+			return AskalConfigLocator.IsStale(AskalConfigLocator.VIRTUAL_STORE_CONFIG);
+
+		int setupIndex = probeIndex - 2;
+		if (setupIndex < setupNames.Count())
+			return AskalConfigLocator.IsStale(setupNames.Get(setupIndex));
+
+		string probePath;
+		AskalReloadFileState probeState;
+		int datasetIndex = setupIndex - setupNames.Count();
+		if (datasetIndex < datasetFiles.Count())
+		{
+			probePath = datasetFiles.Get(datasetIndex);
+			probeState = s_DatasetFiles.Get(probePath);
+		}
+		else
+		{
+			string traderFile = s_TraderFiles.GetKey(datasetIndex - datasetFiles.Count());
+			probePath = AskalTraderConfig.GetTradersPath() + traderFile + ".json";
+			probeState = s_TraderFiles.Get(traderFile);
+		}
+
+		if (!probeState)
+			return true;
+
+		int length;
+		int fingerprint;
+		AskalConfigLocator.ReadFingerprint(probePath, length, fingerprint);
+		return length != probeState.Length || fingerprint != probeState.Fingerprint;
+	}
+
+	protected void OnReloadRequested(Param payload)
+	{
+		if (AskalServerBoot.IsRunning())
+		{
+			AskalLog.Warn("HotReload", "⚠️ Reload ignorado: boot em andamento");
+			return;
+		}
+
+		AskalHotReloadReport report = Reload();
+		if (report)
+			AskalLog.Info("HotReload", "🔄 Reload solicitado: " + report.GetSummary());
+	}
+
+	// RPC Handler: admin pede reload; o reload roda fora do handler (próximo frame) e
+	// pedidos que chegam enquanto ele está agendado recebem o mesmo resultado
+	void RequestHotReload(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)
+	{
+		if (type != CallType.Server || !sender)
+			return;
+
+		if (!AskalRequestLimiter.TryAcquire(sender, AskalRequestLimiter.KIND_ADMIN))
+			return;
+
+		if (AskalPermissionCache.GetLevel(sender, AskalPerfConsoleModule.ADMIN_PERMISSION_KEY) < 1)
+		{
+			AskalLog.Warn("HotReload", "⚠️ RequestHotReload negado para: " + sender.GetName());
+			SendReloadResponse(sender, false, "Sem permissão (Permissions: " + AskalPerfConsoleModule.ADMIN_PERMISSION_KEY + ")");
+			return;
+		}
+
+		if (AskalServerBoot.IsRunning())
+		{
+			SendReloadResponse(sender, true, "Reload indisponível: boot em andamento");
+			return;
+		}
+
+		if (m_Requesters.Find(sender) == -1)
+			m_Requesters.Insert(sender);
+
+		if (m_ReloadScheduled)
+			return;
+
+		m_ReloadScheduled = true;
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(RunRequestedReload, 0, false);
+	}
+
+	protected void RunRequestedReload()
+	{
+		m_ReloadScheduled = false;
+
+		AskalHotReloadReport report = Reload();
+		AskalLog.Info("HotReload", "🔄 Reload solicitado por admin: " + report.GetSummary());
+
+		foreach (PlayerIdentity requester : m_Requesters)
+		{
+			if (requester)
+				SendReloadResponse(requester, true, "Hot reload: " + report.GetSummary());
+		}
+		m_Requesters.Clear();
+	}
+
+	// Resposta vai para o painel de performance
+	protected void SendReloadResponse(PlayerIdentity identity, bool authorized, string message)
+	{
+		array<string> lines = new array<string>();
+		lines.Insert(message);
+		AskalPerfConsoleModule.SendResponse(identity, authorized, lines);
+	}
+
+	// ========================================
+	// Reload
+	// ========================================
+	static AskalHotReloadReport Reload()
+	{
+		int startTicks = TickCount(0);
+		AskalHotReloadReport report = new AskalHotReloadReport();
+
+		ReloadConfigs(report);
+		ReloadDatasets(report);
+		ReloadTraders(report);
+
+		// Livros de preços novos no próximo Get (os antigos vivem enquanto alguém os segura);
+		// cache de sync e cotações de venda invalidam sozinhos pela revisão/build do livro
+		if (report.HasChanges())
+		{
+			AskalPriceBook.InvalidateAll();
+			AskalMetrics.Increment("reload.applied");
+		}
+
+		report.ElapsedMs = TickCount(startTicks) / 10000.0;
+		AskalMetrics.ObserveMs("reload.ms", report.ElapsedMs);
+		return report;
+	}
+
+	protected static void ReloadConfigs(AskalHotReloadReport report)
+	{
+		if (AskalConfigLocator.HasChanged(AskalConfigLocator.MARKET_CONFIG))
+		{
+			AskalMarketConfig.GetInstance().Reload();
+			report.ConfigsReloaded++;
+		}
+
+		if (AskalConfigLocator.HasChanged(AskalConfigLocator.VIRTUAL_STORE_CONFIG))
+		{
+			AskalVirtualStoreSettings.Reload();
+			report.ConfigsReloaded++;
+		}
+
+		array<string> setupNames = new array<string>();
+		AskalConfigLocator.GetResolvedSetups(setupNames);
+		int setupsChanged = 0;
+		foreach (string setupName : setupNames)
+		{
+			if (AskalConfigLocator.HasChanged(setupName))
+				setupsChanged++;
+		}
+
+		if (setupsChanged > 0)
+		{
+			AskalSetupResolver.InvalidateFileSetups();
+			report.ConfigsReloaded += setupsChanged;
+		}
+	}
+
+	// Monta o próximo catálogo reaproveitando os Datasets dos arquivos inalterados
+	protected static void ReloadDatasets(AskalHotReloadReport report)
+	{
+		if (!s_DatasetFiles)
+			s_DatasetFiles = new map<string, ref AskalReloadFileState>();
+
+		string datasetPath = AskalDatabase.GetDatabasePath();
+		if (!datasetPath || datasetPath == "" || !FileExist(datasetPath))
+			return;
+
+		array<string> datasetFiles = new array<string>();
+		AskalDatabaseLoader.CollectDatasetFiles(datasetPath, datasetFiles);
+
+		map<string, ref Dataset> nextDatasets = new map<string, ref Dataset>();
+		map<string, ref AskalReloadFileState> nextFiles = new map<string, ref AskalReloadFileState>();
+
+		foreach (string fullPath : datasetFiles)
+		{
+			int length;
+			int fingerprint;
+			AskalConfigLocator.ReadFingerprint(fullPath, length, fingerprint);
+
+			AskalReloadFileState previousState = s_DatasetFiles.Get(fullPath);
+			Dataset currentDataset = NULL;
+			if (previousState)
+				currentDataset = AskalDatabase.GetDataset(previousState.DatasetID);
+
+			if (previousState && previousState.Length == length && previousState.Fingerprint == fingerprint)
+			{
+				if (currentDataset)
+					nextDatasets.Set(currentDataset.DatasetID, currentDataset);
+				nextFiles.Set(fullPath, previousState);
+				continue;
+			}
+
+			// Guarda a impressão digital do texto efetivamente parseado
+			Dataset parsedDataset = AskalDatabaseLoader.ParseDatasetFile(fullPath, length, fingerprint);
+			if (!parsedDataset)
+			{
+				// Edição inválida: mantém a versão em uso e só tenta de novo quando o arquivo mudar outra vez
+				report.DatasetsFailed++;
+				string keptDatasetID = "";
+				if (currentDataset)
+				{
+					nextDatasets.Set(currentDataset.DatasetID, currentDataset);
+					keptDatasetID = currentDataset.DatasetID;
+				}
+				nextFiles.Set(fullPath, new AskalReloadFileState(length, fingerprint, keptDatasetID));
+				continue;
+			}
+
+			if (previousState)
+				report.DatasetsChanged++;
+			else
+				report.DatasetsAdded++;
+
+			nextDatasets.Set(parsedDataset.DatasetID, parsedDataset);
+			nextFiles.Set(fullPath, new AskalReloadFileState(length, fingerprint, parsedDataset.DatasetID));
+			AskalLog.Info("HotReload", "📄 Dataset relido: " + parsedDataset.DatasetID + " (" + fullPath + ")");
+		}
+
+		foreach (string trackedPath, AskalReloadFileState trackedState : s_DatasetFiles)
+		{
+			if (!nextFiles.Contains(trackedPath))
+			{
+				report.DatasetsRemoved++;
+				AskalLog.Info("HotReload", "🗑️ Dataset removido: " + trackedState.DatasetID + " (" + trackedPath + ")");
+			}
+		}
+
+		s_DatasetFiles = nextFiles;
+
+		if (report.DatasetsChanged + report.DatasetsAdded + report.DatasetsRemoved == 0)
+			return;
+
+		AskalDatabase.SwapDatasets(nextDatasets);
+		AskalMetrics.SetGauge("catalog.datasets", nextDatasets.Count());
+	}
+
+	// Só traders já spawnados; arquivos novos entram no próximo restart
+	protected static void ReloadTraders(AskalHotReloadReport report)
+	{
+		if (!s_TraderFiles)
+			return;
+
+		string tradersPath = AskalTraderConfig.GetTradersPath();
+		foreach (string fileName, AskalReloadFileState traderState : s_TraderFiles)
+		{
+			int length;
+			int fingerprint;
+			AskalConfigLocator.ReadFingerprint(tradersPath + fileName + ".json", length, fingerprint);
+			if (length == traderState.Length && fingerprint == traderState.Fingerprint)
+				continue;
+
+			traderState.Length = length;
+			traderState.Fingerprint = fingerprint;
+			if (AskalTraderSpawnService.ReloadTraderConfig(fileName) > 0)
+				report.TradersReloaded++;
+		}
+	}
+}
@@ -0,0 +1,355 @@
+// ==========================================
+// AskalMicroBenchmark - Microbenchmarks de preço e resolução de permissões (servidor)
+// Ativado por -askalMicroBench=<iterações> (rótulo opcional: -askalBenchmarkLabel=<build>)
+// Cada função roda N vezes sobre um catálogo sintético e um setup de trader sintético;
+// resultado em ns/op (TickCount: 1 tick = 100 ns, descontado o custo do laço vazio)
+// Comparação com $profile:Askal/Benchmark/Reports/micro_baseline.json (criado na primeira execução)
+// ==========================================
+
+class AskalMicroBenchResult
+{
+	string Name;
+	int Iterations;
+	float TotalMs;
+	float NsPerOp;
+	float BaselineNsPerOp;     // 0 = sem baseline para este caso
+	float Ratio;               // NsPerOp / BaselineNsPerOp
+	bool Regression;
+}
+
+class AskalMicroBenchReport
+{
+	string Label;
+	string Timestamp;
+	int CatalogItems;
+	int SetupEntries;
+	float LoopOverheadNs;
+	int Regressions;
+	ref array<ref AskalMicroBenchResult> Results;
+
+	void AskalMicroBenchReport()
+	{
+		Results = new array<ref AskalMicroBenchResult>();
+	}
+}
+
+class AskalMicroBenchmark
+{
+	static const string CLI_PARAM = "askalMicroBench";
+	protected static const string CATALOG_PATH = "$profile:Askal/Benchmark/Micro_Catalog/";
+	protected static const string REPORTS_DIRECTORY = "$profile:Askal/Benchmark/Reports/";
+	protected static const string BASELINE_FILE = "$profile:Askal/Benchmark/Reports/micro_baseline.json";
+
+	protected static const int DEFAULT_ITERATIONS = 20000;
+	protected static const int CATALOG_ITEMS = 2000;
+	protected static const float REGRESSION_RATIO = 1.25;
+
+	// Entradas pré-calculadas (índice i % Count)
+	protected static ref array<string> s_ItemClasses;
+	protected static ref array<string> s_ItemCategories;
+	protected static ref array<string> s_ItemDatasets;
+	protected static ref array<int> s_Amounts;
+	protected static ref map<string, int> s_SetupItems;
+	protected static ref array<ref AskalCurrencyValueConfig> s_Denominations;
+	protected static float s_LoopOverheadNs;
+
+	static bool RunFromCommandLine()
+	{
+		string iterationsParam;
+		if (!GetCLIParam(CLI_PARAM, iterationsParam) || iterationsParam == "")
+			return false;
+
+		int iterations = iterationsParam.ToInt();
+		if (iterations <= 1)
+			iterations = DEFAULT_ITERATIONS;
+
+		string label;
+		if (!GetCLIParam(AskalCatalogBenchmark.CLI_LABEL_PARAM, label))
+			label = "";
+
+		Run(iterations, label);
+		return true;
+	}
+
+	static void Run(int iterations, string label)
+	{
+		Print("[AskalMicroBench] ========================================");
+		Print("[AskalMicroBench] 🏁 Microbenchmarks: " + iterations + " iterações");
+
+		// Catálogo sintético no lugar do real (restaurado no fim)
+		map<string, ref Dataset> liveDatasets = AskalDatabase.m_Datasets;
+		MakeDirectory("$profile:Askal");
+		MakeDirectory("$profile:Askal/Benchmark");
+		AskalCatalogBenchmark.Generate(CATALOG_PATH, CATALOG_ITEMS);
+		AskalDatabase.m_Datasets = new map<string, ref Dataset>();
+		AskalDatabaseLoader.LoadAllDatasetsRecursive(CATALOG_PATH);
+		AskalDatabase.m_Revision++;
+
+		PrepareInputs();
+
+		AskalMicroBenchReport report = new AskalMicroBenchReport();
+		report.Label = label;
+		report.Timestamp = AskalLog.FormatTimestamp("-", "T", ":");
+		report.CatalogItems = s_ItemClasses.Count();
+		report.SetupEntries = s_SetupItems.Count();
+
+		s_LoopOverheadNs = MeasureLoopOverhead(iterations);
+		report.LoopOverheadNs = s_LoopOverheadNs;
+
+		report.Results.Insert(BenchComputeItemTotalPrice(iterations));
+		report.Results.Insert(BenchApplyBuyCoefficient(iterations));
+		report.Results.Insert(BenchResolveModeForItem(iterations));
+		report.Results.Insert(BenchResolveItemMode(iterations));
+		report.Results.Insert(BenchChangeTable(iterations));
+		report.Results.Insert(BenchCalculateChange(iterations));
+
+		AskalDatabase.m_Datasets = liveDatasets;
+		AskalDatabase.m_Revision++;
+
+		CompareWithBaseline(report);
+		foreach (AskalMicroBenchResult result : report.Results)
+		{
+			string status = "";
+			if (result.Regression)
+				status = " ⚠️ REGRESSÃO (" + result.Ratio + "x baseline)";
+			Print("[AskalMicroBench] " + result.Name + ": " + result.NsPerOp + " ns/op (" + result.Iterations + " iterações)" + status);
+		}
+
+		WriteReport(report);
+		Print("[AskalMicroBench] ========================================");
+	}
+
+	// ========================================
+	// Entradas sintéticas
+	// ========================================
+	protected static void PrepareInputs()
+	{
+		s_ItemClasses = new array<string>();
+		s_ItemCategories = new array<string>();
+		s_ItemDatasets = new array<string>();
+		s_Amounts = new array<int>();
+		s_SetupItems = new map<string, int>();
+
+		foreach (string datasetId, Dataset dataset : AskalDatabase.m_Datasets)
+		{
+			if (!dataset || !dataset.Categories)
+				continue;
+
+			// Setup típico de trader: alguns datasets e categorias inteiros, alguns itens avulsos
+			s_SetupItems.Set(datasetId, 2);
+			int categoryIdx = 0;
+			foreach (string categoryId, AskalCategory category : dataset.Categories)
+			{
+				if (categoryIdx % 4 == 0)
+					s_SetupItems.Set(categoryId, 1);
+				categoryIdx++;
+
+				if (!category || !category.Items)
+					continue;
+
+				foreach (string itemClass, ItemData itemData : category.Items)
+				{
+					int itemIdx = s_ItemClasses.Count();
+					s_ItemClasses.Insert(itemClass);
+					s_ItemCategories.Insert(categoryId);
+					s_ItemDatasets.Insert(datasetId);
+					s_Amounts.Insert(itemData.Price * (1 + itemIdx % 7));
+					if (itemIdx % 10 == 0)
+						s_SetupItems.Set(itemClass, 3);
+				}
+			}
+		}
+		s_SetupItems.Set("ALL", 0);
+
+		s_Denominations = new array<ref AskalCurrencyValueConfig>();
+		array<int> values = {1, 1000, 5, 500, 10, 100, 25, 50};
+		foreach (int value : values)
+		{
+			AskalCurrencyValueConfig denomination = new AskalCurrencyValueConfig();
+			denomination.Name = "MicroBench_Coin_" + value;
+			denomination.Value = value;
+			s_Denominations.Insert(denomination);
+		}
+	}
+
+	// ========================================
+	// Casos
+	// ========================================
+	protected static float MeasureLoopOverhead(int iterations)
+	{
+		int count = s_ItemClasses.Count();
+		int checksum = 0;
+		int startTicks = TickCount(0);
+		for (int i = 0; i < iterations; i++)
+		{
+			string itemClass = s_ItemClasses[i % count];
+			checksum += itemClass.Length();
+		}
+		return TickCount(startTicks) * 100.0 / iterations;
+	}
+
+	protected static AskalMicroBenchResult BenchComputeItemTotalPrice(int iterations)
+	{
+		string currencyId = AskalVirtualStoreSettings.GetPrimaryCurrency();
+		AskalPriceBook.Get("", currencyId); // Livro montado fora da medição
+
+		int count = s_ItemClasses.Count();
+		int checksum = 0;
+		int startTicks = TickCount(0);
+		for (int i = 0; i < iterations; i++)
+		{
+			string itemClass = s_ItemClasses[i % count];
+			checksum += AskalPurchaseService.ComputeItemTotalPrice(itemClass, "", currencyId);
+		}
+		return MakeResult("AskalPurchaseService.ComputeItemTotalPrice", iterations, TickCount(startTicks));
+	}
+
+	protected static AskalMicroBenchResult BenchApplyBuyCoefficient(int iterations)
+	{
+		AskalPriceBook priceBook = AskalPriceBook.Get("", AskalVirtualStoreSettings.GetPrimaryCurrency());
+
+		int count = s_Amounts.Count();
+		int checksum = 0;
+		int startTicks = TickCount(0);
+		for (int i = 0; i < iterations; i++)
+		{
+			checksum += priceBook.ApplyBuyCoefficient(s_Amounts[i % count]);
+		}
+		return MakeResult("AskalPriceBook.ApplyBuyCoefficient", iterations, TickCount(startTicks));
+	}
+
+	protected static AskalMicroBenchResult BenchResolveModeForItem(int iterations)
+	{
+		int count = s_ItemClasses.Count();
+		int checksum = 0;
+		int startTicks = TickCount(0);
+		for (int i = 0; i < iterations; i++)
+		{
+			int idx = i % count;
+			checksum += AskalTraderValidationHelper.ResolveModeForItem(s_ItemClasses[idx], s_ItemCategories[idx], s_ItemDatasets[idx], -1, s_SetupItems);
+		}
+		return MakeResult("AskalTraderValidationHelper.ResolveModeForItem", iterations, TickCount(startTicks));
+	}
+
+	protected static AskalMicroBenchResult BenchResolveItemMode(int iterations)
+	{
+		AskalSetupResolver resolver = new AskalSetupResolver();
+		resolver.RegisterInlineSetup("MicroBench", s_SetupItems);
+		array<string> setupNames = new array<string>();
+		setupNames.Insert("MicroBench");
+
+		int count = s_ItemClasses.Count();
+		int checksum = 0;
+		int startTicks = TickCount(0);
+		for (int i = 0; i < iterations; i++)
+		{
+			checksum += resolver.ResolveItemMode(s_ItemClasses[i % count], setupNames);
+		}
+		return MakeResult("AskalSetupResolver.ResolveItemMode", iterations, TickCount(startTicks));
+	}
+
+	// Caminho de produção: tabela DP da MarketConfig para a moeda primária
+	// (sem tabela para ela, uma tabela das denominações sintéticas com o mesmo limite)
+	protected static AskalMicroBenchResult BenchChangeTable(int iterations)
+	{
+		AskalChangeTable changeTable = NULL;
+		int maxAmount = 10000;
+		AskalMarketConfig marketConfig = AskalMarketConfig.GetInstance();
+		if (marketConfig)
+		{
+			changeTable = marketConfig.GetChangeTable(AskalVirtualStoreSettings.GetPrimaryCurrency());
+			maxAmount = marketConfig.ChangeTableMaxAmount;
+		}
+		if (!changeTable)
+		{
+			if (maxAmount <= 0)
+				maxAmount = 10000;
+			changeTable = new AskalChangeTable();
+			changeTable.Build(s_Denominations, maxAmount);
+		}
+
+		int count = s_Amounts.Count();
+		int checksum = 0;
+		int changeShortfall;
+		int startTicks = TickCount(0);
+		for (int i = 0; i < iterations; i++)
+		{
+			array<ref Param2<string, int>> change = changeTable.CalculateChange(s_Amounts[i % count], changeShortfall);
+			checksum += change.Count();
+		}
+		return MakeResult("AskalChangeTable.CalculateChange", iterations, TickCount(startTicks));
+	}
+
+	// Greedy (fallback sem tabela), lado a lado com a tabela DP
+	protected static AskalMicroBenchResult BenchCalculateChange(int iterations)
+	{
+		int count = s_Amounts.Count();
+		int checksum = 0;
+		int changeShortfall;
+		int startTicks = TickCount(0);
+		for (int i = 0; i < iterations; i++)
+		{
+			array<ref Param2<string, int>> change = AskalCurrencyInventoryManager.CalculateChange(s_Amounts[i % count], s_Denominations, changeShortfall);
+			checksum += change.Count();
+		}
+		return MakeResult("AskalCurrencyInventoryManager.CalculateChange", iterations, TickCount(startTicks));
+	}
+
+	protected static AskalMicroBenchResult MakeResult(string name, int iterations, int elapsedTicks)
+	{
+		AskalMicroBenchResult result = new AskalMicroBenchResult();
+		result.Name = name;
+		result.Iterations = iterations;
+		result.TotalMs = elapsedTicks / 10000.0;
+		result.NsPerOp = Math.Max(0, elapsedTicks * 100.0 / iterations - s_LoopOverheadNs);
+		return result;
+	}
+
+	// ========================================
+	// Baseline e relatório
+	// ========================================
+	protected static void CompareWithBaseline(AskalMicroBenchReport report)
+	{
+		if (!FileExist(BASELINE_FILE))
+			return;
+
+		AskalMicroBenchReport baseline = new AskalMicroBenchReport();
+		if (!AskalJsonLoader<AskalMicroBenchReport>.LoadFromFile(BASELINE_FILE, baseline, false) || !baseline.Results)
+			return;
+
+		foreach (AskalMicroBenchResult result : report.Results)
+		{
+			foreach (AskalMicroBenchResult baselineResult : baseline.Results)
+			{
+				if (baselineResult.Name != result.Name || baselineResult.NsPerOp <= 0)
+					continue;
+
+				result.BaselineNsPerOp = baselineResult.NsPerOp;
+				result.Ratio = result.NsPerOp / baselineResult.NsPerOp;
+				result.Regression = result.Ratio > REGRESSION_RATIO;
+				if (result.Regression)
+					report.Regressions++;
+				break;
+			}
+		}
+	}
+
+	protected static void WriteReport(AskalMicroBenchReport report)
+	{
+		MakeDirectory("$profile:Askal");
+		MakeDirectory("$profile:Askal/Benchmark");
+		MakeDirectory(REPORTS_DIRECTORY);
+
+		string reportPath = REPORTS_DIRECTORY + "micro_" + AskalLog.FormatTimestamp("", "_", "") + ".json";
+		if (!AskalJsonLoader<AskalMicroBenchReport>.SaveToFile(reportPath, report))
+			return;
+
+		AskalJsonLoader<AskalMicroBenchReport>.SaveToFile(REPORTS_DIRECTORY + "micro_latest.json", report);
+		if (!FileExist(BASELINE_FILE))
+		{
+			AskalJsonLoader<AskalMicroBenchReport>.SaveToFile(BASELINE_FILE, report);
+			Print("[AskalMicroBench] 📌 Baseline criado: " + BASELINE_FILE);
+		}
+		Print("[AskalMicroBench] 📝 Relatório: " + reportPath + " | regressões: " + report.Regressions);
+	}
+}
@@ -0,0 +1,265 @@
+// ==========================================
+// AskalServerBoot - Boot escalonado do servidor na call queue
+// Estágios (AskalServerReadiness): catálogo -> índice -> registro de traders ->
+// spawn de traders -> warm-up do cache de sync. Cada frame trabalha até estourar
+// o orçamento (-askalBootBudget=<ms>, padrão 6ms) e devolve o controle ao jogo
+// Unidade mínima de trabalho: um arquivo de dataset, um trader, um dataset de sync
+// ==========================================
+
+class AskalServerBoot
+{
+	static const string CLI_BUDGET_PARAM = "askalBootBudget";
+	static const float DEFAULT_BUDGET_MS = 6.0;
+
+	// Resultado de um passo do estágio
+	protected static const int STEP_MORE = 0;   // Ainda há trabalho, continuar neste frame se sobrar orçamento
+	protected static const int STEP_DONE = 1;   // Estágio concluído
+	protected static const int STEP_WAIT = 2;   // Esperando algo externo (ex.: SetupTraderStatic), tentar no próximo frame
+
+	protected static bool s_Running = false;
+	protected static int s_Stage;
+	protected static int s_BudgetTicks;
+	protected static int s_BootStartTicks;
+	protected static int s_StageStartTicks;
+	protected static int s_StageFrames;
+	protected static int s_TotalFrames;
+
+	protected static ref array<string> s_DatasetFiles;
+	protected static ref array<string> s_TraderFiles;
+	protected static ref array<string> s_SyncDatasetIDs;
+	protected static int s_Cursor;
+	protected static int s_TradersSpawned;
+
+	static void Start()
+	{
+		if (s_Running)
+			return;
+
+		float budgetMs = DEFAULT_BUDGET_MS;
+		string budgetParam;
+		if (GetCLIParam(CLI_BUDGET_PARAM, budgetParam) && budgetParam.ToFloat() > 0)
+			budgetMs = budgetParam.ToFloat();
+
+		s_Running = true;
+		s_Stage = AskalServerReadiness.STAGE_CATALOG;
+		s_BudgetTicks = budgetMs * 10000;
+		s_BootStartTicks = TickCount(0);
+		s_StageStartTicks = s_BootStartTicks;
+		s_StageFrames = 0;
+		s_TotalFrames = 0;
+		s_DatasetFiles = NULL;
+		s_TraderFiles = NULL;
+		s_SyncDatasetIDs = NULL;
+		s_Cursor = 0;
+		s_TradersSpawned = 0;
+
+		AskalServerReadiness.BeginBoot();
+		AskalMetrics.SetGauge("boot.ready", 0);
+
+		Print("[AskalBoot] ========================================");
+		Print("[AskalBoot] 🚀 Boot escalonado iniciado (orçamento " + budgetMs + "ms/frame)");
+		Print("[AskalBoot] ========================================");
+
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(Step, 0, true);
+	}
+
+	static bool IsRunning()
+	{
+		return s_Running;
+	}
+
+	// Um frame de boot: avança estágios até o orçamento acabar
+	protected static void Step()
+	{
+		int frameStart = TickCount(0);
+		s_TotalFrames++;
+		s_StageFrames++;
+
+		while (s_Stage < AskalServerReadiness.STAGE_COUNT)
+		{
+			int result = RunStageStep(s_Stage);
+			if (result == STEP_DONE)
+				CompleteStage();
+			else if (result == STEP_WAIT)
+				break;
+
+			if (TickCount(frameStart) >= s_BudgetTicks)
+				break;
+		}
+
+		AskalMetrics.ObserveTicks("boot.frame_ms", frameStart);
+
+		if (s_Stage >= AskalServerReadiness.STAGE_COUNT)
+			Finish();
+	}
+
+	protected static int RunStageStep(int stage)
+	{
+		switch (stage)
+		{
+			case AskalServerReadiness.STAGE_CATALOG:
+				return StepCatalog();
+			case AskalServerReadiness.STAGE_INDEX:
+				return StepIndex();
+			case AskalServerReadiness.STAGE_TRADER_REGISTRY:
+				return StepTraderRegistry();
+			case AskalServerReadiness.STAGE_TRADERS:
+				return StepTraders();
+			case AskalServerReadiness.STAGE_SYNC_WARMUP:
+				return StepSyncWarmup();
+		}
+		return STEP_DONE;
+	}
+
+	protected static void CompleteStage()
+	{
+		float stageMs = TickCount(s_StageStartTicks) / 10000.0;
+		string stageName = AskalServerReadiness.GetStageName(s_Stage);
+		AskalMetrics.ObserveMs("boot." + stageName + "_ms", stageMs);
+		Print("[AskalBoot] ✅ Estágio " + stageName + " concluído em " + stageMs + "ms (" + s_StageFrames + " frames)");
+
+		int completedStage = s_Stage;
+		s_Stage++;
+		s_Cursor = 0;
+		s_StageStartTicks = TickCount(0);
+		s_StageFrames = 1;
+
+		AskalServerReadiness.MarkStageDone(completedStage);
+
+		if (completedStage == AskalServerReadiness.STAGE_INDEX)
+			RunDiagnostics();
+	}
+
+	protected static void Finish()
+	{
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Step);
+		s_Running = false;
+		s_DatasetFiles = NULL;
+		s_TraderFiles = NULL;
+		s_SyncDatasetIDs = NULL;
+
+		float totalMs = TickCount(s_BootStartTicks) / 10000.0;
+		AskalMetrics.SetGauge("boot.ready", 1);
+		AskalMetrics.SetGauge("boot.total_ms", totalMs);
+		AskalMetrics.SetGauge("boot.frames", s_TotalFrames);
+
+		Print("[AskalBoot] ========================================");
+		Print("[AskalBoot] ✅ Servidor pronto em " + totalMs + "ms (" + s_TotalFrames + " frames, " + s_TradersSpawned + " traders)");
+		Print("[AskalBoot] ========================================");
+	}
+
+	// ========================================
+	// Estágios
+	// ========================================
+
+	// Primeiro passo lista os arquivos; depois um dataset por passo
+	protected static int StepCatalog()
+	{
+		if (!s_DatasetFiles)
+		{
+			s_DatasetFiles = new array<string>();
+			string datasetPath = AskalDatabaseLoader.PrepareDatasetPath();
+			if (datasetPath != "")
+				AskalDatabaseLoader.CollectDatasetFiles(datasetPath, s_DatasetFiles);
+			Print("[AskalBoot] 📂 " + s_DatasetFiles.Count() + " arquivos de dataset");
+			return STEP_MORE;
+		}
+
+		if (s_Cursor < s_DatasetFiles.Count())
+		{
+			string datasetFile = s_DatasetFiles.Get(s_Cursor);
+			int datasetLength;
+			int datasetFingerprint;
+			Dataset loadedDataset = AskalDatabaseLoader.LoadDatasetFile(datasetFile, datasetLength, datasetFingerprint);
+			if (loadedDataset)
+				AskalHotReload.TrackDatasetFile(datasetFile, loadedDataset.DatasetID, datasetLength, datasetFingerprint);
+			s_Cursor++;
+			return STEP_MORE;
+		}
+
+		int totalDatasets = AskalDatabase.GetAllDatasetIDs().Count();
+		Print("[AskalBoot] Total de datasets carregados: " + totalDatasets);
+		AskalMetrics.SetGauge("catalog.datasets", totalDatasets);
+		return STEP_DONE;
+	}
+
+	// Livro de preços da loja virtual na moeda padrão (índice className -> preço)
+	protected static int StepIndex()
+	{
+		string currencyId = "";
+		AskalMarketConfig marketConfig = AskalMarketConfig.GetInstance();
+		if (marketConfig)
+			currencyId = marketConfig.GetDefaultCurrencyId();
+		if (!currencyId || currencyId == "")
+			currencyId = "Askal_Money";
+
+		AskalPriceBook priceBook = AskalPriceBook.Get("", currencyId);
+		if (priceBook)
+			Print("[AskalBoot] 📇 Índice de preços: " + AskalPriceBook.GetStatsSummary());
+		return STEP_DONE;
+	}
+
+	protected static int StepTraderRegistry()
+	{
+		AskalTraderSpawnService.Init();
+
+		string tradersPath = AskalTraderConfig.GetTradersPath();
+		s_TraderFiles = new array<string>();
+		AskalTraderSpawnService.FindTraderFiles(tradersPath, s_TraderFiles);
+		Print("[AskalBoot] 🧾 " + s_TraderFiles.Count() + " traders registrados em " + tradersPath);
+		return STEP_DONE;
+	}
+
+	// Um trader por passo; conclui quando todos os SetupTraderStatic rodaram
+	protected static int StepTraders()
+	{
+		if (s_TraderFiles && s_Cursor < s_TraderFiles.Count())
+		{
+			string traderFile = s_TraderFiles.Get(s_Cursor);
+			if (AskalTraderSpawnService.SpawnTrader(traderFile))
+			{
+				s_TradersSpawned++;
+				AskalHotReload.TrackTraderFile(traderFile);
+			}
+			s_Cursor++;
+			return STEP_MORE;
+		}
+
+		if (AskalTraderSpawnService.GetPendingSetupCount() > 0)
+			return STEP_WAIT;
+
+		return STEP_DONE;
+	}
+
+	// Um dataset convertido para o formato de sync por passo
+	protected static int StepSyncWarmup()
+	{
+		if (!s_SyncDatasetIDs)
+		{
+			s_SyncDatasetIDs = AskalDatabase.GetAllDatasetIDs();
+			return STEP_MORE;
+		}
+
+		if (s_Cursor < s_SyncDatasetIDs.Count())
+		{
+			AskalDatabaseSync.WarmServerSyncCache(s_SyncDatasetIDs.Get(s_Cursor));
+			s_Cursor++;
+			return STEP_MORE;
+		}
+
+		return STEP_DONE;
+	}
+
+	// Benchmarks e simulador precisam do catálogo e do índice, não dos traders
+	protected static void RunDiagnostics()
+	{
+		// Benchmark do loader (apenas com -askalBenchmark=...; catálogo real é preservado)
+		AskalCatalogBenchmark.RunFromCommandLine();
+
+		// Microbenchmarks de preço/permissões (apenas com -askalMicroBench=<iterações>)
+		AskalMicroBenchmark.RunFromCommandLine();
+
+		// Carga sintética de compras/vendas (apenas com -askalTradeSim=<jogadores>)
+		AskalTradeLoadSimulator.RunFromCommandLine();
+	}
+}
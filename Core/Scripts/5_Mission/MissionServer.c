@@ -4,44 +4,40 @@ modded class MissionServer extends MissionBase
 {
     void MissionServer()
     {
-        Print("[AskalCore] ========================================");
-        Print("[AskalCore] MissionServer do Core inicializado");
-        Print("[AskalCore] ========================================");
-        
-        // Carregar datasets JSON do novo formato
-        Print("[AskalCore] ========================================");
-        Print("[AskalCore] INICIANDO CARREGAMENTO DE DATASETS JSON");
-        Print("[AskalCore] ========================================");
-        
-        // Verificar caminho antes de carregar
-        string dbPath = AskalDatabase.GetDatabasePath();
-        Print("[AskalCore] Caminho do database: " + dbPath);
-        
-        Print("[AskalCore] ANTES de chamar AskalDatabaseLoader.LoadAllDatasets()");
-        AskalDatabaseLoader.LoadAllDatasets();
-        Print("[AskalCore] DEPOIS de chamar AskalDatabaseLoader.LoadAllDatasets()");
+        // Log em arquivo + nível da VirtualStoreConfig antes de qualquer carregamento
+        AskalLog.EnableFileSink();
+        AskalVirtualStoreSettings.GetConfig();
+        AskalMetrics.StartSnapshots();
         
         Print("[AskalCore] ========================================");
-        Print("[AskalCore] CARREGAMENTO DE DATASETS CONCLUÍDO");
+        Print("[AskalCore] MissionServer do Core inicializado");
         Print("[AskalCore] ========================================");
         
-        // Verificar quantos datasets foram carregados
-        int totalDatasets = AskalDatabase.GetAllDatasetIDs().Count();
-        Print("[AskalCore] Total de datasets carregados: " + totalDatasets);
-        
-        // Inicializar módulos de compras e vendas (4_World)
+        // Módulos RPC primeiro: requisições que chegarem durante o boot ficam retidas
+        // no AskalServerReadiness até o estágio de que dependem concluir
         AskalPurchaseModule.GetInstance();
         AskalSellModule.GetInstance();
+        AskalHealthSyncModule.GetInstance();
+        AskalPerfConsoleModule.GetInstance();
         
-        // Spawnar traders estáticos
-        Print("[AskalCore] ========================================");
-        Print("[AskalCore] SPAWNANDO TRADERS ESTÁTICOS");
-        Print("[AskalCore] ========================================");
-        AskalTraderSpawnService.SpawnAllTraders();
+        // Hot reload (RequestHotReload, AskalAPI.Reload, -askalHotReload=<segundos>)
+        AskalHotReload.GetInstance();
+        
+        // Datasets, índice, traders e cache de sync são carregados na call queue,
+        // com orçamento por frame (benchmarks e simulador rodam após o índice)
+        Print("[AskalCore] Caminho do database: " + AskalDatabase.GetDatabasePath());
+        AskalServerBoot.Start();
         
         Print("[AskalCore] ========================================");
     }
     
+    override void OnMissionFinish()
+    {
+        AskalMetrics.StopSnapshots();
+        AskalLog.Flush();
+        super.OnMissionFinish();
+    }
+    
     // NOTA: Seguindo padrão TraderX - não enviamos dados automaticamente
     // O cliente solicita quando abre o menu via RequestDatasets RPC
     // Isso evita sobrecarga e permite controle melhor do timing
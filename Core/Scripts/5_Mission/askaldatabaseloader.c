@@ -31,6 +31,21 @@ class AskalDatabaseLoader
     }
     // Carrega recursivamente todos os arquivos .json das subpastas
     static void LoadAllDatasetsRecursive(string directoryPath)
+    {
+        array<string> datasetFiles = new array<string>();
+        CollectDatasetFiles(directoryPath, datasetFiles);
+        
+        int length;
+        int fingerprint;
+        foreach (string datasetFile : datasetFiles)
+        {
+            LoadDatasetFile(datasetFile, length, fingerprint);
+        }
+    }
+    
+    // Lista (recursivamente) os caminhos completos dos .json de datasets, sem carregá-los
+    // Usado pelo AskalServerBoot para carregar um arquivo por vez dentro do orçamento do frame
+    static void CollectDatasetFiles(string directoryPath, array<string> datasetFiles)
     {
         if (!directoryPath || directoryPath == "") return;
         
@@ -49,67 +64,17 @@ class AskalDatabaseLoader
             return;
         }
         
-        // Log apenas para debug (comentado para evitar spam)
-        // Log("Info", "[AskalDBLoader] 🔍 Buscando em: " + searchPattern);
-        
         while (true)
         {
             if (fileName != "" && fileName != "." && fileName != ".." && fileName != "manifest.json")
             {
                 string fullPath = directoryPath + fileName;
                 
-                // Se termina com .json, é arquivo - carrega
+                // Se termina com .json, é arquivo; senão provavelmente é diretório - recursão
                 if (fileName.Length() > 5 && fileName.Substring(fileName.Length() - 5, 5) == ".json")
-                {
-                    // Carrega formato hierárquico (JsonDataset)
-                    // Usa AskalJsonLoader para suportar arquivos grandes (>64KB)
-                    JsonDataset jsonDataset = new JsonDataset();
-                    if (!AskalJsonLoader<JsonDataset>.LoadFromFile(fullPath, jsonDataset, false))
-                    {
-                        Log("Warning", "[AskalDBLoader] ⚠️ Falha ao carregar: " + fileName);
-                        continue;
-                    }
-                    
-                    // Verifica se tem Categories (formato hierárquico obrigatório)
-                    if (jsonDataset && jsonDataset.Categories && jsonDataset.Categories.Count() > 0)
-                    {
-                        // Formato hierárquico: Dataset com Categories
-                        Dataset dataset = Dataset.FromJson(jsonDataset);
-                        
-                        if (dataset)
-                        {
-                            // Registra o dataset
-                            AskalDatabase.RegisterDataset(dataset);
-                            
-                            // Conta total de itens em todas as categorias
-                            int totalItems = 0;
-                            if (dataset.Categories)
-                            {
-                                for (int c = 0; c < dataset.Categories.Count(); c++)
-                                {
-                                    AskalCategory cat = dataset.Categories.GetElement(c);
-                                    if (cat && cat.Items)
-                                        totalItems += cat.Items.Count();
-                                }
-                            }
-                            
-                            Log("Info", "[AskalDBLoader] ✅ Loaded Dataset: " + dataset.DatasetID + " -> " + dataset.DisplayName + " v" + dataset.Version + " (" + dataset.Categories.Count() + " categories, " + totalItems + " items)");
-                        }
-                        else
-                        {
-                            Log("Warning", "[AskalDBLoader] ⚠️ Failed to convert JSON dataset: " + fileName);
-                        }
-                    }
-                    else
-                    {
-                        Log("Warning", "[AskalDBLoader] ⚠️ JSON file missing Categories (hierarchical format required): " + fileName);
-                    }
-                }
+                    datasetFiles.Insert(fullPath);
                 else
-                {
-                    // Não termina com .json - provavelmente é diretório - recursão
-                    LoadAllDatasetsRecursive(fullPath);
-                }
+                    CollectDatasetFiles(fullPath, datasetFiles);
             }
             
             if (!FindNextFile(handle, fileName, fileAttr)) break;
@@ -118,22 +83,70 @@ class AskalDatabaseLoader
         CloseFindFile(handle);
     }
     
-    // SOLO SERVIDOR: Carrega datasets JSON do disco
-    // CLIENTE NUNCA DEVE CHAMAR ESTE MÉTODO - usar RPC RequestDatasets
-    static void LoadAllDatasets()
+    // Carrega e registra um único arquivo de dataset (formato hierárquico)
+    // length/fingerprint: impressão digital do texto lido (linha de base do AskalHotReload)
+    static Dataset LoadDatasetFile(string fullPath, out int length, out int fingerprint)
     {
-        // CRITICAL: Só funciona no servidor
-        if (GetGame().IsClient() && GetGame().IsMultiplayer())
+        Dataset dataset = ParseDatasetFile(fullPath, length, fingerprint);
+        if (!dataset)
+            return NULL;
+        
+        // Registra o dataset
+        AskalDatabase.RegisterDataset(dataset);
+        
+        // Conta total de itens em todas as categorias
+        int totalItems = 0;
+        if (dataset.Categories)
         {
-            Log("Error", "[AskalDBLoader] ❌ ERRO CRÍTICO: LoadAllDatasets() chamado no CLIENTE!");
-            Log("Error", "[AskalDBLoader] Cliente NÃO deve carregar arquivos - usar RPC RequestDatasets");
-            return;
+            for (int c = 0; c < dataset.Categories.Count(); c++)
+            {
+                AskalCategory cat = dataset.Categories.GetElement(c);
+                if (cat && cat.Items)
+                    totalItems += cat.Items.Count();
+            }
         }
         
-        Log("Info", "[AskalDBLoader] ==========================================");
-        Log("Info", "[AskalDBLoader] LoadAllDatasets() - SERVIDOR APENAS");
-        Log("Info", "[AskalDBLoader] ==========================================");
+        Log("Info", "[AskalDBLoader] ✅ Loaded Dataset: " + dataset.DatasetID + " -> " + dataset.DisplayName + " v" + dataset.Version + " (" + dataset.Categories.Count() + " categories, " + totalItems + " items)");
+        return dataset;
+    }
+    
+    // Lê e converte um arquivo de dataset sem registrá-lo (hot reload monta o snapshot à parte)
+    static Dataset ParseDatasetFile(string fullPath, out int length, out int fingerprint)
+    {
+        string fileName = fullPath;
+        int slashIdx = fullPath.LastIndexOf("/");
+        if (slashIdx != -1)
+            fileName = fullPath.Substring(slashIdx + 1, fullPath.Length() - slashIdx - 1);
+        
+        // Usa AskalJsonLoader para suportar arquivos grandes (>64KB)
+        JsonDataset jsonDataset = new JsonDataset();
+        if (!AskalJsonLoader<JsonDataset>.LoadFromFileWithFingerprint(fullPath, jsonDataset, length, fingerprint, false))
+        {
+            Log("Warning", "[AskalDBLoader] ⚠️ Falha ao carregar: " + fileName);
+            return NULL;
+        }
+        
+        // Verifica se tem Categories (formato hierárquico obrigatório)
+        if (!jsonDataset || !jsonDataset.Categories || jsonDataset.Categories.Count() == 0)
+        {
+            Log("Warning", "[AskalDBLoader] ⚠️ JSON file missing Categories (hierarchical format required): " + fileName);
+            return NULL;
+        }
+        
+        // Formato hierárquico: Dataset com Categories
+        Dataset dataset = Dataset.FromJson(jsonDataset);
+        if (!dataset)
+        {
+            Log("Warning", "[AskalDBLoader] ⚠️ Failed to convert JSON dataset: " + fileName);
+            return NULL;
+        }
         
+        return dataset;
+    }
+    
+    // Resolve (e valida) a pasta de datasets; "" se não existir
+    static string PrepareDatasetPath()
+    {
         // Determinar caminho (servidor geralmente usa $profile:)
         string path = AskalDatabase.GetDatabasePath();
         if (!path || path == "") 
@@ -150,10 +163,33 @@ class AskalDatabaseLoader
         {
             Log("Error", "[AskalDBLoader] ❌ ERRO: Diretório não existe: " + path);
             Log("Error", "[AskalDBLoader] Verifique se o caminho está correto!");
-            return;
+            return "";
         }
         
         Log("Info", "[AskalDBLoader] ✅ Diretório encontrado, iniciando busca...");
+        return path;
+    }
+    
+    // SOLO SERVIDOR: Carrega datasets JSON do disco
+    // CLIENTE NUNCA DEVE CHAMAR ESTE MÉTODO - usar RPC RequestDatasets
+    static void LoadAllDatasets()
+    {
+        // CRITICAL: Só funciona no servidor
+        if (GetGame().IsClient() && GetGame().IsMultiplayer())
+        {
+            Log("Error", "[AskalDBLoader] ❌ ERRO CRÍTICO: LoadAllDatasets() chamado no CLIENTE!");
+            Log("Error", "[AskalDBLoader] Cliente NÃO deve carregar arquivos - usar RPC RequestDatasets");
+            return;
+        }
+        
+        Log("Info", "[AskalDBLoader] ==========================================");
+        Log("Info", "[AskalDBLoader] LoadAllDatasets() - SERVIDOR APENAS");
+        Log("Info", "[AskalDBLoader] ==========================================");
+        
+        string path = PrepareDatasetPath();
+        if (path == "")
+            return;
+        
         Log("Info", "[AskalDBLoader] Buscando arquivos .json recursivamente...");
 
         LoadAllDatasetsRecursive(path);
@@ -0,0 +1,189 @@
+// ==========================================================
+//	Askal Change Solver
+//	Troco ótimo (mínimo de moedas) por currency via programação dinâmica
+//	Tabelas pré-calculadas ao carregar a MarketConfig
+// ==========================================================
+
+class AskalChangeTable
+{
+	protected ref array<ref AskalCurrencyValueConfig> m_Denominations; // Maior valor primeiro
+	protected ref array<int> m_MinCoins;   // amount -> menor número de moedas (-1 = inalcançável)
+	protected ref array<int> m_LastDenom;  // amount -> índice da última denominação usada
+	protected int m_MaxAmount;
+	protected bool m_CoversBulk;           // Tabela chega a 2x a maior denominação (greedy em massa + DP é exato)
+
+	void AskalChangeTable()
+	{
+		m_Denominations = new array<ref AskalCurrencyValueConfig>();
+		m_MinCoins = new array<int>();
+		m_LastDenom = new array<int>();
+		m_MaxAmount = 0;
+		m_CoversBulk = false;
+	}
+
+	int GetMaxAmount()
+	{
+		return m_MaxAmount;
+	}
+
+	// Monta a tabela DP até duas vezes a maior denominação (acima disso o greedy em massa
+	// desce até ela), sem passar de maxAmount (ChangeTableMaxAmount da config)
+	void Build(array<ref AskalCurrencyValueConfig> values, int maxAmount)
+	{
+		m_Denominations.Clear();
+		m_MinCoins.Clear();
+		m_LastDenom.Clear();
+		m_MaxAmount = 0;
+		m_CoversBulk = false;
+
+		if (!values || maxAmount <= 0)
+			return;
+
+		foreach (AskalCurrencyValueConfig valueConfig : values)
+		{
+			if (valueConfig && valueConfig.Value > 0 && valueConfig.Name != "")
+				m_Denominations.Insert(valueConfig);
+		}
+		SortDescending(m_Denominations);
+
+		if (m_Denominations.Count() == 0)
+			return;
+
+		int bulkTableAmount = m_Denominations[0].Value * 2;
+		m_CoversBulk = maxAmount >= bulkTableAmount;
+		maxAmount = Math.Min(bulkTableAmount, maxAmount);
+
+		m_MaxAmount = maxAmount;
+		m_MinCoins.Resize(maxAmount + 1);
+		m_LastDenom.Resize(maxAmount + 1);
+		m_MinCoins.Set(0, 0);
+		m_LastDenom.Set(0, -1);
+
+		int denomCount = m_Denominations.Count();
+		for (int amount = 1; amount <= maxAmount; amount++)
+		{
+			int best = -1;
+			int bestDenom = -1;
+			for (int d = 0; d < denomCount; d++)
+			{
+				int denomValue = m_Denominations[d].Value;
+				if (denomValue > amount)
+					continue;
+
+				int previous = m_MinCoins[amount - denomValue];
+				if (previous < 0)
+					continue;
+
+				if (best < 0 || previous + 1 < best)
+				{
+					best = previous + 1;
+					bestDenom = d;
+				}
+			}
+			m_MinCoins.Set(amount, best);
+			m_LastDenom.Set(amount, bestDenom);
+		}
+	}
+
+	// Calcula troco: greedy com a maior denominação até cair dentro da tabela, depois DP exato
+	// (tabela limitada pela config abaixo de 2x a maior denominação: acima dela, greedy puro)
+	// Valores sem combinação exata pagam a maior quantia representável abaixo deles;
+	// shortfall recebe a diferença não paga em moedas (0 = troco exato)
+	array<ref Param2<string, int>> CalculateChange(int amount, out int shortfall)
+	{
+		shortfall = 0;
+		array<ref Param2<string, int>> result = new array<ref Param2<string, int>>();
+		if (amount <= 0)
+			return result;
+
+		if (m_Denominations.Count() == 0)
+		{
+			shortfall = amount;
+			return result;
+		}
+
+		if (amount > m_MaxAmount && !m_CoversBulk)
+			return CalculateGreedy(amount, shortfall);
+
+		array<int> counts = new array<int>();
+		counts.Resize(m_Denominations.Count());
+		for (int c = 0; c < counts.Count(); c++)
+			counts.Set(c, 0);
+
+		int remaining = amount;
+		if (remaining > m_MaxAmount)
+		{
+			int largestValue = m_Denominations[0].Value;
+			int bulk = (remaining - m_MaxAmount + largestValue - 1) / largestValue;
+			if (bulk * largestValue > remaining)
+				bulk = remaining / largestValue;
+			remaining -= bulk * largestValue;
+
+			// Devolve moedas grandes enquanto o resto não tiver combinação exata
+			while (bulk > 0 && m_MinCoins[remaining] < 0 && remaining + largestValue <= m_MaxAmount)
+			{
+				bulk--;
+				remaining += largestValue;
+			}
+			counts.Set(0, bulk);
+		}
+
+		// Desce até um valor alcançável (apenas quando não há moeda de valor 1)
+		while (remaining > 0 && m_MinCoins[remaining] < 0)
+		{
+			remaining--;
+			shortfall++;
+		}
+
+		while (remaining > 0)
+		{
+			int denomIndex = m_LastDenom[remaining];
+			counts.Set(denomIndex, counts[denomIndex] + 1);
+			remaining -= m_Denominations[denomIndex].Value;
+		}
+
+		for (int i = 0; i < counts.Count(); i++)
+		{
+			if (counts[i] > 0)
+				result.Insert(new Param2<string, int>(m_Denominations[i].Name, counts[i]));
+		}
+
+		return result;
+	}
+
+	// Maior denominação primeiro; o que sobrar abaixo da menor vai para shortfall
+	protected array<ref Param2<string, int>> CalculateGreedy(int amount, out int shortfall)
+	{
+		array<ref Param2<string, int>> result = new array<ref Param2<string, int>>();
+		int remaining = amount;
+		foreach (AskalCurrencyValueConfig denomination : m_Denominations)
+		{
+			int coins = remaining / denomination.Value;
+			if (coins <= 0)
+				continue;
+
+			result.Insert(new Param2<string, int>(denomination.Name, coins));
+			remaining -= coins * denomination.Value;
+		}
+
+		shortfall = remaining;
+		return result;
+	}
+
+	protected static void SortDescending(array<ref AskalCurrencyValueConfig> values)
+	{
+		int n = values.Count();
+		for (int i = 0; i < n - 1; i++)
+		{
+			for (int j = 0; j < n - i - 1; j++)
+			{
+				if (values[j].Value < values[j + 1].Value)
+				{
+					AskalCurrencyValueConfig temp = values[j];
+					values.Set(j, values[j + 1]);
+					values.Set(j + 1, temp);
+				}
+			}
+		}
+	}
+}
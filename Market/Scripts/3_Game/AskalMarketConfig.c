@@ -39,6 +39,7 @@ class AskalMarketConfigFile
 	string Description;
 	string WarnText;
 	int DelayTimeMS;
+	int ChangeTableMaxAmount; // Limite das tabelas de troco ótimo (0 = apenas greedy)
 	string DefaultCurrencyId;
 	ref map<string, ref AskalCurrencyConfig> Currencies;
 	ref map<string, float> Liquids;
@@ -48,6 +49,7 @@ class AskalMarketConfigFile
 	{
 		WarnText = "";
 		DelayTimeMS = 500;
+		ChangeTableMaxAmount = 10000;
 		DefaultCurrencyId = "";
 		Currencies = new map<string, ref AskalCurrencyConfig>();
 		Liquids = new map<string, float>();
@@ -62,49 +64,51 @@ class AskalMarketConfig
 	// Dados processados
 	protected ref map<int, float> m_LiquidPrices; // liquidType -> price per mL
 	protected ref map<int, string> m_LiquidNames; // liquidType -> display
+	protected ref map<string, ref AskalChangeTable> m_ChangeTables; // walletId -> tabela de troco
 	ref map<string, ref AskalCurrencyConfig> Currencies; // walletId -> config
 	string DefaultCurrencyId;
 	string WarnText;
 	int DelayTimeMS;
+	int ChangeTableMaxAmount;
 	
 	void AskalMarketConfig()
 	{
 		m_LiquidPrices = new map<int, float>();
 		m_LiquidNames = new map<int, string>();
+		m_ChangeTables = new map<string, ref AskalChangeTable>();
 		Currencies = new map<string, ref AskalCurrencyConfig>();
 		WarnText = "";
 		DelayTimeMS = 500; // Default: 500ms
-		LoadConfig();
+		ChangeTableMaxAmount = 10000;
 	}
 	
+	// Instância compartilhada: o arquivo é lido uma vez (use Reload para reler)
 	static AskalMarketConfig GetInstance()
 	{
 		if (!s_Instance)
+		{
 			s_Instance = new AskalMarketConfig();
+			s_Instance.LoadConfig();
+		}
 		return s_Instance;
 	}
 	
+	void Reload()
+	{
+		LoadConfig();
+	}
+	
 	protected void LoadConfig()
 	{
-		array<string> candidatePaths = {
-
-			"$profile:Askal/Market/MarketConfig.json"
-		};
-		
-		Print("[AskalMarket] 🔍 Procurando MarketConfig.json em " + candidatePaths.Count() + " caminhos...");
-		foreach (string path : candidatePaths)
+		string path = AskalConfigLocator.Resolve(AskalConfigLocator.MARKET_CONFIG);
+		if (path != "" && LoadFromPath(path))
 		{
-			Print("[AskalMarket] 🔍 Tentando: " + path);
-			if (LoadFromPath(path))
-			{
-				Print("[AskalMarket] ✅ MarketConfig carregada de " + path);
-				return;
-			}
+			Print("[AskalMarket] ✅ MarketConfig carregada de " + path);
+			return;
 		}
 		
 		Print("[AskalMarket] ⚠️ MarketConfig não encontrada em nenhum caminho. Aplicando valores padrão.");
 		LoadDefaults();
-		
 	}
 	
 	bool LoadFromPath(string path)
@@ -147,6 +151,9 @@ class AskalMarketConfig
 		DelayTimeMS = fileData.DelayTimeMS;
 		if (DelayTimeMS <= 0)
 			DelayTimeMS = 500; // Fallback
+		ChangeTableMaxAmount = fileData.ChangeTableMaxAmount;
+		if (ChangeTableMaxAmount < 0)
+			ChangeTableMaxAmount = 0;
 		DefaultCurrencyId = fileData.DefaultCurrencyId;
 		if (!DefaultCurrencyId || DefaultCurrencyId == "")
 			DefaultCurrencyId = "Askal_Money";
@@ -203,6 +210,8 @@ class AskalMarketConfig
 		{
 			LoadDefaultLiquids();
 		}
+		
+		BuildChangeTables();
 	}
 	
 	protected void LoadDefaults()
@@ -215,6 +224,28 @@ class AskalMarketConfig
 		
 		AddDefaultCurrency();
 		LoadDefaultLiquids();
+		BuildChangeTables();
+	}
+	
+	// Pré-calcula tabelas de troco ótimo para moedas físicas com denominações
+	protected void BuildChangeTables()
+	{
+		m_ChangeTables.Clear();
+		if (ChangeTableMaxAmount <= 0)
+			return;
+		
+		foreach (string currencyId, AskalCurrencyConfig currencyCfg : Currencies)
+		{
+			if (!currencyCfg || currencyCfg.Mode != 1 || !currencyCfg.Values || currencyCfg.Values.Count() == 0)
+				continue;
+			
+			AskalChangeTable table = new AskalChangeTable();
+			table.Build(currencyCfg.Values, ChangeTableMaxAmount);
+			if (table.GetMaxAmount() > 0)
+				m_ChangeTables.Insert(currencyId, table);
+		}
+		
+		Print("[AskalMarket] ✅ Tabelas de troco pré-calculadas: " + m_ChangeTables.Count() + " currencies (até " + ChangeTableMaxAmount + ")");
 	}
 	
 	int GetDelayTimeMS()
@@ -290,6 +321,14 @@ class AskalMarketConfig
 		return NULL;
 	}
 	
+	AskalChangeTable GetChangeTable(string currencyId)
+	{
+		AskalChangeTable table;
+		if (m_ChangeTables.Find(currencyId, table))
+			return table;
+		return NULL;
+	}
+	
 	string GetDefaultCurrencyId()
 	{
 		return DefaultCurrencyId;
@@ -404,6 +443,7 @@ class AskalMarketConfig
 		
 		// Limpar currencies existentes
 		config.Currencies.Clear();
+		config.m_ChangeTables.Clear();
 		
 		// Aplicar DefaultCurrencyId
 		if (defaultCurrencyId && defaultCurrencyId != "")
@@ -12,14 +12,22 @@ class AskalMarketLoader
     }
 
     // Carrega MarketConfig usando JsonFileLoader
+    // Sem config de destino e com o caminho já localizado, reutiliza a instância compartilhada
     static bool LoadConfig(string path, out AskalMarketConfig config)
     {
-		if (!config)
-			config = new AskalMarketConfig();
-		
 		if (!path || path == "")
 			return false;
 		
+		if (!config)
+		{
+			if (path == AskalConfigLocator.Resolve(AskalConfigLocator.MARKET_CONFIG))
+			{
+				config = AskalMarketConfig.GetInstance();
+				return config.Currencies && config.Currencies.Count() > 0;
+			}
+			config = new AskalMarketConfig();
+		}
+		
 		return config.LoadFromPath(path);
     }
 
@@ -3,11 +3,23 @@
 
 class AskalSetupResolver
 {
+    protected static int s_FileRevision = 0;      // Muda quando o hot reload vê um arquivo de setup alterado
+    
     ref map<string, ref AskalSetupConfig> m_LoadedSetups;
+    protected ref map<string, bool> m_FileSetups; // Setups lidos de arquivo (os inline não são descartados)
+    protected int m_FileRevision;
     
     void AskalSetupResolver()
     {
         m_LoadedSetups = new map<string, ref AskalSetupConfig>();
+        m_FileSetups = new map<string, bool>();
+        m_FileRevision = s_FileRevision;
+    }
+    
+    // Chamado pelo hot reload: resolvers existentes relêem os setups de arquivo no próximo GetSetup
+    static void InvalidateFileSetups()
+    {
+        s_FileRevision++;
     }
 
     // Registra um setup "inline" (ex: configurado diretamente no trader JSON)
@@ -41,11 +53,14 @@ class AskalSetupResolver
     {
         if (!itemClassname || itemClassname == "" || !setupNames || setupNames.Count() == 0)
         {
-            Print("[AskalSetupResolver] ⚠️ ResolveItemMode: parâmetros inválidos");
+            AskalLog.Warn("Setup", "⚠️ ResolveItemMode: parâmetros inválidos");
             return -1;
         }
         
-        Print("[AskalSetupResolver] Resolvendo modo para: " + itemClassname + " (em " + setupNames.Count() + " setups)");
+        // Roda por item na validação de transações: logs por chamada só em debug
+        bool debugEnabled = AskalLog.IsEnabled("Setup", AskalLog.DEBUG);
+        if (debugEnabled)
+            AskalLog.Debug("Setup", "Resolvendo modo para: " + itemClassname + " (em " + setupNames.Count() + " setups)");
         
         int itemMode = -1;
         int highestPriority = -1; // 0 = Dataset, 1 = Categoria, 2 = Item (maior prioridade)
@@ -58,16 +73,17 @@ class AskalSetupResolver
             AskalSetupConfig setup = GetSetup(setupName);
             if (!setup)
             {
-                Print("[AskalSetupResolver] ⚠️ Setup " + setupName + " não foi carregado!");
+                AskalLog.Warn("Setup", "⚠️ Setup " + setupName + " não foi carregado!");
                 continue;
             }
             if (!setup.SetupItems)
             {
-                Print("[AskalSetupResolver] ⚠️ Setup " + setupName + " não tem SetupItems!");
+                AskalLog.Warn("Setup", "⚠️ Setup " + setupName + " não tem SetupItems!");
                 continue;
             }
             
-            Print("[AskalSetupResolver] Verificando setup " + setupName + " (" + setup.SetupItems.Count() + " configurações)");
+            if (debugEnabled)
+                AskalLog.Debug("Setup", "Verificando setup " + setupName + " (" + setup.SetupItems.Count() + " configurações)");
             
             // 1. Prioridade máxima: Item individual
             if (setup.SetupItems.Contains(itemClassname))
@@ -81,7 +97,7 @@ class AskalSetupResolver
                 }
                 else if (mode > 3)
                 {
-                    Print("[AskalSetupResolver] ⚠️ Modo inválido (" + mode + ") para item " + itemClassname + " em setup " + setupName + ". Valores válidos: -1, 0-3");
+                    AskalLog.Warn("Setup", "⚠️ Modo inválido (" + mode + ") para item " + itemClassname + " em setup " + setupName + ". Valores válidos: -1, 0-3");
                 }
                 continue; // Item encontrado, não precisa verificar categoria/dataset
             }
@@ -131,7 +147,7 @@ class AskalSetupResolver
                     }
                     else if (mode > 3)
                     {
-                        Print("[AskalSetupResolver] ⚠️ Modo inválido (" + mode + ") para categoria " + itemCategory.CategoryID + " em setup " + setupName);
+                        AskalLog.Warn("Setup", "⚠️ Modo inválido (" + mode + ") para categoria " + itemCategory.CategoryID + " em setup " + setupName);
                     }
                     continue; // Categoria encontrada, não precisa verificar dataset
                 }
@@ -233,31 +249,32 @@ class AskalSetupResolver
     {
         if (!setupName || setupName == "") return null;
         
+        if (m_FileRevision != s_FileRevision)
+        {
+            foreach (string staleSetup, bool fromFile : m_FileSetups)
+            {
+                m_LoadedSetups.Remove(staleSetup);
+            }
+            m_FileSetups.Clear();
+            m_FileRevision = s_FileRevision;
+        }
+        
         // Já carregado?
         if (m_LoadedSetups.Contains(setupName))
         {
-            Print("[AskalSetupResolver] Setup " + setupName + " já está em cache");
+            if (AskalLog.IsEnabled("Setup", AskalLog.DEBUG))
+                AskalLog.Debug("Setup", "Setup " + setupName + " já está em cache");
             return m_LoadedSetups.Get(setupName);
         }
         
         Print("[AskalSetupResolver] Carregando setup: " + setupName);
         
-        // Carrega do arquivo (tenta múltiplos caminhos para compatibilidade)
-        string path = "$profile:Askal/Market/Setups/" + setupName + ".json";
-        if (!FileExist(path))
+        // Carrega do arquivo (Setups/, Traders/ legacy ou $mission - ver AskalConfigLocator)
+        string path = AskalConfigLocator.Resolve(AskalConfigLocator.SETUP_PREFIX + setupName);
+        if (path == "")
         {
-            // Fallback: tenta em Traders/ (legacy)
-            path = "$profile:Askal/Market/Traders/" + setupName + ".json";
-            if (!FileExist(path))
-            {
-                // Fallback: tenta em $mission (alternativa)
-                path = "$mission:Askal/Traders/" + setupName + ".json";
-                if (!FileExist(path))
-                {
-                    Print("[AskalSetupResolver] ❌ Setup " + setupName + " não encontrado em nenhum caminho!");
-                    return null;
-                }
-            }
+            Print("[AskalSetupResolver] ❌ Setup " + setupName + " não encontrado em nenhum caminho!");
+            return null;
         }
         
         Print("[AskalSetupResolver] ✅ Setup encontrado em: " + path);
@@ -276,6 +293,7 @@ class AskalSetupResolver
                 Print("[AskalSetupResolver] ⚠️ Setup carregado mas SetupItems é NULL!");
             }
             m_LoadedSetups.Set(setupName, setup);
+            m_FileSetups.Set(setupName, true);
         }
         else
         {
@@ -289,6 +307,7 @@ class AskalSetupResolver
     void ClearCache()
     {
         m_LoadedSetups.Clear();
+        m_FileSetups.Clear();
     }
 }
 
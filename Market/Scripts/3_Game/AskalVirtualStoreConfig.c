@@ -2,6 +2,7 @@ class AskalVirtualStoreConfig
 {
 	string Version;
 	int LogsLevel;
+	ref map<string, int> LogsModules;	// Opcional: nível por módulo (ex.: "Purchase": 3)
 	int VirtualStoreMode;
 	string AcceptedCurrency;
 	ref array<string> AcceptedCurrencyList;
@@ -11,6 +12,7 @@ class AskalVirtualStoreConfig
 	
 	void AskalVirtualStoreConfig()
 	{
+		LogsLevel = AskalLog.INFO;
 		AcceptedCurrency = "";
 		AcceptedCurrencyList = new array<string>();
 		SetupItems = new map<string, int>();
@@ -48,31 +50,13 @@ class AskalVirtualStoreConfig
 	
 	static AskalVirtualStoreConfig LoadFromAny()
 	{
-		array<string> candidatePaths = {
-			"$profile:config/Askal/Market/VirtualStore_Config.json",
-			"$profile:config\\Askal\\Market\\VirtualStore_Config.json",
-			"$profile:Askal/Market/VirtualStore_Config.json",
-			"$profile:Askal\\Market\\VirtualStore_Config.json",
-			"$mission:Askal/Market/VirtualStore_Config.json",
-			"$mission:Askal\\Market\\VirtualStore_Config.json",
-			"Askal/Market/VirtualStore_Config.json",
-			"Askal\\Market\\VirtualStore_Config.json",
-			"config/Askal/Market/VirtualStore_Config.json",
-			"config\\Askal\\Market\\VirtualStore_Config.json"
-		};
-		
 		AskalVirtualStoreConfig loadedConfig = NULL;
-		foreach (string path : candidatePaths)
+		string path = AskalConfigLocator.Resolve(AskalConfigLocator.VIRTUAL_STORE_CONFIG);
+		AskalVirtualStoreConfig tempConfig;
+		if (path != "" && AskalMarketLoader.LoadVirtualStoreConfig(path, tempConfig) && tempConfig)
 		{
-			AskalVirtualStoreConfig tempConfig;
-			if (AskalMarketLoader.LoadVirtualStoreConfig(path, tempConfig) && tempConfig)
-			{
-				tempConfig.NormalizeAcceptedCurrency();
-				tempConfig.EnsureDefaults();
-				loadedConfig = tempConfig;
-				Print("[AskalVirtualStoreConfig] ✅ Config carregada de: " + path);
-				break;
-			}
+			loadedConfig = tempConfig;
+			Print("[AskalVirtualStoreConfig] ✅ Config carregada de: " + path);
 		}
 		
 		if (!loadedConfig)
@@ -83,6 +67,7 @@ class AskalVirtualStoreConfig
 			Print("[AskalVirtualStoreConfig] ⚠️ Config não encontrada. Usando valores padrão.");
 		}
 		
+		AskalLog.Configure(loadedConfig.LogsLevel, loadedConfig.LogsModules);
 		return loadedConfig;
 	}
 }
@@ -116,6 +101,13 @@ class AskalVirtualStoreSettings
 		return s_Config;
 	}
 	
+	// Servidor: descarta a config em memória e relê do disco (hot reload)
+	static void Reload()
+	{
+		s_Config = NULL;
+		GetConfig();
+	}
+	
 	static void ApplyConfigFromServer(string currencyId, float buyCoeff, float sellCoeff, array<string> setupKeys, array<int> setupValues)
 	{
 		AskalVirtualStoreConfig config = GetConfig();
@@ -148,6 +140,7 @@ class AskalVirtualStoreSettings
 		config.NormalizeAcceptedCurrency();
 		config.EnsureDefaults();
 		s_ConfigSynced = true;
+		AskalEventBus.Publish(AskalEventBus.VIRTUAL_STORE_CONFIG);
 	}
 	
 	static bool IsConfigSynced()
@@ -0,0 +1,403 @@
+// ========================================
+// AskalItemCardGrid - Grid virtualizado de cards de item
+// Só instancia cards para a janela visível do scroll (+ margem) e recicla
+// os widgets do pool ao rolar; o menu dono faz o bind dos dados em cada card
+// ========================================
+
+class AskalItemCardGrid
+{
+	protected static const string CARD_LAYOUT = "askal/market/gui/new_layouts/askal_store_item_card.layout";
+	protected static const int MARGIN_ROWS = 1;             // Linhas extras acima/abaixo da área visível
+	protected static const float DEFAULT_CARD_WIDTH = 212;  // Fallback até o primeiro card ser medido
+	protected static const float DEFAULT_CARD_HEIGHT = 250;
+	protected static const float WRAP_PADDING = 6;          // Padding do items_cards_holder
+	protected static const float CARD_MARGIN = 3;           // Margin do items_cards_holder
+
+	protected AskalStoreMenu m_Owner;
+	protected ScrollWidget m_Scroll;
+	protected WrapSpacerWidget m_Wrap;
+	protected Widget m_TopSpacer;
+	protected Widget m_BottomSpacer;
+	protected ref array<Widget> m_Pool;         // Cards na ordem dos filhos do wrap
+	protected ref array<int> m_PoolEntries;     // Índice da entrada ligada a cada card (-1 = livre)
+
+	protected int m_EntryCount;
+	protected int m_FirstEntry;
+	protected int m_BoundCount;
+	protected int m_Columns;
+	protected int m_TotalRows;
+	protected float m_SlotWidth;
+	protected float m_SlotHeight;
+	protected float m_LastScrollPos;
+	protected float m_LastViewHeight;
+	protected float m_LastWrapWidth;
+
+	void AskalItemCardGrid(AskalStoreMenu owner, ScrollWidget scroll, WrapSpacerWidget wrap)
+	{
+		m_Owner = owner;
+		m_Scroll = scroll;
+		m_Wrap = wrap;
+		m_Pool = new array<Widget>();
+		m_PoolEntries = new array<int>();
+		m_EntryCount = 0;
+		m_FirstEntry = -1;
+		m_BoundCount = 0;
+		m_Columns = 1;
+		m_TotalRows = 0;
+		m_SlotWidth = 0;
+		m_SlotHeight = 0;
+		m_LastScrollPos = -1;
+		m_LastViewHeight = -1;
+		m_LastWrapWidth = -1;
+
+		if (m_Wrap)
+		{
+			m_TopSpacer = CreateSpacer();
+			m_BottomSpacer = CreateSpacer();
+		}
+	}
+
+	// Define quantas entradas o grid representa e volta ao topo
+	void SetEntryCount(int count)
+	{
+		m_EntryCount = Math.Max(0, count);
+		m_FirstEntry = -1;
+
+		if (m_Scroll)
+			m_Scroll.VScrollToPos(0);
+
+		Layout(true);
+
+		if (m_Scroll)
+			m_Scroll.Update();
+	}
+
+	// Acrescenta entradas mantendo o scroll (carregamento incremental da categoria)
+	void ExtendEntryCount(int count)
+	{
+		if (count <= m_EntryCount)
+			return;
+
+		m_EntryCount = count;
+		Layout(false);
+
+		if (m_Scroll)
+			m_Scroll.Update();
+	}
+
+	int GetEntryCount()
+	{
+		return m_EntryCount;
+	}
+
+	// Verifica scroll/tamanho e religa cards somente se a janela visível mudou
+	void Refresh()
+	{
+		if (!m_Scroll || !m_Wrap || m_EntryCount == 0)
+			return;
+
+		float viewWidth;
+		float viewHeight;
+		float wrapWidth;
+		float wrapHeight;
+		m_Scroll.GetScreenSize(viewWidth, viewHeight);
+		m_Wrap.GetScreenSize(wrapWidth, wrapHeight);
+		float scrollPos = m_Scroll.GetVScrollPos();
+
+		if (scrollPos == m_LastScrollPos && viewHeight == m_LastViewHeight && wrapWidth == m_LastWrapWidth)
+			return;
+
+		Layout(false);
+	}
+
+	// Religa todos os cards visíveis (ex: seleção ou health mudou)
+	void RebindVisible()
+	{
+		Layout(true);
+	}
+
+	// Esconde todos os cards (o pool é mantido para reuso)
+	void Clear()
+	{
+		m_EntryCount = 0;
+		m_FirstEntry = -1;
+		m_BoundCount = 0;
+
+		for (int i = 0; i < m_Pool.Count(); i++)
+		{
+			ReleaseCard(i);
+		}
+
+		if (m_TopSpacer)
+			m_TopSpacer.Show(false);
+		if (m_BottomSpacer)
+			m_BottomSpacer.Show(false);
+		if (m_Wrap)
+			m_Wrap.Update();
+	}
+
+	// Card atualmente ligado a uma entrada (NULL se fora da janela visível)
+	Widget GetCardForEntry(int entryIndex)
+	{
+		for (int i = 0; i < m_PoolEntries.Count(); i++)
+		{
+			if (m_PoolEntries[i] == entryIndex)
+				return m_Pool[i];
+		}
+		return NULL;
+	}
+
+	int GetFirstVisibleEntry()
+	{
+		return m_FirstEntry;
+	}
+
+	int GetVisibleCount()
+	{
+		return m_BoundCount;
+	}
+
+	// ========================================
+	// LAYOUT
+	// ========================================
+	protected void Layout(bool force)
+	{
+		if (!m_Wrap)
+			return;
+
+		if (m_EntryCount == 0)
+		{
+			Clear();
+			return;
+		}
+
+		MeasureSlot();
+
+		float viewWidth;
+		float viewHeight;
+		float wrapWidth;
+		float wrapHeight;
+		if (m_Scroll)
+			m_Scroll.GetScreenSize(viewWidth, viewHeight);
+		m_Wrap.GetScreenSize(wrapWidth, wrapHeight);
+		if (viewHeight <= 0)
+			viewHeight = m_SlotHeight * 3;
+
+		float scrollPos = 0;
+		if (m_Scroll)
+			scrollPos = m_Scroll.GetVScrollPos();
+
+		m_LastScrollPos = scrollPos;
+		m_LastViewHeight = viewHeight;
+		m_LastWrapWidth = wrapWidth;
+
+		int columns = Math.Floor((wrapWidth - WRAP_PADDING * 2) / m_SlotWidth);
+		if (columns < 1)
+			columns = 1;
+
+		int totalRows = (m_EntryCount + columns - 1) / columns;
+		int firstRow = Math.Floor(Math.Max(0, scrollPos - WRAP_PADDING) / m_SlotHeight) - MARGIN_ROWS;
+		if (firstRow < 0)
+			firstRow = 0;
+		if (firstRow > totalRows - 1)
+			firstRow = Math.Max(0, totalRows - 1);
+
+		int windowRows = Math.Ceil(viewHeight / m_SlotHeight) + 1 + MARGIN_ROWS * 2;
+		if (firstRow + windowRows > totalRows)
+			windowRows = totalRows - firstRow;
+
+		int firstEntry = firstRow * columns;
+		int boundCount = Math.Min(windowRows * columns, m_EntryCount - firstEntry);
+
+		if (!force && firstEntry == m_FirstEntry && boundCount == m_BoundCount && columns == m_Columns && totalRows == m_TotalRows)
+			return;
+
+		m_FirstEntry = firstEntry;
+		m_BoundCount = boundCount;
+		m_Columns = columns;
+		m_TotalRows = totalRows;
+
+		EnsurePoolSize(boundCount);
+
+		// Espaçadores ocupam a altura das linhas fora da janela
+		float rowWidth = columns * m_SlotWidth - CARD_MARGIN * 2;
+		SetSpacerRows(m_TopSpacer, firstRow, rowWidth);
+		SetSpacerRows(m_BottomSpacer, totalRows - firstRow - windowRows, rowWidth);
+
+		AssignWindow(firstEntry, boundCount, force);
+
+		m_Wrap.Update();
+	}
+
+	// Liga as entradas [firstEntry, firstEntry + boundCount) aos cards do pool
+	// Cards que já mostram uma entrada da janela são mantidos; só as entradas novas
+	// (ao rolar, a linha que entrou) recebem um card reciclado e são religadas
+	protected void AssignWindow(int firstEntry, int boundCount, bool force)
+	{
+		int lastEntry = firstEntry + boundCount;
+		map<int, Widget> keptCards = new map<int, Widget>();
+		array<Widget> freeCards = new array<Widget>();
+		array<int> freeEntries = new array<int>();
+
+		for (int poolIndex = 0; poolIndex < m_Pool.Count(); poolIndex++)
+		{
+			int currentEntry = m_PoolEntries[poolIndex];
+			if (!force && currentEntry >= firstEntry && currentEntry < lastEntry)
+			{
+				keptCards.Set(currentEntry, m_Pool[poolIndex]);
+			}
+			else
+			{
+				freeCards.Insert(m_Pool[poolIndex]);
+				freeEntries.Insert(currentEntry);
+			}
+		}
+
+		array<Widget> orderedCards = new array<Widget>();
+		array<int> orderedEntries = new array<int>();
+		int freeCursor = 0;
+
+		for (int slot = 0; slot < boundCount; slot++)
+		{
+			int entryIndex = firstEntry + slot;
+			Widget card;
+			if (!keptCards.Find(entryIndex, card))
+			{
+				if (freeCursor >= freeCards.Count())
+					break;
+
+				card = freeCards[freeCursor];
+				freeCursor++;
+				m_Owner.BindGridCard(card, entryIndex);
+			}
+
+			card.Show(true);
+			orderedCards.Insert(card);
+			orderedEntries.Insert(entryIndex);
+		}
+
+		for (int spareIndex = freeCursor; spareIndex < freeCards.Count(); spareIndex++)
+		{
+			Widget spareCard = freeCards[spareIndex];
+			if (freeEntries[spareIndex] >= 0)
+				m_Owner.ReleaseGridCard(spareCard);
+			spareCard.Show(false);
+			orderedCards.Insert(spareCard);
+			orderedEntries.Insert(-1);
+		}
+
+		// O wrap posiciona pela ordem dos filhos: o prefixo que já está na ordem certa fica,
+		// o resto volta para o fim (ao rolar para baixo, só os cards reciclados se movem)
+		int inPlace = 0;
+		for (int childIndex = 0; childIndex < m_Pool.Count() && inPlace < orderedCards.Count(); childIndex++)
+		{
+			if (m_Pool[childIndex] == orderedCards[inPlace])
+				inPlace++;
+		}
+
+		if (inPlace < orderedCards.Count())
+		{
+			for (int moveIndex = inPlace; moveIndex < orderedCards.Count(); moveIndex++)
+			{
+				m_Wrap.RemoveChild(orderedCards[moveIndex]);
+				m_Wrap.AddChild(orderedCards[moveIndex], false);
+			}
+
+			if (m_BottomSpacer)
+			{
+				m_Wrap.RemoveChild(m_BottomSpacer);
+				m_Wrap.AddChild(m_BottomSpacer, false);
+			}
+		}
+
+		m_Pool = orderedCards;
+		m_PoolEntries = orderedEntries;
+	}
+
+	protected void MeasureSlot()
+	{
+		if (m_SlotHeight > 0)
+			return;
+
+		float cardWidth = DEFAULT_CARD_WIDTH;
+		float cardHeight = DEFAULT_CARD_HEIGHT;
+
+		EnsurePoolSize(1);
+		Widget probe = m_Pool[0];
+		probe.Show(true);
+		m_Wrap.Update();
+
+		float measuredWidth;
+		float measuredHeight;
+		probe.GetScreenSize(measuredWidth, measuredHeight);
+		if (measuredWidth > 0 && measuredHeight > 0)
+		{
+			cardWidth = measuredWidth;
+			cardHeight = measuredHeight;
+		}
+
+		if (m_PoolEntries[0] < 0)
+			probe.Show(false);
+
+		m_SlotWidth = cardWidth + CARD_MARGIN * 2;
+		m_SlotHeight = cardHeight + CARD_MARGIN * 2;
+	}
+
+	protected void EnsurePoolSize(int size)
+	{
+		if (m_Pool.Count() >= size)
+			return;
+
+		while (m_Pool.Count() < size)
+		{
+			Widget card = GetGame().GetWorkspace().CreateWidgets(CARD_LAYOUT, m_Wrap);
+			if (!card)
+				break;
+
+			card.Show(false);
+			m_Pool.Insert(card);
+			m_PoolEntries.Insert(-1);
+		}
+
+		// Espaçador inferior precisa continuar sendo o último filho
+		if (m_BottomSpacer)
+		{
+			m_Wrap.RemoveChild(m_BottomSpacer);
+			m_Wrap.AddChild(m_BottomSpacer, false);
+		}
+	}
+
+	protected void ReleaseCard(int poolIndex)
+	{
+		if (m_PoolEntries[poolIndex] < 0)
+			return;
+
+		m_PoolEntries.Set(poolIndex, -1);
+		m_Owner.ReleaseGridCard(m_Pool[poolIndex]);
+		m_Pool[poolIndex].Show(false);
+	}
+
+	protected Widget CreateSpacer()
+	{
+		Widget spacer = GetGame().GetWorkspace().CreateWidget(FrameWidgetTypeID, 0, 0, 1, 1, WidgetFlags.EXACTSIZE | WidgetFlags.IGNOREPOINTER, ARGB(0, 0, 0, 0), 0, m_Wrap);
+		if (spacer)
+			spacer.Show(false);
+		return spacer;
+	}
+
+	protected void SetSpacerRows(Widget spacer, int rows, float rowWidth)
+	{
+		if (!spacer)
+			return;
+
+		if (rows <= 0)
+		{
+			spacer.Show(false);
+			return;
+		}
+
+		// A margem do wrap também é aplicada ao espaçador
+		spacer.SetSize(rowWidth, rows * m_SlotHeight - CARD_MARGIN * 2);
+		spacer.Show(true);
+	}
+}
@@ -0,0 +1,276 @@
+// ========================================
+// AskalNotificationStack - Pilha de notificações de compra/venda
+// Anel fixo de cards reutilizados: a notificação mais antiga cede o card quando
+// o anel está cheio; previews vêm do AskalPreviewPool (sem entidade por card)
+// ========================================
+
+class AskalNotificationSlot
+{
+	Widget Card;
+	Widget SlidePanel;
+	Widget ColorTarget;
+	MultilineTextWidget ActionText;
+	MultilineTextWidget NameText;
+	MultilineTextWidget PriceText;
+	ItemPreviewWidget Preview;
+	float ShownAt;
+	float AnimationStart;   // -1 = slide concluído
+	float BasePosY;
+	float ParentWidth;
+}
+
+class AskalNotificationStack
+{
+	protected static const string CARD_LAYOUT = "askal/market/gui/new_layouts/askal_store_notification_card.layout";
+	protected static const int CAPACITY = 10;                 // Cards no anel (máximo visível)
+	protected static const float LIFETIME = 5.0;              // Segundos até a notificação expirar
+	protected static const float ANIMATION_DURATION = 0.5;    // Duração do slide de entrada
+	protected static const float SLIDE_OFFSET_PX = 70.0;      // Deslocamento inicial do slide
+
+	protected WrapSpacerWidget m_Holder;
+	protected AskalPreviewPool m_PreviewPool;
+	protected ref array<ref AskalNotificationSlot> m_Slots;   // Todos os cards criados (até CAPACITY)
+	protected ref array<AskalNotificationSlot> m_Active;      // Visíveis, do mais antigo ao mais novo
+	protected ref array<AskalNotificationSlot> m_Free;        // Ocultos, prontos para reuso
+	protected bool m_Animating;
+
+	void AskalNotificationStack(WrapSpacerWidget holder, AskalPreviewPool previewPool)
+	{
+		m_Holder = holder;
+		m_PreviewPool = previewPool;
+		m_Slots = new array<ref AskalNotificationSlot>();
+		m_Active = new array<AskalNotificationSlot>();
+		m_Free = new array<AskalNotificationSlot>();
+		m_Animating = false;
+	}
+
+	// Exibe uma notificação (priceText já formatado pelo menu)
+	bool Push(string actionType, string description, string previewClassName, string priceText, bool isPurchase)
+	{
+		AskalNotificationSlot slot = AcquireSlot();
+		if (!slot)
+			return false;
+
+		if (slot.ColorTarget)
+		{
+			// Compra = verde, venda = laranja
+			if (isPurchase)
+				slot.ColorTarget.SetColor(ARGB(200, 9, 116, 0));
+			else
+				slot.ColorTarget.SetColor(ARGB(200, 131, 67, 0));
+		}
+
+		if (slot.ActionText)
+			slot.ActionText.SetText(actionType);
+		if (slot.NameText)
+			slot.NameText.SetText(description);
+		if (slot.PriceText)
+			slot.PriceText.SetText(priceText);
+
+		if (slot.Preview)
+		{
+			if (m_PreviewPool && previewClassName != "")
+				m_PreviewPool.Request(slot.Preview, previewClassName, NULL);
+			else
+				slot.Preview.Show(false);
+		}
+
+		slot.ShownAt = GetGame().GetTickTime();
+		StartSlide(slot);
+
+		// O card reutilizado vai para o fim da pilha (mais novo embaixo)
+		m_Holder.RemoveChild(slot.Card);
+		m_Holder.AddChild(slot.Card, false);
+		slot.Card.Show(true);
+		m_Active.Insert(slot);
+		m_Holder.Update();
+		return true;
+	}
+
+	// Oculta as notificações expiradas; retorna os ms até a próxima expiração (-1 = nenhuma)
+	int ExpireOld()
+	{
+		float currentTime = GetGame().GetTickTime();
+		bool changed = false;
+		while (m_Active.Count() > 0 && currentTime - m_Active[0].ShownAt > LIFETIME)
+		{
+			ReleaseSlot(m_Active[0]);
+			m_Free.Insert(m_Active[0]);
+			m_Active.RemoveOrdered(0);
+			changed = true;
+		}
+
+		if (changed)
+			m_Holder.Update();
+
+		if (m_Active.Count() == 0)
+			return -1;
+
+		float remaining = LIFETIME - (currentTime - m_Active[0].ShownAt);
+		return Math.Max(0, remaining * 1000) + 50;
+	}
+
+	// Avança os slides em andamento; false quando não há mais nada animando
+	bool Animate()
+	{
+		if (!m_Animating)
+			return false;
+
+		float currentTime = GetGame().GetTickTime();
+		bool stillAnimating = false;
+		foreach (AskalNotificationSlot slot : m_Active)
+		{
+			if (!slot.SlidePanel || slot.AnimationStart < 0)
+				continue;
+
+			float elapsed = currentTime - slot.AnimationStart;
+			if (elapsed >= ANIMATION_DURATION)
+			{
+				slot.SlidePanel.SetPos(0, slot.BasePosY);
+				slot.SlidePanel.Update();
+				slot.AnimationStart = -1;
+				continue;
+			}
+
+			float t = elapsed / ANIMATION_DURATION;
+			float eased = 1.0 - Math.Pow(1.0 - t, 3.0); // ease-out cubic
+			float offsetPx = Math.Lerp(SLIDE_OFFSET_PX, 0.0, eased);
+			slot.SlidePanel.SetPos(offsetPx / slot.ParentWidth, slot.BasePosY);
+			slot.SlidePanel.Update();
+			stillAnimating = true;
+		}
+
+		m_Animating = stillAnimating;
+		return stillAnimating;
+	}
+
+	bool IsAnimating()
+	{
+		return m_Animating;
+	}
+
+	int GetActiveCount()
+	{
+		return m_Active.Count();
+	}
+
+	// Oculta todas as notificações (os cards ficam no anel para a próxima abertura)
+	void Clear()
+	{
+		foreach (AskalNotificationSlot slot : m_Active)
+		{
+			ReleaseSlot(slot);
+			m_Free.Insert(slot);
+		}
+		m_Active.Clear();
+		m_Animating = false;
+
+		if (m_Holder)
+			m_Holder.Update();
+	}
+
+	// ========================================
+	// Internos
+	// ========================================
+	protected AskalNotificationSlot AcquireSlot()
+	{
+		if (!m_Holder)
+			return NULL;
+
+		if (m_Free.Count() > 0)
+		{
+			AskalNotificationSlot freeSlot = m_Free[m_Free.Count() - 1];
+			m_Free.Remove(m_Free.Count() - 1);
+			return freeSlot;
+		}
+
+		if (m_Slots.Count() < CAPACITY)
+		{
+			AskalNotificationSlot created = CreateSlot();
+			if (created)
+				return created;
+		}
+
+		// Anel cheio: a notificação mais antiga cede o card
+		if (m_Active.Count() == 0)
+			return NULL;
+
+		AskalNotificationSlot oldest = m_Active[0];
+		m_Active.RemoveOrdered(0);
+		ReleaseSlot(oldest);
+		return oldest;
+	}
+
+	protected AskalNotificationSlot CreateSlot()
+	{
+		Widget card = GetGame().GetWorkspace().CreateWidgets(CARD_LAYOUT, m_Holder);
+		if (!card)
+		{
+			Print("[AskalStore] ❌ Falha ao criar notification card!");
+			return NULL;
+		}
+
+		AskalNotificationSlot slot = new AskalNotificationSlot();
+		slot.Card = card;
+		slot.SlidePanel = card.FindAnyWidget("notification_slide_panel");
+		slot.ColorTarget = slot.SlidePanel;
+		if (!slot.ColorTarget)
+			slot.ColorTarget = card;
+
+		slot.ActionText = MultilineTextWidget.Cast(card.FindAnyWidget("action_text"));
+		slot.NameText = MultilineTextWidget.Cast(card.FindAnyWidget("action_item_name_text"));
+		if (!slot.NameText)
+			slot.NameText = MultilineTextWidget.Cast(card.FindAnyWidget("item_name_text"));
+		if (!slot.NameText)
+			slot.NameText = MultilineTextWidget.Cast(card.FindAnyWidget("description_text"));
+		slot.PriceText = MultilineTextWidget.Cast(card.FindAnyWidget("action_price"));
+		slot.Preview = ItemPreviewWidget.Cast(card.FindAnyWidget("action_item_preview"));
+
+		slot.AnimationStart = -1;
+		slot.BasePosY = 0;
+		if (slot.SlidePanel)
+		{
+			float basePosX;
+			float basePosY;
+			slot.SlidePanel.GetPos(basePosX, basePosY);
+			slot.BasePosY = basePosY;
+		}
+
+		card.Show(false);
+		m_Slots.Insert(slot);
+		return slot;
+	}
+
+	protected void StartSlide(AskalNotificationSlot slot)
+	{
+		slot.AnimationStart = -1;
+		if (!slot.SlidePanel)
+			return;
+
+		float parentWidthPx = 0;
+		float parentHeightPx;
+		Widget slideParent = slot.SlidePanel.GetParent();
+		if (slideParent)
+			slideParent.GetScreenSize(parentWidthPx, parentHeightPx);
+		if (parentWidthPx <= 0)
+			slot.SlidePanel.GetScreenSize(parentWidthPx, parentHeightPx);
+		if (parentWidthPx <= 0)
+			parentWidthPx = SLIDE_OFFSET_PX;
+
+		slot.ParentWidth = parentWidthPx;
+		slot.SlidePanel.SetPos(SLIDE_OFFSET_PX / parentWidthPx, slot.BasePosY);
+		slot.SlidePanel.Update();
+		slot.AnimationStart = GetGame().GetTickTime();
+		m_Animating = true;
+	}
+
+	// Oculta o card e devolve o preview ao pool (quem chama decide o destino do slot)
+	protected void ReleaseSlot(AskalNotificationSlot slot)
+	{
+		if (m_PreviewPool && slot.Preview)
+			m_PreviewPool.Release(slot.Preview);
+
+		slot.AnimationStart = -1;
+		slot.Card.Show(false);
+	}
+}
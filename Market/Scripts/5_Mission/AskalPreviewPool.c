@@ -0,0 +1,404 @@
+// ========================================
+// AskalPreviewPool - Pool de entidades de preview 3D
+// Entidades indexadas por classe + assinatura de attachments, compartilhadas entre
+// widgets, criadas sob demanda (poucas por frame) e descartadas por LRU
+// ========================================
+
+class AskalPreviewRequest
+{
+	string Key;
+	string ClassName;
+	ref array<string> Attachments;
+	EntityAI Source;     // Item real do inventário (attachments aninhados são copiados)
+	Widget Fallback;     // Ícone exibido enquanto a entidade não é criada
+
+	void AskalPreviewRequest(string key, string className, array<string> attachments, EntityAI source, Widget fallback)
+	{
+		Key = key;
+		ClassName = className;
+		Attachments = attachments;
+		Source = source;
+		Fallback = fallback;
+	}
+}
+
+class AskalPooledPreview
+{
+	string Key;
+	EntityAI Entity;
+	int Cost;        // 1 + attachments (peso no teto de memória)
+	int RefCount;    // Widgets exibindo esta entidade
+	int LastUsed;    // Contador de uso (LRU)
+
+	void AskalPooledPreview(string key, EntityAI entity, int cost)
+	{
+		Key = key;
+		Entity = entity;
+		Cost = cost;
+		RefCount = 0;
+		LastUsed = 0;
+	}
+}
+
+class AskalPreviewPool
+{
+	protected static const int MAX_POOL_COST = 96;    // Teto de entidades (+ attachments) mantidas vivas
+	protected static const int SPAWNS_PER_TICK = 3;   // Entidades criadas por chamada de ProcessPending
+	protected static const string DEFAULT_FALLBACK_ICON = "set:dayz_inventory image:missing";
+
+	protected AskalStoreMenu m_Owner;
+	protected ref map<string, ref AskalPooledPreview> m_Entries;               // key -> entidade
+	protected ref map<ItemPreviewWidget, string> m_Assigned;                   // widget -> key exibida
+	protected ref map<ItemPreviewWidget, ref AskalPreviewRequest> m_Pending;   // widget -> aguardando spawn
+	protected ref array<ItemPreviewWidget> m_PendingOrder;                     // Ordem de chegada
+	protected ref map<string, string> m_FallbackIcons;                         // className -> imagem do slot
+
+	protected int m_TotalCost;
+	protected int m_UseCounter;
+	protected int m_Hits;
+	protected int m_Spawns;
+	protected int m_Evictions;
+
+	void AskalPreviewPool(AskalStoreMenu owner)
+	{
+		m_Owner = owner;
+		m_Entries = new map<string, ref AskalPooledPreview>();
+		m_Assigned = new map<ItemPreviewWidget, string>();
+		m_Pending = new map<ItemPreviewWidget, ref AskalPreviewRequest>();
+		m_PendingOrder = new array<ItemPreviewWidget>();
+		m_FallbackIcons = new map<string, string>();
+		m_TotalCost = 0;
+		m_UseCounter = 0;
+		m_Hits = 0;
+		m_Spawns = 0;
+		m_Evictions = 0;
+	}
+
+	void ~AskalPreviewPool()
+	{
+		Clear();
+	}
+
+	// Liga ao widget o preview de um item do catálogo (attachments padrão)
+	void Request(ItemPreviewWidget widget, string className, array<string> attachments, Widget fallback = NULL)
+	{
+		if (!widget || !className || className == "")
+			return;
+
+		string key = className + "|" + BuildSignature(attachments);
+		RequestInternal(widget, new AskalPreviewRequest(key, className, attachments, NULL, fallback));
+	}
+
+	// Liga ao widget o preview de um item real do inventário (copia attachments aninhados)
+	void RequestFromInventory(ItemPreviewWidget widget, EntityAI source, Widget fallback = NULL)
+	{
+		if (!widget || !source)
+			return;
+
+		string className = source.GetType();
+		string key = className + "|" + BuildInventorySignature(source);
+		RequestInternal(widget, new AskalPreviewRequest(key, className, NULL, source, fallback));
+	}
+
+	// Desliga o widget (a entidade fica ociosa no pool para reuso)
+	void Release(ItemPreviewWidget widget)
+	{
+		if (!widget)
+			return;
+
+		if (m_Pending.Contains(widget))
+		{
+			m_Pending.Remove(widget);
+			int pendingIndex = m_PendingOrder.Find(widget);
+			if (pendingIndex != -1)
+				m_PendingOrder.RemoveOrdered(pendingIndex);
+		}
+
+		string key;
+		if (m_Assigned.Find(widget, key))
+		{
+			m_Assigned.Remove(widget);
+			widget.SetItem(NULL);
+
+			AskalPooledPreview entry;
+			if (m_Entries.Find(key, entry) && entry.RefCount > 0)
+			{
+				entry.RefCount--;
+				m_UseCounter++;
+				entry.LastUsed = m_UseCounter;
+			}
+		}
+
+		Trim();
+	}
+
+	// Cria as entidades pendentes dentro do orçamento por frame
+	void ProcessPending()
+	{
+		int spawned = 0;
+		while (m_PendingOrder.Count() > 0 && spawned < SPAWNS_PER_TICK)
+		{
+			ItemPreviewWidget widget = m_PendingOrder[0];
+			m_PendingOrder.RemoveOrdered(0);
+
+			AskalPreviewRequest request;
+			if (!widget || !m_Pending.Find(widget, request))
+				continue;
+			m_Pending.Remove(widget);
+
+			AskalPooledPreview entry = FindAlive(request.Key);
+			if (!entry)
+			{
+				entry = Spawn(request);
+				spawned++;
+				if (!entry)
+					continue;
+			}
+
+			Assign(widget, entry, request.Fallback);
+		}
+
+		if (spawned > 0)
+			Trim();
+	}
+
+	bool HasPending()
+	{
+		return m_PendingOrder.Count() > 0;
+	}
+
+	// Apaga todas as entidades (fechamento do menu)
+	void Clear()
+	{
+		foreach (ItemPreviewWidget assignedWidget, string assignedKey : m_Assigned)
+		{
+			if (assignedWidget)
+				assignedWidget.SetItem(NULL);
+		}
+
+		foreach (string entryKey, AskalPooledPreview entry : m_Entries)
+		{
+			if (entry && entry.Entity)
+				GetGame().ObjectDelete(entry.Entity);
+		}
+
+		m_Entries.Clear();
+		m_Assigned.Clear();
+		m_Pending.Clear();
+		m_PendingOrder.Clear();
+		m_TotalCost = 0;
+	}
+
+	string GetStatsSummary()
+	{
+		return "entities=" + m_Entries.Count() + " cost=" + m_TotalCost + "/" + MAX_POOL_COST + " pending=" + m_PendingOrder.Count() + " hits=" + m_Hits + " spawns=" + m_Spawns + " evictions=" + m_Evictions;
+	}
+
+	// ========================================
+	// Internos
+	// ========================================
+	protected void RequestInternal(ItemPreviewWidget widget, AskalPreviewRequest request)
+	{
+		// Mesmo conteúdo já ligado: nada a fazer
+		string currentKey;
+		if (m_Assigned.Find(widget, currentKey) && currentKey == request.Key)
+		{
+			if (request.Fallback)
+				request.Fallback.Show(false);
+			return;
+		}
+
+		Release(widget);
+
+		AskalPooledPreview entry = FindAlive(request.Key);
+		if (entry)
+		{
+			m_Hits++;
+			Assign(widget, entry, request.Fallback);
+			return;
+		}
+
+		widget.SetItem(NULL);
+		ShowFallback(request.Fallback, request.ClassName);
+		m_Pending.Set(widget, request);
+		m_PendingOrder.Insert(widget);
+	}
+
+	protected void Assign(ItemPreviewWidget widget, AskalPooledPreview entry, Widget fallback)
+	{
+		entry.RefCount++;
+		m_UseCounter++;
+		entry.LastUsed = m_UseCounter;
+		m_Assigned.Set(widget, entry.Key);
+
+		widget.SetItem(entry.Entity);
+		widget.SetModelPosition(Vector(0, 0, 0.5));
+		widget.SetModelOrientation(Vector(0, 0, 0));
+		widget.SetView(entry.Entity.GetViewIndex());
+		widget.Show(true);
+
+		if (fallback)
+			fallback.Show(false);
+	}
+
+	protected AskalPooledPreview FindAlive(string key)
+	{
+		AskalPooledPreview entry;
+		if (!m_Entries.Find(key, entry))
+			return NULL;
+
+		// Entidade removida por fora do pool: descarta a entrada
+		if (!entry.Entity)
+		{
+			m_TotalCost -= entry.Cost;
+			m_Entries.Remove(key);
+			return NULL;
+		}
+
+		return entry;
+	}
+
+	protected AskalPooledPreview Spawn(AskalPreviewRequest request)
+	{
+		EntityAI entity = m_Owner.CreatePooledPreviewEntity(request.ClassName, request.Attachments, request.Source);
+		if (!entity)
+		{
+			Print("[AskalPreviewPool] ❌ Falha ao criar entidade para preview: " + request.ClassName);
+			return NULL;
+		}
+
+		int cost = 1;
+		if (entity.GetInventory())
+			cost += entity.GetInventory().AttachmentCount();
+
+		AskalPooledPreview entry = new AskalPooledPreview(request.Key, entity, cost);
+		m_Entries.Set(request.Key, entry);
+		m_TotalCost += cost;
+		m_Spawns++;
+		return entry;
+	}
+
+	// Remove entidades ociosas (menos usadas recentemente primeiro) até caber no teto
+	protected void Trim()
+	{
+		while (m_TotalCost > MAX_POOL_COST)
+		{
+			AskalPooledPreview oldest = NULL;
+			foreach (string entryKey, AskalPooledPreview entry : m_Entries)
+			{
+				if (entry.RefCount > 0)
+					continue;
+				if (!oldest || entry.LastUsed < oldest.LastUsed)
+					oldest = entry;
+			}
+
+			// Tudo em uso: o teto é excedido até algum widget ser liberado
+			if (!oldest)
+				return;
+
+			if (oldest.Entity)
+				GetGame().ObjectDelete(oldest.Entity);
+			m_TotalCost -= oldest.Cost;
+			m_Entries.Remove(oldest.Key);
+			m_Evictions++;
+		}
+	}
+
+	protected void ShowFallback(Widget fallback, string className)
+	{
+		if (!fallback)
+			return;
+
+		ImageWidget fallbackImage = ImageWidget.Cast(fallback);
+		if (fallbackImage)
+			fallbackImage.LoadImageFile(0, ResolveFallbackIcon(className));
+		fallback.Show(true);
+	}
+
+	// Ícone do slot de inventário do item (ghostIcon do CfgSlots), ou "missing"
+	protected string ResolveFallbackIcon(string className)
+	{
+		string icon;
+		if (m_FallbackIcons.Find(className, icon))
+			return icon;
+
+		icon = DEFAULT_FALLBACK_ICON;
+		string configRoot = AskalInventoryFitPlanner.GetConfigRoot(className);
+		array<string> slotNames = new array<string>();
+		GetGame().ConfigGetTextArray(configRoot + " " + className + " inventorySlot", slotNames);
+		if (slotNames.Count() == 0)
+		{
+			string singleSlot = "";
+			GetGame().ConfigGetText(configRoot + " " + className + " inventorySlot", singleSlot);
+			if (singleSlot != "")
+				slotNames.Insert(singleSlot);
+		}
+
+		foreach (string slotName : slotNames)
+		{
+			string ghostIcon = "";
+			GetGame().ConfigGetText("CfgSlots Slot_" + slotName + " ghostIcon", ghostIcon);
+			if (ghostIcon != "")
+			{
+				icon = "set:dayz_inventory image:" + ghostIcon;
+				break;
+			}
+		}
+
+		m_FallbackIcons.Insert(className, icon);
+		return icon;
+	}
+
+	protected static string BuildSignature(array<string> attachments)
+	{
+		if (!attachments || attachments.Count() == 0)
+			return "";
+
+		array<string> sorted = new array<string>();
+		foreach (string attachmentClass : attachments)
+		{
+			if (attachmentClass && attachmentClass != "")
+				sorted.Insert(attachmentClass);
+		}
+		sorted.Sort();
+
+		return JoinSignature(sorted);
+	}
+
+	// Assinatura recursiva: "A(x,y),B" (mesma forma da assinatura do catálogo sem aninhados)
+	protected static string BuildInventorySignature(EntityAI entity)
+	{
+		if (!entity || !entity.GetInventory())
+			return "";
+
+		array<string> parts = new array<string>();
+		int attachmentCount = entity.GetInventory().AttachmentCount();
+		for (int i = 0; i < attachmentCount; i++)
+		{
+			EntityAI attachment = entity.GetInventory().GetAttachmentFromIndex(i);
+			if (!attachment)
+				continue;
+
+			string part = attachment.GetType();
+			string nested = BuildInventorySignature(attachment);
+			if (nested != "")
+				part += "(" + nested + ")";
+			parts.Insert(part);
+		}
+		parts.Sort();
+
+		return JoinSignature(parts);
+	}
+
+	protected static string JoinSignature(array<string> parts)
+	{
+		string signature = "";
+		foreach (string part : parts)
+		{
+			if (signature != "")
+				signature += ",";
+			signature += part;
+		}
+		return signature;
+	}
+}
@@ -45,7 +45,20 @@ class AskalStoreMenu extends UIScriptedMenu
 	// Painel Central - Lista de Itens
 	protected ScrollWidget m_ItensCardScroll;
 	protected WrapSpacerWidget m_ItensCardWrap;
-	protected ref array<Widget> m_ItemWidgets;
+	protected ref AskalItemCardGrid m_ItemCardGrid; // Grid virtualizado (cards reciclados)
+	protected ref array<int> m_GridItemIndexes;     // Entrada do grid -> índice em m_Items
+	protected int m_GridMode = 0;                   // 0 = catálogo (m_Items), 1 = inventário (m_InventoryDisplayItems)
+	
+	// Carregamento da categoria em fatias (primeira tela síncrona, o resto ao longo dos frames)
+	protected ref array<string> m_PendingCategoryClasses;  // Classes ainda não montadas em m_Items
+	protected ref map<string, bool> m_PendingProcessedClasses;
+	protected int m_PendingCategoryCursor = 0;
+	protected string m_PendingCategoryDatasetID;
+	protected string m_PendingCategoryID;
+	protected bool m_CategoryChunkScheduled = false;
+	protected const int CATEGORY_FIRST_SCREEN_ITEMS = 24;     // Montados no mesmo frame do clique
+	protected const int CATEGORY_CHUNK_BUDGET_TICKS = 40000;  // ~4ms por frame (TickCount: 10000 = 1ms)
+	protected ref AskalPreviewPool m_PreviewPool; // Previews 3D compartilhados dos cards (lazy + LRU)
 	protected ref map<Widget, int> m_ItemCardToIndex;
 	
 	// Painel Direito - Info Detalhada (item_details.layout)
@@ -128,11 +141,21 @@ class AskalStoreMenu extends UIScriptedMenu
 	protected EditBoxWidget m_SearchInput;
 	protected ButtonWidget m_SearchButton;
 	protected string m_SearchFilterText = "";
+	protected static const int SEARCH_DEBOUNCE_MS = 200;  // Espera entre teclas antes de pesquisar
+	protected ref array<int> m_SearchResults;              // Entradas do AskalSearchIndex da última pesquisa
+	protected string m_SearchResultsQuery = "";            // Query que gerou m_SearchResults
+	protected int m_SearchResultsRevision = -1;            // Revisão do índice usada em m_SearchResults
 	
 	// Hover Text
 	protected Widget m_HoverPanel;
 	protected TextWidget m_HoverText;
 	
+	// Painel de performance (F8; dados só para quem tem permissão no servidor)
+	protected Widget m_PerfPanel;
+	protected MultilineTextWidget m_PerfText;
+	protected static const int PERF_REFRESH_MS = 2000;
+	protected static const int PERF_DENIED_RETRY_MS = 60000; // F8 depois de negado só volta a pedir após este intervalo
+	
 	// Botões de Ação (apenas um por vez: compra OU venda)
 	protected ButtonWidget m_BuyButton; // buy_only_button_wide
 	protected ButtonWidget m_SellButton; // sell_only_button_wide
@@ -163,24 +186,19 @@ class AskalStoreMenu extends UIScriptedMenu
 	protected ref map<ButtonWidget, float> m_ButtonCooldownStartTimes;
 	
 	// Sistema de Inventário (para venda)
-	protected ref map<string, ref array<EntityAI>> m_PlayerInventoryItems; // className -> lista de EntityAI
-	protected ref map<string, float> m_ItemHealthMap; // className -> healthPercent (do servidor)
 	protected ref map<Widget, EntityAI> m_ItemCardToInventoryItem; // Card -> item real do inventário
 	protected EntityAI m_SelectedInventoryItem;
-	protected bool m_InventoryScanned = false;
+	protected bool m_HealthSubscribed = false; // Assinatura de health/quantidade ativa no servidor
+	protected bool m_QuotesDirty = false;      // Cotações de venda precisam ser pedidas de novo
+	protected const int INVENTORY_REFRESH_DEBOUNCE_MS = 150; // Agrupa rajadas de eventos de inventário
 	protected ref array<ref AskalInventoryDisplayInfo> m_InventoryDisplayItems;
 	
 	// Sistema de Notificações
 	protected WrapSpacerWidget m_NotificationCardHolder;
-	protected ref array<Widget> m_NotificationCards;
-	protected ref array<float> m_NotificationTimestamps;
-	protected ref array<Widget> m_NotificationSlidePanels;
-	protected ref array<float> m_NotificationAnimationStartTimes;
-	protected ref array<float> m_NotificationBasePosY;
-	protected ref array<float> m_NotificationSlideParentWidths;
-	protected const float NOTIFICATION_LIFETIME = 5.0; // 5 segundos
-	protected const int MAX_NOTIFICATIONS = 10; // Máximo de notificações visíveis
-	protected const float NOTIFICATION_ANIMATION_DURATION = 0.5; // Meio segundo para deslizar
+	protected ref AskalNotificationStack m_Notifications; // Anel de cards reutilizados (slides + expiração)
+	protected const int NOTIFICATION_BATCH_WINDOW_MS = 250; // Respostas de um lote viram um único card de resumo
+	protected const int NOTIFICATION_SUMMARY_MAX_NAMES = 3; // Itens listados no card de resumo
+	protected bool m_NotificationFlushScheduled = false;
 	
 	// Configuração do Trader Atual
 	protected string m_CurrentTraderName;
@@ -190,6 +208,14 @@ class AskalStoreMenu extends UIScriptedMenu
 	// Cache de resolução de dataset/categoria (performance)
 	protected ref map<string, Param2<string, string>> m_ItemToDatasetCategoryCache;
 	
+	// Tabelas de modo (montadas uma vez por abertura de trader / config da Virtual Store)
+	protected ref map<string, int> m_DatasetModes;   // datasetID -> modo
+	protected ref map<string, int> m_CategoryModes;  // "ds|cat" -> modo
+	protected ref map<string, int> m_ItemModes;      // "ds|cat|classname" -> modo (filtro da lista)
+	protected ref map<string, int> m_ClassModes;     // classname (lower)[|dataset|categoria] -> modo (botões compra/venda)
+	protected ref map<string, int> m_SetupModesLower; // SetupItems ativos com chave em lowercase
+	protected bool m_ModeTablesBuilt = false;
+	
 	// ========================================
 	// DADOS
 	// ========================================
@@ -259,7 +285,10 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		m_Datasets = new array<string>();
 		m_Categories = new array<string>();
 		m_CategoryDisplayNames = new array<string>();
-		m_ItemWidgets = new array<Widget>();
+		m_GridItemIndexes = new array<int>();
+		m_PendingCategoryClasses = new array<string>();
+		m_PendingProcessedClasses = new map<string, bool>();
+		m_PreviewPool = new AskalPreviewPool(this);
 		m_ItemCardToIndex = new map<Widget, int>();
 		m_VariantWidgets = new array<Widget>();
 		m_VariantCardToClassName = new map<Widget, string>();
@@ -286,17 +315,16 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		m_ItemCategoryIds = new array<string>();
 		m_DatasetCategoryHolders = new array<GridSpacerWidget>();
 		m_PreviewItems = new array<EntityAI>();
-		m_NotificationCards = new array<Widget>();
-		m_NotificationTimestamps = new array<float>();
-		m_NotificationSlidePanels = new array<Widget>();
 		
 		// Inicializar configuração do trader
 		m_CurrentTraderName = "";
 		m_TraderSetupItems = new map<string, int>();
 		m_ItemToDatasetCategoryCache = new map<string, Param2<string, string>>();
-		m_NotificationAnimationStartTimes = new array<float>();
-		m_NotificationBasePosY = new array<float>();
-		m_NotificationSlideParentWidths = new array<float>();
+		m_DatasetModes = new map<string, int>();
+		m_CategoryModes = new map<string, int>();
+		m_ItemModes = new map<string, int>();
+		m_ClassModes = new map<string, int>();
+		m_SetupModesLower = new map<string, int>();
 		m_ItemCardSelectionState = new map<Widget, bool>();
 		m_BatchBuySelectedIndexes = new map<int, bool>();
 		m_BatchSellSelectedEntities = new array<EntityAI>();
@@ -318,6 +346,7 @@ protected string m_LastVirtualStoreConfigSignature = "";
 			m_VirtualStoreSetupModes = new map<string, int>();
 		else
 			m_VirtualStoreSetupModes.Clear();
+		InvalidateModeTables();
 		
 		m_VirtualStoreConfigLoaded = true;
 		
@@ -430,6 +459,7 @@ protected string m_LastVirtualStoreConfigSignature = "";
 					m_VirtualStoreSetupModes.Set(key, mode);
 			}
 		}
+		InvalidateModeTables();
 		
 		if (buyCoeff <= 0)
 			buyCoeff = 1.0;
@@ -528,6 +558,8 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		m_CloseButton = ButtonWidget.Cast(m_RootWidget.FindAnyWidget("market_close_button"));
 		m_ItensCardScroll = ScrollWidget.Cast(m_RootWidget.FindAnyWidget("items_list_scroll_container"));
 		m_ItensCardWrap = WrapSpacerWidget.Cast(m_RootWidget.FindAnyWidget("items_cards_holder"));
+		if (m_ItensCardScroll && m_ItensCardWrap)
+			m_ItemCardGrid = new AskalItemCardGrid(this, m_ItensCardScroll, m_ItensCardWrap);
 		
 		// Dataset Cards Holder - CORRIGIDO: nome correto é datasets_scroll_container
 		Print("[AskalStore] 🔍 Buscando datasets_scroll_container...");
@@ -713,8 +745,6 @@ protected string m_LastVirtualStoreConfigSignature = "";
 	}
 	
 	// Inicializar maps de inventário
-		m_PlayerInventoryItems = new map<string, ref array<EntityAI>>();
-		m_ItemHealthMap = new map<string, float>();
 	m_ItemCardToInventoryItem = new map<Widget, EntityAI>();
 	m_InventoryDisplayItems = new array<ref AskalInventoryDisplayInfo>();
 	
@@ -737,10 +767,7 @@ protected string m_LastVirtualStoreConfigSignature = "";
 			Print("[AskalStore] ⚠️ market_notification_card_holder NÃO encontrado!");
 		}
 		
-		if (!m_NotificationCards)
-			m_NotificationCards = new array<Widget>();
-		if (!m_NotificationTimestamps)
-			m_NotificationTimestamps = new array<float>();
+		m_Notifications = new AskalNotificationStack(m_NotificationCardHolder, m_PreviewPool);
 		
 		// Painel de filtros adicionais
 		//	Widget optionsPanel = m_RootWidget.FindAnyWidget("options_panel");
@@ -829,6 +856,13 @@ protected string m_LastVirtualStoreConfigSignature = "";
 			m_HoverText = TextWidget.Cast(m_HoverPanel.FindAnyWidget("hover_tooltip_title_text"));
 		}
 		
+		m_PerfPanel = GetGame().GetWorkspace().CreateWidgets("askal/market/gui/new_layouts/askal_store_perf_panel.layout");
+		if (m_PerfPanel)
+		{
+			m_PerfPanel.Show(false);
+			m_PerfText = MultilineTextWidget.Cast(m_PerfPanel.FindAnyWidget("perf_panel_text"));
+		}
+		
 		Print("[AskalStore] Widgets inicializados");
 		
 		// Garantir que VirtualStoreConfig seja aplicado antes de carregar datasets
@@ -888,8 +922,8 @@ protected string m_LastVirtualStoreConfigSignature = "";
 			}
 		}
 		
-		// Escanear inventário do player
-		ScanPlayerInventory();
+		// Modelo incremental do inventário (enumera só na primeira abertura)
+		SyncInventoryModel();
 		
 		Print("[AskalStore] ================ Init() CONCLUÍDO ================");
 		return m_RootWidget;
@@ -996,6 +1030,19 @@ protected string m_LastVirtualStoreConfigSignature = "";
 	}
 	
 	int GetDatasetMode(string datasetID)
+	{
+		EnsureModeTables();
+		
+		int mode;
+		if (m_DatasetModes.Find(datasetID, mode))
+			return mode;
+		
+		mode = ComputeDatasetMode(datasetID);
+		m_DatasetModes.Set(datasetID, mode);
+		return mode;
+	}
+	
+	protected int ComputeDatasetMode(string datasetID)
 	{
 		// Determinar qual map usar: trader ou virtual store
 		ref map<string, int> setupItems = NULL;
@@ -1061,6 +1108,20 @@ protected string m_LastVirtualStoreConfigSignature = "";
 	// IMPORTANTE: Esta função NÃO verifica itens individuais - apenas categorias, datasets e ALL
 	// Itens individuais são verificados apenas em GetItemMode()
 	int GetCategoryMode(string datasetID, string categoryID)
+	{
+		EnsureModeTables();
+		
+		string modeKey = datasetID + "|" + categoryID;
+		int mode;
+		if (m_CategoryModes.Find(modeKey, mode))
+			return mode;
+		
+		mode = ComputeCategoryMode(datasetID, categoryID);
+		m_CategoryModes.Set(modeKey, mode);
+		return mode;
+	}
+	
+	protected int ComputeCategoryMode(string datasetID, string categoryID)
 	{
 		// Determinar qual map usar: trader ou virtual store
 		ref map<string, int> setupItems = NULL;
@@ -1086,33 +1147,9 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		
 		// PRIORIDADE 1: Verificar categoria específica (CAT_*)
 		// IMPORTANTE: Verificar também com busca case-insensitive para garantir que encontra
+		// (chaves CAT_* já estão normalizadas, a busca direta basta)
 		if (setupItems.Contains(normalizedCategoryID))
-		{
-			int catModeExact = setupItems.Get(normalizedCategoryID);
-			Print("[AskalStore] 🔍 GetCategoryMode: Categoria encontrada (exato) - " + normalizedCategoryID + " = " + catModeExact);
-			return catModeExact;
-		}
-		
-		// Busca case-insensitive para garantir que encontra a categoria
-		for (int keyIdx = 0; keyIdx < setupItems.Count(); keyIdx++)
-		{
-			string key = setupItems.GetKey(keyIdx);
-			if (!key || key == "")
-				continue;
-			
-			// Verificar se é uma categoria (CAT_*)
-			if (key.IndexOf("CAT_") == 0)
-			{
-				// Normalizar ambas as chaves para comparação
-				string normalizedKey = NormalizeCategoryID(key);
-				if (normalizedKey == normalizedCategoryID)
-				{
-					int catModeCaseInsensitive = setupItems.Get(key);
-					Print("[AskalStore] 🔍 GetCategoryMode: Categoria encontrada (case-insensitive) - " + key + " = " + catModeCaseInsensitive);
-					return catModeCaseInsensitive;
-				}
-			}
-		}
+			return setupItems.Get(normalizedCategoryID);
 		
 		// PRIORIDADE 2: Verificar dataset (DS_*)
 		// Se o dataset está configurado, todas as categorias ficam disponíveis
@@ -1145,8 +1182,6 @@ protected string m_LastVirtualStoreConfigSignature = "";
 					if (setupItems.Contains(itemClassName))
 					{
 						// Item individual encontrado - categoria fica disponível APENAS para exibir os itens configurados
-						// Retornar um modo especial que indica "categoria disponível apenas para itens individuais"
-						Print("[AskalStore] 🔍 GetCategoryMode: Categoria habilitada por item individual - " + normalizedCategoryID + " (via " + itemClassName + ")");
 						return 1; // Modo 1 = disponível, mas apenas itens configurados aparecerão
 					}
 				}
@@ -1158,6 +1193,20 @@ protected string m_LastVirtualStoreConfigSignature = "";
 	
 	// Verificar se um item está disponível e retornar o modo
 	int GetItemMode(string datasetID, string categoryID, string itemClassName)
+	{
+		EnsureModeTables();
+		
+		string modeKey = datasetID + "|" + categoryID + "|" + NormalizeClassName(itemClassName);
+		int mode;
+		if (m_ItemModes.Find(modeKey, mode))
+			return mode;
+		
+		mode = ComputeItemMode(datasetID, categoryID, itemClassName);
+		m_ItemModes.Set(modeKey, mode);
+		return mode;
+	}
+	
+	protected int ComputeItemMode(string datasetID, string categoryID, string itemClassName)
 	{
 		// Determinar qual map usar: trader ou virtual store
 		ref map<string, int> setupItems = NULL;
@@ -1184,47 +1233,12 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		// Normalizar className para busca case-insensitive
 		string normalizedClassName = NormalizeClassName(itemClassName);
 		
-		// PRIORIDADE 1: Verificar item específico (busca case-insensitive)
-		// Declarar variável uma única vez
+		// PRIORIDADE 1: Verificar item específico (case-insensitive via índice em lowercase)
 		int foundItemMode;
-		
-		// Primeiro tentar com className original (caso esteja exato no map)
 		if (setupItems.Contains(itemClassName))
-		{
-			foundItemMode = setupItems.Get(itemClassName);
-			Print("[AskalStore] 🔍 GetItemMode: Item específico encontrado (exato) - " + itemClassName + " = " + foundItemMode);
-			return foundItemMode;
-		}
-		
-		// Tentar com className normalizado
-		if (setupItems.Contains(normalizedClassName))
-		{
-			foundItemMode = setupItems.Get(normalizedClassName);
-			Print("[AskalStore] 🔍 GetItemMode: Item específico encontrado (normalizado) - " + normalizedClassName + " = " + foundItemMode);
+			return setupItems.Get(itemClassName);
+		if (m_SetupModesLower.Find(normalizedClassName, foundItemMode) && normalizedClassName.IndexOf("cat_") != 0 && normalizedClassName.IndexOf("ds_") != 0 && normalizedClassName != "all")
 			return foundItemMode;
-		}
-		
-		// Se não encontrou, tentar busca case-insensitive no map
-		// (verificar todas as chaves que não são CAT_*, DS_* ou "ALL")
-		for (int keyIdx = 0; keyIdx < setupItems.Count(); keyIdx++)
-		{
-			string key = setupItems.GetKey(keyIdx);
-			if (!key || key == "")
-				continue;
-			
-			// Pular chaves de categoria, dataset e "ALL"
-			if (key.IndexOf("CAT_") == 0 || key.IndexOf("DS_") == 0 || key == "ALL")
-				continue;
-			
-			// Comparar case-insensitive
-			string normalizedKey = NormalizeClassName(key);
-			if (normalizedKey == normalizedClassName)
-			{
-				foundItemMode = setupItems.Get(key);
-				Print("[AskalStore] 🔍 GetItemMode: Item específico encontrado (case-insensitive) - " + key + " = " + foundItemMode);
-				return foundItemMode;
-			}
-		}
 		
 		// PRIORIDADE 2: Verificar categoria (CAT_*)
 		// IMPORTANTE: Verificar se a categoria está explicitamente configurada (CAT_*)
@@ -1235,13 +1249,11 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		bool datasetConfigured = (datasetMode >= 0);
 		
 		int categoryMode = GetCategoryMode(normalizedDatasetID, normalizedCategoryID);
-		Print("[AskalStore] 🔍 GetItemMode: categoryMode=" + categoryMode + " | categoryExplicitlyConfigured=" + categoryExplicitlyConfigured + " | datasetConfigured=" + datasetConfigured + " | normalizedCategoryID=" + normalizedCategoryID + " | itemClassName=" + itemClassName);
 		
 		// IMPORTANTE: Se categoryMode é 0 (Disabled), SEMPRE retornar 0, independente de como foi encontrado
 		// Isso garante que categorias desabilitadas sempre bloqueiam os itens
 		if (categoryMode == 0)
 		{
-			Print("[AskalStore] 🔍 GetItemMode: Categoria com modo 0 (Disabled) encontrada - " + normalizedCategoryID + " = 0 (retornando)");
 			return 0;
 		}
 		
@@ -1249,7 +1261,6 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		// Se a categoria está explicitamente configurada (CAT_*), SEMPRE usar o modo da categoria, mesmo se for 0
 		if (categoryExplicitlyConfigured)
 		{
-			Print("[AskalStore] 🔍 GetItemMode: Categoria explicitamente configurada - " + normalizedCategoryID + " = " + categoryMode + " (retornando)");
 			return categoryMode; // Retorna 0 se disabled, ou outro valor se configurado
 		}
 		
@@ -1263,13 +1274,11 @@ protected string m_LastVirtualStoreConfigSignature = "";
 				// Categoria está disponível apenas por itens individuais
 				// Verificar se este item específico está configurado (já verificamos acima, mas vamos garantir)
 				// Se não está, não deve aparecer
-				Print("[AskalStore] 🔍 GetItemMode: Categoria disponível apenas por itens individuais - " + itemClassName + " não configurado, não aparece");
 				return -1;
 			}
 			
 			// Se a categoria está disponível por causa do dataset, usar o modo
 			// Isso inclui modo 0 (Disabled)
-			Print("[AskalStore] 🔍 GetItemMode: Categoria encontrada via dataset - " + normalizedCategoryID + " = " + categoryMode);
 			return categoryMode;
 		}
 		
@@ -1277,19 +1286,13 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		// datasetMode já foi declarado acima, apenas reutilizar
 		if (datasetMode >= 0)
 		{
-			Print("[AskalStore] 🔍 GetItemMode: Dataset encontrado - " + normalizedDatasetID + " = " + datasetMode);
 			return datasetMode;
 		}
 		
 		// PRIORIDADE 4: Verificar "ALL"
 		if (setupItems.Contains("ALL"))
-		{
-			int allMode = setupItems.Get("ALL");
-			Print("[AskalStore] 🔍 GetItemMode: ALL encontrado = " + allMode);
-			return allMode;
-		}
+			return setupItems.Get("ALL");
 		
-		Print("[AskalStore] 🔍 GetItemMode: Nenhuma configuração encontrada para " + itemClassName + " (DS: " + normalizedDatasetID + ", CAT: " + normalizedCategoryID + ")");
 		return -1;
 	}
 	
@@ -1311,15 +1314,92 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		return GetItemMode(datasetID, categoryID, itemClassName) >= 0;
 	}
 	
+	// ========================================
+	// TABELAS DE MODO (uma montagem por abertura)
+	// ========================================
+	
+	// SetupItems, trader ou catálogo mudaram: próxima consulta remonta as tabelas
+	protected void InvalidateModeTables()
+	{
+		m_ModeTablesBuilt = false;
+	}
+	
+	// Monta dataset/categoria/item/classe -> modo para o catálogo inteiro de uma vez
+	protected void EnsureModeTables()
+	{
+		if (m_ModeTablesBuilt)
+			return;
+		
+		// Marcar antes: as funções Compute* consultam os getters (que memorizam sob demanda)
+		m_ModeTablesBuilt = true;
+		m_DatasetModes.Clear();
+		m_CategoryModes.Clear();
+		m_ItemModes.Clear();
+		m_ClassModes.Clear();
+		m_SetupModesLower.Clear();
+		
+		map<string, int> setupItems = m_VirtualStoreSetupModes;
+		if (m_CurrentTraderName && m_CurrentTraderName != "")
+			setupItems = m_TraderSetupItems;
+		if (setupItems)
+		{
+			foreach (string setupKey, int setupMode : setupItems)
+			{
+				string setupKeyLower = setupKey;
+				setupKeyLower.ToLower();
+				if (!m_SetupModesLower.Contains(setupKeyLower))
+					m_SetupModesLower.Insert(setupKeyLower, setupMode);
+			}
+		}
+		
+		AskalDatabaseClientCache cache = AskalDatabaseClientCache.GetInstance();
+		if (!cache || !cache.GetDatasets())
+			return;
+		
+		int startTime = GetGame().GetTime();
+		map<string, ref AskalDatasetSyncData> datasets = cache.GetDatasets();
+		foreach (string datasetID, AskalDatasetSyncData dataset : datasets)
+		{
+			if (!dataset || !dataset.Categories)
+				continue;
+			
+			GetDatasetMode(datasetID);
+			foreach (string categoryID, AskalCategorySyncData category : dataset.Categories)
+			{
+				if (!category || !category.Items)
+					continue;
+				
+				GetCategoryMode(datasetID, categoryID);
+				foreach (string itemClassName, AskalItemSyncData itemData : category.Items)
+				{
+					GetItemMode(datasetID, categoryID, itemClassName);
+					
+					if (!m_ItemToDatasetCategoryCache.Contains(itemClassName))
+						m_ItemToDatasetCategoryCache.Set(itemClassName, new Param2<string, string>(datasetID, categoryID));
+					
+					ResolveItemModeForClass(itemClassName);
+					if (itemData && itemData.Variants)
+					{
+						foreach (string variantClass : itemData.Variants)
+						{
+							ResolveItemModeForClass(variantClass);
+						}
+					}
+				}
+			}
+		}
+		
+		Print("[AskalStore] ✅ Tabelas de modo montadas: " + m_ClassModes.Count() + " classes, " + m_CategoryModes.Count() + " categorias (" + (GetGame().GetTime() - startTime) + "ms)");
+	}
+	
 	// ========================================
 	// CARREGAMENTO DO CACHE DO CLIENTE
 	// ========================================
 	
-	// Buscar itens em todos os datasets quando há pesquisa
+	// Buscar itens em todos os datasets quando há pesquisa (via AskalSearchIndex)
 	void SearchAllDatasets()
 	{
-		Print("[AskalStore] ========================================");
-		Print("[AskalStore] SearchAllDatasets() - Buscando em todos os datasets");
+		Print("[AskalStore] SearchAllDatasets() - Pesquisando: '" + m_SearchFilterText + "'");
 		
 		if (!m_SearchFilterText || m_SearchFilterText == "")
 		{
@@ -1328,6 +1408,7 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		}
 		
 		// Limpar itens anteriores
+		CancelCategoryLoad();
 		ClearItemCards();
 		m_Items.Clear();
 		if (m_ItemDatasetIds)
@@ -1335,133 +1416,69 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		if (m_ItemCategoryIds)
 			m_ItemCategoryIds.Clear();
 		
-		// Ler do cache
-		AskalDatabaseClientCache cache = AskalDatabaseClientCache.GetInstance();
-		map<string, ref AskalDatasetSyncData> datasets = cache.GetDatasets();
-		
-		if (!datasets || datasets.Count() == 0)
+		AskalSearchIndex searchIndex = AskalSearchIndex.GetInstance();
+		if (!searchIndex.IsBuilt())
 		{
-			Print("[AskalStore] ❌ Nenhum dataset no cache!");
-			return;
+			AskalDatabaseClientCache cache = AskalDatabaseClientCache.GetInstance();
+			if (!cache.IsSynced())
+			{
+				Print("[AskalStore] ❌ Nenhum dataset no cache!");
+				return;
+			}
+			searchIndex.Build(cache);
 		}
 		
-		ref map<string, bool> processedClasses = new map<string, bool>();
-		ref map<string, bool> variantClassLookup = new map<string, bool>();
-		int totalFound = 0;
+		// Digitação incremental: a nova query contém a anterior, então só filtra o resultado anterior
+		array<int> narrowFrom = NULL;
+		if (m_SearchResults && m_SearchResultsRevision == searchIndex.GetRevision() && m_SearchResultsQuery != "" && m_SearchFilterText.Contains(m_SearchResultsQuery))
+			narrowFrom = m_SearchResults;
+		
+		m_SearchResults = searchIndex.Search(m_SearchFilterText, narrowFrom);
+		m_SearchResultsQuery = m_SearchFilterText;
+		m_SearchResultsRevision = searchIndex.GetRevision();
 		
-		// Iterar por todos os datasets
-		for (int dsIdx = 0; dsIdx < datasets.Count(); dsIdx++)
+		foreach (int entryIndex : m_SearchResults)
 		{
-			string datasetID = datasets.GetKey(dsIdx);
-			AskalDatasetSyncData dataset = datasets.GetElement(dsIdx);
-			
-			if (!dataset || !dataset.Categories)
+			AskalSearchEntry entry = searchIndex.GetEntry(entryIndex);
+			if (!entry || !entry.Item)
 				continue;
 			
-			// Iterar por todas as categorias do dataset
-			for (int catIdx = 0; catIdx < dataset.Categories.Count(); catIdx++)
+			AskalItemData newItem = new AskalItemData();
+			newItem.SetClassName(entry.ClassName);
+			newItem.SetDisplayName(entry.DisplayName);
+			newItem.SetBasePrice(entry.Item.BasePrice);
+			newItem.SetPrice(entry.Item.BasePrice);
+			
+			// Variantes herdam apenas o preço do item base
+			if (!entry.IsVariant)
 			{
-				string categoryID = dataset.Categories.GetKey(catIdx);
-				AskalCategorySyncData category = dataset.Categories.GetElement(catIdx);
-				
-				if (!category || !category.Items)
-					continue;
-				
-				// Iterar por todos os itens da categoria
-				for (int itemIdx = 0; itemIdx < category.Items.Count(); itemIdx++)
+				if (entry.Item.Variants)
 				{
-					string itemClassName = category.Items.GetKey(itemIdx);
-					AskalItemSyncData itemData = category.Items.GetElement(itemIdx);
-					
-					if (!itemData)
-						continue;
-					
-					// Verificar se o item corresponde à pesquisa
-					string displayName = itemData.DisplayName;
-					if (displayName == "")
-						displayName = itemClassName;
-					
-					if (!ItemMatchesSearchFilter(displayName, itemClassName))
-						continue;
-					
-					// Item encontrado! Adicionar à lista
-					if (!processedClasses.Contains(itemClassName))
-					{
-						processedClasses.Set(itemClassName, true);
-						
-						AskalItemData newItem = new AskalItemData();
-						newItem.SetClassName(itemClassName);
-						newItem.SetDisplayName(displayName);
-						newItem.SetBasePrice(itemData.BasePrice);
-						newItem.SetPrice(itemData.BasePrice);
-						if (itemData.Variants)
-						{
-							array<string> variants = newItem.GetVariants();
-							if (variants)
-							{
-								for (int varIdx = 0; varIdx < itemData.Variants.Count(); varIdx++)
-								{
-									string variant = itemData.Variants.Get(varIdx);
-									if (variant && variant != "")
-										variants.Insert(variant);
-								}
-							}
-						}
-						if (itemData.Attachments)
-							newItem.SetDefaultAttachments(itemData.Attachments);
-						
-						m_Items.Insert(newItem);
-						if (m_ItemDatasetIds)
-							m_ItemDatasetIds.Insert(datasetID);
-						if (m_ItemCategoryIds)
-							m_ItemCategoryIds.Insert(categoryID);
-						
-						totalFound++;
-					}
-					
-					// Processar variantes
-					if (itemData.Variants && itemData.Variants.Count() > 0)
+					array<string> variants = newItem.GetVariants();
+					if (variants)
 					{
-						foreach (string variantClass : itemData.Variants)
+						foreach (string variant : entry.Item.Variants)
 						{
-							if (variantClass && variantClass != "" && !variantClassLookup.Contains(variantClass))
-							{
-								variantClassLookup.Set(variantClass, true);
-								
-								string variantDisplay = ResolveItemDisplayName(variantClass, "");
-								if (variantDisplay == "")
-									variantDisplay = variantClass;
-								
-								if (ItemMatchesSearchFilter(variantDisplay, variantClass))
-								{
-									if (!processedClasses.Contains(variantClass))
-									{
-										processedClasses.Set(variantClass, true);
-										
-										AskalItemData variantItem = new AskalItemData();
-										variantItem.SetClassName(variantClass);
-										variantItem.SetDisplayName(variantDisplay);
-										variantItem.SetBasePrice(itemData.BasePrice);
-										variantItem.SetPrice(itemData.BasePrice);
-										
-										m_Items.Insert(variantItem);
-										if (m_ItemDatasetIds)
-											m_ItemDatasetIds.Insert(datasetID);
-										if (m_ItemCategoryIds)
-											m_ItemCategoryIds.Insert(categoryID);
-										
-										totalFound++;
-									}
-								}
-							}
+							if (variant && variant != "")
+								variants.Insert(variant);
 						}
 					}
 				}
+				if (entry.Item.Attachments)
+					newItem.SetDefaultAttachments(entry.Item.Attachments);
 			}
+			
+			m_Items.Insert(newItem);
+			if (m_ItemDatasetIds)
+				m_ItemDatasetIds.Insert(entry.DatasetID);
+			if (m_ItemCategoryIds)
+				m_ItemCategoryIds.Insert(entry.CategoryID);
 		}
 		
-		Print("[AskalStore] ✅ Pesquisa concluída: " + totalFound + " itens encontrados");
-		Print("[AskalStore] ========================================");
+		string searchMode = "completa";
+		if (narrowFrom)
+			searchMode = "incremental";
+		Print("[AskalStore] ✅ Pesquisa " + searchMode + " concluída: " + m_Items.Count() + " itens encontrados");
 		
 		// Atualizar breadcrumb para mostrar pesquisa
 		UpdateBreadcrumb("Pesquisa", "'" + m_SearchFilterText + "'");
@@ -1470,6 +1487,54 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		RenderItems();
 	}
 	
+	// Agenda a pesquisa para depois da última tecla (debounce)
+	protected void ScheduleSearch()
+	{
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(ApplySearchInput);
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).CallLater(ApplySearchInput, SEARCH_DEBOUNCE_MS, false);
+	}
+	
+	protected void CancelScheduledSearch()
+	{
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(ApplySearchInput);
+	}
+	
+	protected void ApplySearchInput()
+	{
+		if (!m_SearchInput)
+			return;
+		
+		string searchText = m_SearchInput.GetText();
+		searchText = searchText.Trim();
+		searchText.ToLower();
+		if (searchText == m_SearchFilterText)
+			return;
+		
+		m_SearchFilterText = searchText;
+		Print("[AskalStore] 🔍 Filtro de pesquisa atualizado: '" + m_SearchFilterText + "'");
+		
+		// Se há texto de pesquisa, buscar em todos os datasets
+		if (m_SearchFilterText != "")
+		{
+			SearchAllDatasets();
+			return;
+		}
+		
+		// Sem pesquisa, voltar à categoria atual
+		ResetSearchResults();
+		if (m_CurrentCategoryIndex >= 0 && m_CurrentCategoryIndex < m_Categories.Count())
+			LoadCategory(m_CurrentCategoryIndex);
+		else if (m_CurrentDatasetIndex >= 0 && m_CurrentDatasetIndex < m_Datasets.Count())
+			LoadDataset(m_CurrentDatasetIndex);
+	}
+	
+	protected void ResetSearchResults()
+	{
+		m_SearchResults = NULL;
+		m_SearchResultsQuery = "";
+		m_SearchResultsRevision = -1;
+	}
+	
 	void LoadDatasetsFromCore()
 	{
 		Print("[AskalStore] ========================================");
@@ -1759,6 +1824,7 @@ protected string m_LastVirtualStoreConfigSignature = "";
 			return;
 		}
 		
+		CancelCategoryLoad();
 		m_CurrentCategoryIndex = index;
 		string categoryID = m_Categories.Get(index);
 		
@@ -1800,66 +1866,147 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		if (m_ItemCategoryIds)
 			m_ItemCategoryIds.Clear();
 		
-		ref map<string, bool> processedClasses = new map<string, bool>();
-		ref map<string, bool> variantClassLookup = new map<string, bool>();
+		map<string, bool> variantClassLookup = new map<string, bool>();
 		for (int variantIdx = 0; variantIdx < category.Items.Count(); variantIdx++)
 		{
-			string variantSourceClass = category.Items.GetKey(variantIdx);
-			AskalItemSyncData variantSourceData = category.Items.Get(variantSourceClass);
+			AskalItemSyncData variantSourceData = category.Items.GetElement(variantIdx);
 			if (!variantSourceData || !variantSourceData.Variants || variantSourceData.Variants.Count() == 0)
 				continue;
 			foreach (string variantClassName : variantSourceData.Variants)
 			{
 				if (variantClassName && variantClassName != "")
-				{
 					variantClassLookup.Set(variantClassName, true);
-				}
 			}
 		}
-		array<string> orderedItemIDs = new array<string>();
+		
+		// Lista principal (variantes entram junto do item base) filtrada pelo SetupItems do trader
+		// Modo -1 = disabled (não aparece), modo 0+ = aparece (mas botões podem estar desabilitados)
+		int filteredCount = 0;
 		for (int itemMainIdx = 0; itemMainIdx < category.Items.Count(); itemMainIdx++)
 		{
 			string candidateClassName = category.Items.GetKey(itemMainIdx);
 			if (variantClassLookup.Contains(candidateClassName))
+				continue;
+			
+			if (GetItemMode(datasetID, categoryID, candidateClassName) < 0)
 			{
-				Print("[AskalStore] 🔁 Ignorando variante na lista principal: " + candidateClassName);
+				filteredCount++;
 				continue;
 			}
-			orderedItemIDs.Insert(candidateClassName);
+			m_PendingCategoryClasses.Insert(candidateClassName);
+		}
+		
+		m_PendingCategoryDatasetID = datasetID;
+		m_PendingCategoryID = categoryID;
+		
+		// Primeira tela no mesmo frame; o restante é montado em fatias com orçamento de tempo
+		BuildCategoryChunk(true);
+		RenderItems();
+		UpdateCategoryCardsVisual();
+		
+		if (HasPendingCategoryItems())
+			ScheduleCategoryChunk();
+		
+		int pendingCount = m_PendingCategoryClasses.Count() - m_PendingCategoryCursor;
+		Print("[AskalStore] ✅ " + m_Items.Count() + " items na primeira tela, " + pendingCount + " pendentes, " + filteredCount + " filtrados");
+		Print("[AskalStore] ========================================");
+	}
+	
+	// ========================================
+	// CARREGAMENTO DA CATEGORIA EM FATIAS
+	// ========================================
+	
+	protected bool HasPendingCategoryItems()
+	{
+		return m_PendingCategoryCursor < m_PendingCategoryClasses.Count();
+	}
+	
+	protected void ScheduleCategoryChunk()
+	{
+		if (m_CategoryChunkScheduled)
+			return;
+		
+		m_CategoryChunkScheduled = true;
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).CallLater(ContinueCategoryLoad, 0, false);
+	}
+	
+	// Navegação (outra categoria, pesquisa global, fechar menu) descarta as fatias restantes
+	protected void CancelCategoryLoad()
+	{
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(ContinueCategoryLoad);
+		m_CategoryChunkScheduled = false;
+		m_PendingCategoryClasses.Clear();
+		m_PendingProcessedClasses.Clear();
+		m_PendingCategoryCursor = 0;
+	}
+	
+	protected void ContinueCategoryLoad()
+	{
+		m_CategoryChunkScheduled = false;
+		if (!HasPendingCategoryItems())
+			return;
+		
+		int firstNewItem = m_Items.Count();
+		BuildCategoryChunk(false);
+		AppendGridEntries(firstNewItem);
+		
+		if (HasPendingCategoryItems())
+		{
+			ScheduleCategoryChunk();
+			return;
+		}
+		
+		Print("[AskalStore] ✅ Categoria carregada: " + m_Items.Count() + " items");
+	}
+	
+	// Monta a próxima fatia de m_Items: a primeira tela por contagem, as demais por tempo
+	protected void BuildCategoryChunk(bool firstScreen)
+	{
+		AskalDatabaseClientCache cache = AskalDatabaseClientCache.GetInstance();
+		AskalDatasetSyncData dataset = NULL;
+		if (cache)
+			dataset = cache.GetDataset(m_PendingCategoryDatasetID);
+		AskalCategorySyncData category = NULL;
+		if (dataset && dataset.Categories)
+			category = dataset.Categories.Get(m_PendingCategoryID);
+		if (!category)
+		{
+			// Catálogo mudou no meio do carregamento
+			CancelCategoryLoad();
+			return;
 		}
 		
-		// Filtrar itens baseado no SetupItems do trader
-		for (int orderedIdx = 0; orderedIdx < orderedItemIDs.Count(); orderedIdx++)
+		int startTicks = TickCount(0);
+		int built = 0;
+		while (HasPendingCategoryItems())
 		{
-			string classNameLoop = orderedItemIDs.Get(orderedIdx);
+			if (firstScreen && built >= CATEGORY_FIRST_SCREEN_ITEMS)
+				break;
+			if (!firstScreen && built > 0 && TickCount(startTicks) >= CATEGORY_CHUNK_BUDGET_TICKS)
+				break;
 			
-			// Verificar se o item está disponível para este trader
-			// Modo -1 = disabled (não aparece), modo 0+ = aparece (mas botões podem estar desabilitados)
-			int itemMode = GetItemMode(datasetID, categoryID, classNameLoop);
-			if (itemMode < 0) // Modo -1 = disabled, não aparece na lista
-			{
-				Print("[AskalStore] 🔒 Item filtrado (disabled): " + classNameLoop);
-				continue;
-			}
+			string classNameLoop = m_PendingCategoryClasses.Get(m_PendingCategoryCursor);
+			m_PendingCategoryCursor++;
 			
 			AskalItemSyncData syncItemLoop = category.Items.Get(classNameLoop);
-			AddItemEntryForCategory(datasetID, categoryID, category, classNameLoop, syncItemLoop, processedClasses, cache, true);
-			
-			// Popular cache de dataset/categoria para performance
-			if (!m_ItemToDatasetCategoryCache.Contains(classNameLoop))
-			{
-				m_ItemToDatasetCategoryCache.Set(classNameLoop, new Param2<string, string>(datasetID, categoryID));
-			}
+			AddItemEntryForCategory(m_PendingCategoryDatasetID, m_PendingCategoryID, category, classNameLoop, syncItemLoop, m_PendingProcessedClasses, cache, true);
+			built++;
 		}
+	}
+	
+	// Acrescenta ao grid os itens montados a partir de firstNewItem (sem voltar o scroll)
+	protected void AppendGridEntries(int firstNewItem)
+	{
+		if (m_GridMode != 0 || m_ShowingInventoryForSale || !m_ItemCardGrid)
+			return;
 		
-		// Renderizar items (incluindo variantes)
-		RenderItems();
-		
-		// Atualizar category cards visual
-		UpdateCategoryCardsVisual();
+		for (int i = firstNewItem; i < m_Items.Count(); i++)
+		{
+			if (ItemPassesGridFilters(m_Items.Get(i)))
+				m_GridItemIndexes.Insert(i);
+		}
 		
-		Print("[AskalStore] ✅ " + m_Items.Count() + " items carregados");
-		Print("[AskalStore] ========================================");
+		m_ItemCardGrid.ExtendEntryCount(m_GridItemIndexes.Count());
 	}
 	
 		// ========================================
@@ -2028,13 +2175,10 @@ protected string m_LastVirtualStoreConfigSignature = "";
 	
 	void ClearItemCards()
 	{
-		// Limpar widgets de itens
-		foreach (Widget widget : m_ItemWidgets)
-		{
-			if (widget)
-				delete widget;
-		}
-		m_ItemWidgets.Clear();
+		// Esconder cards do grid (widgets ficam no pool para reuso)
+		if (m_ItemCardGrid)
+			m_ItemCardGrid.Clear();
+		m_GridItemIndexes.Clear();
 		m_ItemCardToIndex.Clear();
 	}
 	
@@ -2295,7 +2439,7 @@ protected string m_LastVirtualStoreConfigSignature = "";
 	{
 		Print("[AskalStore] RenderItems() - Total: " + m_Items.Count());
 		
-		if (!m_ItensCardWrap)
+		if (!m_ItensCardWrap || !m_ItemCardGrid)
 		{
 			Print("[AskalStore] ❌ m_ItensCardWrap é NULL!");
 			return;
@@ -2311,172 +2455,168 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		// Limpar itens anteriores
 		ClearItems();
 		
-		// Criar cards para cada item
+		// Montar lista de entradas (filtros); cards só são criados para a janela visível do scroll
 		for (int i = 0; i < m_Items.Count(); i++)
 		{
-			AskalItemData itemData = m_Items.Get(i);
-			
-			// FILTRO: Sellable Only
-			if (m_BatchSellEnabled && !IsItemInInventory(itemData.GetClassName()))
-			{
-				Print("[AskalStore] 🔍 Filtro Sellable Only: " + itemData.GetClassName() + " NÃO está no inventário, pulando...");
-				continue;
-			}
-			
-			// FILTRO: Pesquisa
-			string displayName = itemData.GetDisplayName();
-			if (displayName == "")
-				displayName = itemData.GetClassName();
-			
-			if (!ItemMatchesSearchFilter(displayName, itemData.GetClassName()))
-			{
-				Print("[AskalStore] 🔍 Filtro de pesquisa: " + itemData.GetClassName() + " não corresponde a '" + m_SearchFilterText + "', pulando...");
-				continue;
-			}
-			
-			// Criar card do item
-			Widget itemCard = GetGame().GetWorkspace().CreateWidgets("askal/market/gui/new_layouts/askal_store_item_card.layout", m_ItensCardWrap);
-			
-			if (!itemCard)
-				continue;
-			
-			// Configurar nome
-			TextWidget nameWidget = MultilineTextWidget.Cast(itemCard.FindAnyWidget("item_card_name_text"));
-			if (nameWidget)
-			{
-				nameWidget.SetText(displayName);
-			}
-				
-				// Configurar preço
-			TextWidget priceWidget = TextWidget.Cast(itemCard.FindAnyWidget("item_card_price_text"));
-				if (priceWidget)
-			{
-				string formattedPrice = FormatCurrencyValue(itemData.GetPrice());
-				priceWidget.SetText(formattedPrice);
-			}
-			
-			// RENDERIZAR MINIATURA 3D NO CARD
-			// O preview está dentro de item_preview_panel
-			Widget previewPanel = itemCard.FindAnyWidget("item_preview_panel");
-			ItemPreviewWidget cardPreview = NULL;
-			if (previewPanel)
-			{
-				cardPreview = ItemPreviewWidget.Cast(previewPanel.FindAnyWidget("item_preview_widget"));
-				if (!cardPreview)
-					Print("[AskalStore] ⚠️ item_preview_widget não encontrado dentro de item_preview_panel para: " + itemData.GetClassName());
-			}
-			else
-			{
-				Print("[AskalStore] ⚠️ item_preview_panel não encontrado para: " + itemData.GetClassName());
-			}
-			
-			if (!cardPreview)
-			{
-				cardPreview = ItemPreviewWidget.Cast(itemCard.FindAnyWidget("item_preview_widget"));
-				if (!cardPreview)
-					Print("[AskalStore] ⚠️ item_preview_widget não encontrado diretamente no card para: " + itemData.GetClassName());
-			}
+			if (ItemPassesGridFilters(m_Items.Get(i)))
+				m_GridItemIndexes.Insert(i);
+		}
+		
+		m_GridMode = 0;
+		m_ItemCardGrid.SetEntryCount(m_GridItemIndexes.Count());
+		
+		Print("[AskalStore] ✅ Renderização concluída! " + m_GridItemIndexes.Count() + " itens, " + m_ItemCardGrid.GetVisibleCount() + " cards ligados");
+	}
+	
+	protected bool ItemPassesGridFilters(AskalItemData itemData)
+	{
+		// FILTRO: Sellable Only
+		if (m_BatchSellEnabled && !IsItemInInventory(itemData.GetClassName()))
+			return false;
+		
+		// FILTRO: Pesquisa
+		string displayName = itemData.GetDisplayName();
+		if (displayName == "")
+			displayName = itemData.GetClassName();
+		
+		return ItemMatchesSearchFilter(displayName, itemData.GetClassName());
+	}
+	
+	// ========================================
+	// GRID VIRTUALIZADO - BIND DE CARDS
+	// ========================================
+	
+	// Chamado pelo AskalItemCardGrid quando um card reciclado recebe uma entrada
+	void BindGridCard(Widget itemCard, int entryIndex)
+	{
+		ReleaseGridCard(itemCard);
+		
+		if (m_GridMode == 1)
+		{
+			BindInventoryCard(itemCard, entryIndex);
+			return;
+		}
+		
+		if (entryIndex < 0 || entryIndex >= m_GridItemIndexes.Count())
+			return;
+		
+		BindCatalogCard(itemCard, m_GridItemIndexes.Get(entryIndex));
+	}
+	
+	// Chamado quando o card sai da janela visível: desfaz mapeamentos e libera o preview
+	void ReleaseGridCard(Widget itemCard)
+	{
+		if (!itemCard)
+			return;
+		
+		if (m_ItemCardToIndex.Contains(itemCard))
+			m_ItemCardToIndex.Remove(itemCard);
+		if (m_ItemCardToInventoryItem && m_ItemCardToInventoryItem.Contains(itemCard))
+			m_ItemCardToInventoryItem.Remove(itemCard);
+		if (IsCardSelected(itemCard))
+			SetCardSelected(itemCard, false);
+		
+		ItemPreviewWidget cardPreview = ItemPreviewWidget.Cast(itemCard.FindAnyWidget("item_preview_widget"));
+		if (cardPreview)
+			m_PreviewPool.Release(cardPreview);
+	}
+	
+	protected void BindCatalogCard(Widget itemCard, int itemIndex)
+	{
+		if (itemIndex < 0 || itemIndex >= m_Items.Count())
+			return;
+		
+		AskalItemData itemData = m_Items.Get(itemIndex);
+		if (!itemData)
+			return;
+		
+		string displayName = itemData.GetDisplayName();
+		if (displayName == "")
+			displayName = itemData.GetClassName();
+		
+		// Configurar nome
+		TextWidget nameWidget = MultilineTextWidget.Cast(itemCard.FindAnyWidget("item_card_name_text"));
+		if (nameWidget)
+		{
+			nameWidget.SetText(displayName);
+		}
+		
+		// Configurar preço
+		TextWidget priceWidget = TextWidget.Cast(itemCard.FindAnyWidget("item_card_price_text"));
+		if (priceWidget)
+		{
+			string formattedPrice = FormatCurrencyValue(itemData.GetPrice());
+			priceWidget.SetText(formattedPrice);
+		}
+		
+		// RENDERIZAR MINIATURA 3D NO CARD
+		// O preview está dentro de item_preview_panel (layouts antigos: direto no card)
+		ItemPreviewWidget cardPreview = NULL;
+		Widget previewPanel = itemCard.FindAnyWidget("item_preview_panel");
+		if (previewPanel)
+			cardPreview = ItemPreviewWidget.Cast(previewPanel.FindAnyWidget("item_preview_widget"));
+		if (!cardPreview)
+			cardPreview = ItemPreviewWidget.Cast(itemCard.FindAnyWidget("item_preview_widget"));
+		
+		if (cardPreview)
+		{
+			// Entidade vem do pool (criada em frames seguintes se ainda não existir)
+			m_PreviewPool.Request(cardPreview, itemData.GetClassName(), itemData.GetDefaultAttachments(), itemCard.FindAnyWidget("item_card_fallback_icon"));
+		}
+		else if (AskalLog.IsEnabled("Store", AskalLog.DEBUG))
+		{
+			AskalLog.Debug("Store", "item_preview_widget não encontrado no card de " + itemData.GetClassName());
+		}
+		
+		// INDICADOR DE INVENTÁRIO (ícone colorido por durabilidade)
+		EntityAI inventoryItemForCard = null;
+		ImageWidget inventoryIcon = ImageWidget.Cast(itemCard.FindAnyWidget("item_card_in_Inventory"));
+		if (inventoryIcon)
+		{
+			if (IsItemInInventory(itemData.GetClassName()))
+				inventoryItemForCard = GetFirstItemInInventory(itemData.GetClassName());
 			
-			if (cardPreview)
+			if (inventoryItemForCard)
 			{
-				EntityAI previewItem = EntityAI.Cast(SpawnTemporaryObject(itemData.GetClassName()));
-				if (previewItem)
-				{
-					ApplyDefaultAttachmentsToEntity(previewItem, itemData.GetDefaultAttachments());
-					cardPreview.SetItem(previewItem);
-					cardPreview.SetModelPosition(Vector(0, 0, 0.5));
-					cardPreview.SetModelOrientation(Vector(0, 0, 0));
-					cardPreview.SetView(previewItem.GetViewIndex());
-					cardPreview.Show(true);
-					m_PreviewItems.Insert(previewItem);
-					Print("[AskalStore] ✅ Preview 3D criado no card: " + itemData.GetClassName());
-										}
-										else
-										{
-					Print("[AskalStore] ❌ Falha ao criar entidade para preview: " + itemData.GetClassName());
-				}
+				// Health do item real (assinatura do servidor) ou 100% como fallback
+				float health = GetEntityHealth(inventoryItemForCard);
+				AskalColorHelper.ApplyHealthColor(inventoryIcon, health);
+				inventoryIcon.Show(true);
 			}
 			else
 			{
-				Print("[AskalStore] ❌ item_preview_widget não encontrado em nenhum lugar para: " + itemData.GetClassName());
-			}
-			
-			// INDICADOR DE INVENTÁRIO (ícone colorido por durabilidade)
-			EntityAI inventoryItemForCard = null;
-			ImageWidget inventoryIcon = ImageWidget.Cast(itemCard.FindAnyWidget("item_card_in_Inventory"));
-			if (inventoryIcon)
-			{
-				if (IsItemInInventory(itemData.GetClassName()))
-				{
-					EntityAI inventoryItem = GetFirstItemInInventory(itemData.GetClassName());
-					if (inventoryItem)
-					{
-					inventoryItemForCard = inventoryItem;
-					inventoryIcon.Show(true);
-					
-					// Obter health do servidor (via RPC) ou usar 100% como fallback
-					float health = GetItemHealth(itemData.GetClassName());
-					AskalColorHelper.ApplyHealthColor(inventoryIcon, health);
-						
-						Print("[AskalStore] 🎨 Indicador de inventário: " + itemData.GetClassName() + " | Health: " + health + "%");
-					}
-					else
-					{
-						inventoryIcon.Show(false);
-					}
-				}
-				else
-				{
-					inventoryIcon.Show(false);
-				}
-			}
-			
-			// Mapear card ao item real do inventário (para venda)
-			if (m_ItemCardToInventoryItem)
-			{
-				if (inventoryItemForCard)
-				{
-					m_ItemCardToInventoryItem.Set(itemCard, inventoryItemForCard);
-					Print("[AskalStore] 📦 Card mapeado ao item do inventário: " + itemData.GetClassName());
-				}
-				else if (m_ItemCardToInventoryItem.Contains(itemCard))
-				{
-					m_ItemCardToInventoryItem.Remove(itemCard);
-				}
+				inventoryIcon.Show(false);
 			}
-			
-			// Mapear card ao índice
-			m_ItemCardToIndex.Set(itemCard, i);
-			m_ItemWidgets.Insert(itemCard);
-			
-			Print("[AskalStore] ✅ Card criado: " + itemData.GetClassName());
 		}
 		
-		// FIX UpdateOffset: Atualizar containers após criar widgets
-		if (m_ItensCardWrap)
-		{
-			m_ItensCardWrap.Update();
-			Print("[AskalStore] ✅ ItensCardWrap atualizado");
-		}
-		if (m_ItensCardScroll)
+		// Mapear card ao item real do inventário (para venda)
+		if (m_ItemCardToInventoryItem)
 		{
-			m_ItensCardScroll.Update();
-			Print("[AskalStore] ✅ ItensCardScroll atualizado");
+			if (inventoryItemForCard)
+				m_ItemCardToInventoryItem.Set(itemCard, inventoryItemForCard);
+			else if (m_ItemCardToInventoryItem.Contains(itemCard))
+				m_ItemCardToInventoryItem.Remove(itemCard);
 		}
 		
-		Print("[AskalStore] ✅ Renderização concluída!");
+		// Mapear card ao índice
+		m_ItemCardToIndex.Set(itemCard, itemIndex);
+		
+		// Restaurar seleção de compra em lote (o card pode ter sido reciclado)
+		bool batchSelected = m_BatchBuySelectedIndexes && m_BatchBuySelectedIndexes.Contains(itemIndex);
+		SetCardSelected(itemCard, batchSelected);
 	}
 	
 	void RenderInventoryItemsForSale()
 	{
-		if (!m_ItensCardWrap)
+		if (!m_ItensCardWrap || !m_ItemCardGrid)
 			return;
 		
 		ClearItems();
 		
-		if (!m_PlayerInventoryItems)
+		AskalInventoryModel inventoryModel = AskalInventoryModel.GetInstance();
+		if (!inventoryModel.EnsureAttached())
 		{
-			Print("[AskalStore] ⚠️ m_PlayerInventoryItems é NULL, nada para renderizar");
+			Print("[AskalStore] ⚠️ Player não encontrado, nada para renderizar");
 			return;
 		}
 		
@@ -2484,11 +2624,10 @@ protected string m_LastVirtualStoreConfigSignature = "";
 			m_InventoryDisplayItems = new array<ref AskalInventoryDisplayInfo>();
 		m_InventoryDisplayItems.Clear();
 		
-		int totalCards = 0;
-		for (int mapIdx = 0; mapIdx < m_PlayerInventoryItems.Count(); mapIdx++)
+		map<string, ref array<EntityAI>> itemsByClass = inventoryModel.GetItemsByClass();
+		for (int mapIdx = 0; mapIdx < itemsByClass.Count(); mapIdx++)
 		{
-			string normalizedClass = m_PlayerInventoryItems.GetKey(mapIdx);
-			array<EntityAI> itemsOfClass = m_PlayerInventoryItems.GetElement(mapIdx);
+			array<EntityAI> itemsOfClass = itemsByClass.GetElement(mapIdx);
 			if (!itemsOfClass)
 				continue;
 			
@@ -2502,7 +2641,8 @@ protected string m_LastVirtualStoreConfigSignature = "";
 				// Verificar se o item existe no database (negociável)
 				if (!IsItemSellableByTrader(className))
 				{
-					Print("[AskalStore] ⚠️ Item do inventário não é negociável: " + className);
+					if (AskalLog.IsEnabled("Store", AskalLog.DEBUG))
+						AskalLog.Debug("Store", "Item do inventário não é negociável: " + className);
 					continue;
 				}
 				
@@ -2520,73 +2660,20 @@ protected string m_LastVirtualStoreConfigSignature = "";
 				
 				// FILTRO: Pesquisa
 				if (!ItemMatchesSearchFilter(info.DisplayName, className))
-				{
-					Print("[AskalStore] 🔍 Filtro de pesquisa (inventário): " + className + " não corresponde a '" + m_SearchFilterText + "', pulando...");
 					continue;
-				}
 				
-				// Obter health do servidor (via RPC) ou usar 100% como fallback
-				info.HealthPercent = GetItemHealth(className);
+				// Health por entidade (assinatura do servidor) ou 100% como fallback
+				info.HealthPercent = GetEntityHealth(invItem);
 				info.EstimatedPrice = ComputeSellEstimate(invItem);
 				
 				m_InventoryDisplayItems.Insert(info);
-				
-				Widget itemCard = GetGame().GetWorkspace().CreateWidgets("askal/market/gui/new_layouts/askal_store_item_card.layout", m_ItensCardWrap);
-				if (!itemCard)
-					continue;
-				
-				totalCards++;
-				
-				TextWidget nameWidget = MultilineTextWidget.Cast(itemCard.FindAnyWidget("item_card_name_text"));
-				if (nameWidget)
-					nameWidget.SetText(info.DisplayName);
-				
-				TextWidget priceWidget = TextWidget.Cast(itemCard.FindAnyWidget("item_card_price_text"));
-				if (priceWidget)
-				{
-					string formattedEstimate = FormatCurrencyValue(info.EstimatedPrice);
-					priceWidget.SetText(formattedEstimate);
-				}
-				
-				ItemPreviewWidget cardPreview = ItemPreviewWidget.Cast(itemCard.FindAnyWidget("item_preview_widget"));
-				if (cardPreview)
-				{
-					EntityAI previewEntity = EntityAI.Cast(SpawnTemporaryObject(className));
-					if (previewEntity)
-					{
-						CopyInventoryAttachmentsToPreview(invItem, previewEntity);
-						cardPreview.SetItem(previewEntity);
-						cardPreview.SetModelPosition(Vector(0, 0, 0.5));
-						cardPreview.SetModelOrientation(Vector(0, 0, 0));
-						cardPreview.SetView(previewEntity.GetViewIndex());
-						cardPreview.Show(true);
-						m_PreviewItems.Insert(previewEntity);
-					}
-				}
-				
-				ImageWidget inventoryIcon = ImageWidget.Cast(itemCard.FindAnyWidget("item_card_in_Inventory"));
-				if (inventoryIcon)
-				{
-					inventoryIcon.Show(true);
-					AskalColorHelper.ApplyHealthColor(inventoryIcon, info.HealthPercent);
-				}
-				
-				m_ItemCardToInventoryItem.Set(itemCard, invItem);
-				int infoIndex = m_InventoryDisplayItems.Count() - 1;
-				m_ItemCardToIndex.Set(itemCard, infoIndex);
-				m_ItemWidgets.Insert(itemCard);
-				
-				if (m_BatchSellSelectedEntities && m_BatchSellSelectedEntities.Find(invItem) != -1)
-					SetCardSelected(itemCard, true);
-				else
-					SetCardSelected(itemCard, false);
 			}
 		}
 		
-		if (m_ItensCardWrap)
-			m_ItensCardWrap.Update();
-		if (m_ItensCardScroll)
-			m_ItensCardScroll.Update();
+		// Cards são ligados sob demanda pelo grid (somente a janela visível)
+		int totalCards = m_InventoryDisplayItems.Count();
+		m_GridMode = 1;
+		m_ItemCardGrid.SetEntryCount(totalCards);
 		
 		Print("[AskalStore] ✅ Inventário renderizado para venda: " + totalCards + " cards");
 		
@@ -2599,6 +2686,46 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		}
 	}
 	
+	protected void BindInventoryCard(Widget itemCard, int infoIndex)
+	{
+		AskalInventoryDisplayInfo info = GetInventoryDisplayInfo(infoIndex);
+		if (!info || !info.Item)
+			return;
+		
+		EntityAI invItem = info.Item;
+		string className = info.ClassName;
+		
+		TextWidget nameWidget = MultilineTextWidget.Cast(itemCard.FindAnyWidget("item_card_name_text"));
+		if (nameWidget)
+			nameWidget.SetText(info.DisplayName);
+		
+		TextWidget priceWidget = TextWidget.Cast(itemCard.FindAnyWidget("item_card_price_text"));
+		if (priceWidget)
+		{
+			string formattedEstimate = FormatCurrencyValue(info.EstimatedPrice);
+			priceWidget.SetText(formattedEstimate);
+		}
+		
+		ItemPreviewWidget cardPreview = ItemPreviewWidget.Cast(itemCard.FindAnyWidget("item_preview_widget"));
+		if (cardPreview)
+			m_PreviewPool.RequestFromInventory(cardPreview, invItem, itemCard.FindAnyWidget("item_card_fallback_icon"));
+		
+		ImageWidget inventoryIcon = ImageWidget.Cast(itemCard.FindAnyWidget("item_card_in_Inventory"));
+		if (inventoryIcon)
+		{
+			inventoryIcon.Show(true);
+			AskalColorHelper.ApplyHealthColor(inventoryIcon, info.HealthPercent);
+		}
+		
+		m_ItemCardToInventoryItem.Set(itemCard, invItem);
+		m_ItemCardToIndex.Set(itemCard, infoIndex);
+		
+		if (m_BatchSellSelectedEntities && m_BatchSellSelectedEntities.Find(invItem) != -1)
+			SetCardSelected(itemCard, true);
+		else
+			SetCardSelected(itemCard, false);
+	}
+	
 	protected bool IsItemSellableByTrader(string className)
 	{
 		if (!className || className == "")
@@ -2615,6 +2742,21 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		return syncData != NULL;
 	}
 	
+	// Chamado pelo AskalPreviewPool para criar uma entidade de preview
+	EntityAI CreatePooledPreviewEntity(string className, array<string> attachments, EntityAI source)
+	{
+		EntityAI previewEntity = EntityAI.Cast(SpawnTemporaryObject(className));
+		if (!previewEntity)
+			return NULL;
+		
+		if (source)
+			CopyInventoryAttachmentsToPreview(source, previewEntity);
+		else if (attachments)
+			ApplyDefaultAttachmentsToEntity(previewEntity, attachments);
+		
+		return previewEntity;
+	}
+	
 	protected void CopyInventoryAttachmentsToPreview(EntityAI source, EntityAI preview)
 	{
 		if (!source || !preview)
@@ -2702,6 +2844,12 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		if (!item)
 			return 0;
 		
+		// Cotação do servidor (mesma fórmula da venda) tem prioridade
+		int quotedPrice;
+		if (AskalSellQuotes.Find(item, quotedPrice))
+			return quotedPrice;
+		
+		// Sem cotação ainda: estimativa local
 		AskalDatabaseClientCache cache = AskalDatabaseClientCache.GetInstance();
 		if (!cache)
 			return 0;
@@ -2719,8 +2867,8 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		itemData.SellPercent = NormalizeSellPercent(itemData.SellPercent);
 		itemData.BasePrice = NormalizeBuyPrice(itemData.BasePrice);
 		
-		// Cálculo simplificado no cliente (sem GetHealth01 que só funciona no servidor)
-		// O servidor calculará o preço real considerando health, quantidade e attachments
+		// Mesma regra do servidor com health/quantidade da própria entidade (assinatura)
+		// Munição em carregadores continua sendo calculada só no servidor
 		int basePrice = itemData.BasePrice;
 		if (basePrice <= 0)
 			basePrice = DEFAULT_HARDCODED_BUY_PRICE;
@@ -2729,12 +2877,13 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		if (sellPercent <= 0)
 			sellPercent = DEFAULT_HARDCODED_SELL_PERCENT;
 		
-		// Obter health do item (do servidor via RPC) ou usar 100% como fallback
-		float healthPercent = GetItemHealth(item.GetType());
+		float healthPercent = GetEntityHealth(item);
+		float quantityPercent = GetEntityQuantity(item);
 		
-		// Estimativa base: preço base * percentual de venda * proporção de health
-		// Preço proporcional à integridade (1% health = 1% do valor)
+		// Stackables: proporcional à quantidade; demais: proporcional à integridade
 		float estimatedPrice = basePrice * (sellPercent / 100.0) * (healthPercent / 100.0);
+		if (quantityPercent > 0)
+			estimatedPrice = basePrice * (sellPercent / 100.0) * (quantityPercent / 100.0);
 		
 		// Tenta estimar attachments de forma simplificada (sem recursão que usa GetHealth01)
 		if (item.GetInventory())
@@ -2758,7 +2907,7 @@ protected string m_LastVirtualStoreConfigSignature = "";
 						attachSellPercent = DEFAULT_HARDCODED_SELL_PERCENT;
 					
 					// Obter health do attachment também
-					float attachHealthPercent = GetItemHealth(attachment.GetType());
+					float attachHealthPercent = GetEntityHealth(attachment);
 					
 					// Preço do attachment proporcional à integridade
 					estimatedPrice += attachBasePrice * (attachSellPercent / 100.0) * (attachHealthPercent / 100.0);
@@ -2775,16 +2924,11 @@ protected string m_LastVirtualStoreConfigSignature = "";
 	
 	void ClearItems()
 	{
-		// Limpar widgets de itens
-		if (m_ItemWidgets)
-		{
-			foreach (Widget widget : m_ItemWidgets)
-			{
-				if (widget)
-					delete widget;
-			}
-			m_ItemWidgets.Clear();
-		}
+		// Esconder cards do grid (libera previews ligados; widgets ficam no pool)
+		if (m_ItemCardGrid)
+			m_ItemCardGrid.Clear();
+		if (m_GridItemIndexes)
+			m_GridItemIndexes.Clear();
 		
 		if (m_ItemCardToIndex)
 			m_ItemCardToIndex.Clear();
@@ -2904,27 +3048,17 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		ItemPreviewWidget variantPreview = ItemPreviewWidget.Cast(variantCard.FindAnyWidget("variant_preview_widget"));
 		ButtonWidget variantButton = ButtonWidget.Cast(variantCard.FindAnyWidget("variant_card_button"));
 		
-				if (variantPreview)
-				{
-			EntityAI variantItem = EntityAI.Cast(SpawnTemporaryObject(className));
-					if (variantItem)
-					{
-				array<string> resolvedAttachments = attachments;
-				if (!resolvedAttachments)
-				{
-					AskalItemSyncData syncData = NULL;
-					if (cache)
-						syncData = cache.FindItem(className);
-					resolvedAttachments = BuildAttachmentList(syncData, cache, className);
-				}
-				ApplyDefaultAttachmentsToEntity(variantItem, resolvedAttachments);
-						variantPreview.SetItem(variantItem);
-						variantPreview.SetModelPosition(Vector(0, 0, 0.5));
-						variantPreview.SetModelOrientation(Vector(0, 0, 0));
-						variantPreview.SetView(variantItem.GetViewIndex());
-						variantPreview.Show(true);
-						m_PreviewItems.Insert(variantItem);
+		if (variantPreview)
+		{
+			array<string> resolvedAttachments = attachments;
+			if (!resolvedAttachments)
+			{
+				AskalItemSyncData syncData = NULL;
+				if (cache)
+					syncData = cache.FindItem(className);
+				resolvedAttachments = BuildAttachmentList(syncData, cache, className);
 			}
+			m_PreviewPool.Request(variantPreview, className, resolvedAttachments);
 		}
 		
 				if (variantButton)
@@ -2941,8 +3075,10 @@ protected string m_LastVirtualStoreConfigSignature = "";
 		{
 			foreach (Widget variantWidget : m_VariantWidgets)
 			{
-				if (variantWidget)
-					delete variantWidget;
+				if (!variantWidget)
+					continue;
+				m_PreviewPool.Release(ItemPreviewWidget.Cast(variantWidget.FindAnyWidget("variant_preview_widget")));
+				delete variantWidget;
 			}
 			m_VariantWidgets.Clear();
 		}
@@ -3030,15 +3166,10 @@ protected string m_LastVirtualStoreConfigSignature = "";
 				continue;
 			}
 			
+			// Ícone do slot fica visível até o preview do pool ser ligado
 			ImageWidget icon = ImageWidget.Cast(attachCard.FindAnyWidget("attachment_slot_icon"));
-			if (icon)
-			{
-				icon.Show(false);
-			}
-			else
-			{
+			if (!icon)
 				Print("[AskalStore] ⚠️ attachment_slot_icon não encontrado para: " + attachmentClass);
-			}
 			
 			// O attachment_preview está dentro de attachment_card_button
 			Widget attachButton = attachCard.FindAnyWidget("attachment_card_button");
@@ -3055,24 +3186,12 @@ protected string m_LastVirtualStoreConfigSignature = "";
 			
 			if (preview)
 			{
-				EntityAI attachmentEntity = EntityAI.Cast(SpawnTemporaryObject(attachmentClass));
-				if (attachmentEntity)
-				{
-					preview.SetItem(attachmentEntity);
-						preview.SetModelPosition(Vector(0, 0, 0.5));
-					preview.SetView(attachmentEntity.GetViewIndex());
-						preview.Show(true);
-					m_PreviewItems.Insert(attachmentEntity);
-					Print("[AskalStore] ✅ Attachment preview criado: " + attachmentClass);
-				}
-				else
-				{
-					preview.Show(false);
-					Print("[AskalStore] ❌ Falha ao criar entidade para attachment: " + attachmentClass);
-					}
-				}
-				else
-				{
+				m_PreviewPool.Request(preview, attachmentClass, NULL, icon);
+			}
+			else
+			{
+				if (icon)
+					icon.Show(false);
 				Print("[AskalStore] ❌ attachment_preview não encontrado para: " + attachmentClass);
 			}
 			
@@ -3089,8 +3208,10 @@ protected string m_LastVirtualStoreConfigSignature = "";
 	{
 		foreach (Widget attachWidget : m_AttachmentWidgets)
 		{
-			if (attachWidget)
-				delete attachWidget;
+			if (!attachWidget)
+				continue;
+			m_PreviewPool.Release(ItemPreviewWidget.Cast(attachWidget.FindAnyWidget("attachment_preview")));
+			delete attachWidget;
 		}
 		m_AttachmentWidgets.Clear();
 		}
@@ -3141,18 +3262,7 @@ protected string m_LastVirtualStoreConfigSignature = "";
 			}
 			
 			if (preview)
-			{
-				EntityAI previewAttachment = EntityAI.Cast(SpawnTemporaryObject(attachmentClass));
-				if (previewAttachment)
-				{
-					CopyInventoryAttachmentsToPreview(attachment, previewAttachment);
-					preview.SetItem(previewAttachment);
-					preview.SetModelPosition(Vector(0, 0, 0.5));
-					preview.SetView(previewAttachment.GetViewIndex());
-					preview.Show(true);
-					m_PreviewItems.Insert(previewAttachment);
-				}
-			}
+				m_PreviewPool.RequestFromInventory(preview, attachment, attachCard.FindAnyWidget("attachment_slot_icon"));
 			
 			TextWidget slotLabel = TextWidget.Cast(attachCard.FindAnyWidget("attachment_slot_label"));
 			if (slotLabel)
@@ -3396,8 +3506,7 @@ protected string m_LastVirtualStoreConfigSignature = "";
 			if (!marketConfig.Currencies || marketConfig.Currencies.Count() == 0)
 			{
 				Print("[AskalStore] ⚠️ MarketConfig Currencies está vazio, tentando recarregar...");
-				// Force reload by creating new instance
-				marketConfig = new AskalMarketConfig();
+				marketConfig.Reload();
 			}
 		}
 		
@@ -3865,7 +3974,7 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 		
 		if (enabled)
 		{
-			ScanPlayerInventory();
+			SyncInventoryModel();
 			ShowPlayerInventoryCard(true);
 			m_ShowingInventoryForSale = true;
 			RenderInventoryItemsForSale();
@@ -3958,7 +4067,7 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 			return;
 		
 		m_ShowingInventoryForSale = true;
-		ScanPlayerInventory();
+		SyncInventoryModel();
 		RenderInventoryItemsForSale();
 	}
 	
@@ -4047,8 +4156,8 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 				fallbackDisplay = tempBase.GetDisplayName();
 			tempInfo.DisplayName = ResolveItemDisplayName(tempInfo.ClassName, fallbackDisplay);
 			tempInfo.EstimatedPrice = m_SelectedItemUnitPrice;
-			// Obter health do servidor (via RPC) ou usar 100% como fallback
-			tempInfo.HealthPercent = GetItemHealth(tempInfo.ClassName);
+			// Health por entidade (assinatura do servidor) ou 100% como fallback
+			tempInfo.HealthPercent = GetEntityHealth(inventoryItem);
 			UpdateRightPanelFromInventory(tempInfo);
 		}
 		
@@ -4532,24 +4641,7 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 		// Campo de pesquisa
 		if (w == m_SearchInput)
 		{
-			m_SearchFilterText = m_SearchInput.GetText();
-			m_SearchFilterText = m_SearchFilterText.Trim();
-			m_SearchFilterText.ToLower();
-			Print("[AskalStore] 🔍 Filtro de pesquisa atualizado: '" + m_SearchFilterText + "'");
-			
-			// Se há texto de pesquisa, buscar em todos os datasets
-			if (m_SearchFilterText != "")
-			{
-				SearchAllDatasets();
-			}
-			else
-			{
-				// Sem pesquisa, voltar à categoria atual
-				if (m_CurrentCategoryIndex >= 0 && m_CurrentCategoryIndex < m_Categories.Count())
-					LoadCategory(m_CurrentCategoryIndex);
-				else if (m_CurrentDatasetIndex >= 0 && m_CurrentDatasetIndex < m_Datasets.Count())
-					LoadDataset(m_CurrentDatasetIndex);
-			}
+			ScheduleSearch();
 			return true;
 		}
 		
@@ -5398,82 +5490,12 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 		if (!SendSellRequest(itemToSell))
 			return false;
 		
+		// A remoção do item chega pelo AskalInventoryModel (INVENTORY_CHANGED)
 		m_SelectedInventoryItem = null;
-		ScanPlayerInventory();
-		if (m_BatchSellEnabled || m_ShowingInventoryForSale)
-			RenderInventoryItemsForSale();
 		UpdateTransactionSummary();
 		return true;
 	}
 	
-	// Verificar se item tem cargo (itens dentro de containers) - versão cliente
-	// Versão interna com proteção contra loops infinitos
-	protected bool HasCargoItemsRecursiveInternal(EntityAI item, array<EntityAI> checkedItems)
-	{
-		if (!item || !item.GetInventory())
-			return false;
-		
-		// Proteção contra loops infinitos: verificar se já foi checado
-		if (checkedItems.Find(item) != -1)
-			return false; // Já foi verificado, evitar loop
-		
-		checkedItems.Insert(item);
-		
-		// Primeiro, verificar attachments para excluí-los
-		array<EntityAI> attachments = new array<EntityAI>();
-		int attCount = item.GetInventory().AttachmentCount();
-		for (int attIdx = 0; attIdx < attCount; attIdx++)
-		{
-			EntityAI attachment = item.GetInventory().GetAttachmentFromIndex(attIdx);
-			if (attachment)
-				attachments.Insert(attachment);
-		}
-		
-		array<EntityAI> allItems = new array<EntityAI>();
-		item.GetInventory().EnumerateInventory(InventoryTraversalType.PREORDER, allItems);
-		
-		// Filtrar apenas itens que estão no cargo (não attachments, não o próprio item)
-		foreach (EntityAI cargoItem : allItems)
-		{
-			if (!cargoItem)
-				continue;
-			
-			// Ignorar o próprio item
-			if (cargoItem == item)
-				continue;
-			
-			// Verificar se é attachment
-			if (attachments.Find(cargoItem) != -1)
-				continue; // É attachment, não conta como cargo
-			
-			// Verificar usando InventoryLocation se o item está realmente dentro deste container
-			InventoryLocation itemLoc = new InventoryLocation();
-			if (!cargoItem.GetInventory().GetCurrentInventoryLocation(itemLoc))
-				continue; // Não conseguiu obter location, pular
-			
-			// Se o parent não é o item sendo verificado, não é cargo deste item
-			EntityAI parent = itemLoc.GetParent();
-			if (parent != item)
-				continue; // Item não está dentro deste container
-			
-			// Item está no cargo - verificar recursivamente se ele também tem cargo
-			if (HasCargoItemsRecursiveInternal(cargoItem, checkedItems))
-				return true; // Container dentro de container com itens
-			
-			// Item no cargo encontrado
-			return true;
-		}
-		
-		return false; // Sem itens no cargo
-	}
-	
-	// Versão pública (wrapper)
-	protected bool HasCargoItemsRecursive(EntityAI item)
-	{
-		array<EntityAI> checkedItems = new array<EntityAI>();
-		return HasCargoItemsRecursiveInternal(item, checkedItems);
-	}
-	
 	protected bool SendSellRequest(EntityAI inventoryItem)
 	{
 		if (!inventoryItem)
@@ -5483,7 +5505,7 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 		}
 		
 		// Verificar se item tem cargo ANTES de enviar para o servidor
-		if (HasCargoItemsRecursive(inventoryItem))
+		if (AskalInventoryModel.GetInstance().HasCargo(inventoryItem))
 		{
 			Print("[AskalStore] [ERRO] Item tem cargo - venda bloqueada no cliente");
 			DisplayTransactionError("[AVISO] Item ocupado: esvazie o inventario do item antes de vende-lo");
@@ -5519,30 +5541,13 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 		if (!traderName || traderName == "")
 			traderName = "Trader_Default";
 		
-		// IMPORTANTE: Usar GetType() diretamente do item do inventário para garantir nome exato
+		// O servidor vende exatamente esta entidade (a cotada no card); a classe é só conferência
 		string itemClassName = inventoryItem.GetType();
+		int networkIdLow;
+		int networkIdHigh;
+		inventoryItem.GetNetworkID(networkIdLow, networkIdHigh);
 		
-		
-		// Verificar se o item realmente existe no inventário do player
-		if (!IsItemInInventory(itemClassName))
-		{
-			Print("[AskalStore] [AVISO] Item não encontrado no cache do inventário: " + itemClassName);
-			Print("[AskalStore] [AVISO] Tentando normalizar nome...");
-			string normalized = NormalizeClassName(itemClassName);
-			if (IsItemInInventory(normalized))
-			{
-				Print("[AskalStore] [AVISO] Item encontrado com nome normalizado: " + normalized);
-				// Tentar encontrar o item real no inventário
-				EntityAI realItem = GetFirstItemInInventory(normalized);
-				if (realItem)
-				{
-					itemClassName = realItem.GetType();
-					Print("[AskalStore] [AVISO] Usando nome do item real: " + itemClassName);
-				}
-			}
-		}
-		
-		Param5<string, string, string, int, string> sellParams = new Param5<string, string, string, int, string>(steamId, itemClassName, currencyId, transactionMode, traderName);
+		Param7<string, string, string, int, string, int, int> sellParams = new Param7<string, string, string, int, string, int, int>(steamId, itemClassName, currencyId, transactionMode, traderName, networkIdLow, networkIdHigh);
 		
 		GetRPCManager().SendRPC("AskalSellModule", "SellItemRequest", sellParams, true, identity, NULL);
 		Print("[AskalStore] [VENDA] RPC de venda enviado para: " + itemClassName);
@@ -5555,405 +5560,156 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 	// SISTEMA DE NOTIFICAÇÕES
 	// ========================================
 	
-	// Adicionar notificação com descrição detalhada
+	// Adicionar notificação com descrição detalhada (card reutilizado do anel)
 	void AddNotificationWithDescription(string actionType, string description, string itemClassName, int price, bool isPurchase = true)
 	{
-		if (!m_NotificationCardHolder)
+		if (!m_NotificationCardHolder || !m_Notifications)
 		{
 			Print("[AskalStore] ⚠️ NotificationCardHolder não disponível!");
 			return;
 		}
 		
-		// Limpar notificações antigas
+		if (!m_Notifications.Push(actionType, description, itemClassName, FormatNotificationPrice(price, isPurchase), isPurchase))
+			return;
+		
 		CleanupOldNotifications();
+		Print("[AskalStore] ✅ Notificação adicionada: " + actionType + " - " + description + " (" + price + ")");
+	}
+	
+	void AddNotification(string actionType, string itemClassName, int price, bool isPurchase = true)
+	{
+		AddNotificationWithDescription(actionType, itemClassName, itemClassName, price, isPurchase);
+	}
+	
+	protected string FormatNotificationPrice(int price, bool isPurchase)
+	{
+		string formattedPrice = FormatCurrencyValue(price);
+		string priceStr = formattedPrice;
+		if (isPurchase && price > 0)
+			priceStr = "-" + formattedPrice;
+		else if (!isPurchase && price > 0)
+			priceStr = "+" + formattedPrice;
 		
-		// Limitar número máximo de notificações
-		if (m_NotificationCards.Count() >= MAX_NOTIFICATIONS)
-		{
-			RemoveOldestNotification();
-		}
+		if (m_CurrentCurrencyShortName && m_CurrentCurrencyShortName != "")
+			priceStr = priceStr + " " + m_CurrentCurrencyShortName;
 		
-		// Criar card de notificação
-		Widget notificationCard = GetGame().GetWorkspace().CreateWidgets("askal/market/gui/new_layouts/askal_store_notification_card.layout", m_NotificationCardHolder);
-		if (!notificationCard)
-		{
-			Print("[AskalStore] ❌ Falha ao criar notification card!");
+		return priceStr;
+	}
+	
+	// Oculta notificações expiradas e agenda a próxima expiração
+	void CleanupOldNotifications()
+	{
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(CleanupOldNotifications);
+		if (!m_Notifications)
 			return;
-		}
 		
-		Widget slidePanel = notificationCard.FindAnyWidget("notification_slide_panel");
-		Widget colorTarget = slidePanel;
-		if (!colorTarget)
-			colorTarget = notificationCard;
+		int delayMs = m_Notifications.ExpireOld();
+		if (delayMs >= 0)
+			GetGame().GetCallQueue(CALL_CATEGORY_GUI).CallLater(CleanupOldNotifications, delayMs, false);
+	}
+	
+	void ClearAllNotifications()
+	{
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(CleanupOldNotifications);
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(ProcessPendingNotifications);
+		m_NotificationFlushScheduled = false;
 		
-		// Configurar cor baseada no tipo (compra = verde, venda = laranja)
-		if (isPurchase)
-			colorTarget.SetColor(ARGB(200, 9, 116, 0)); // Verde para compra
-		else
-			colorTarget.SetColor(ARGB(200, 131, 67, 0)); // Laranja para venda
+		if (m_Notifications)
+			m_Notifications.Clear();
+	}
+	
+	void ShowNotification(string message, string color = "#FFFFFF")
+	{
+		Print("[AskalStore] " + message);
+	}
+	
+	// Processar notificações pendentes do helper (3_Game)
+	// Compras e vendas que chegaram juntas (lote) viram um card de resumo cada
+	void ProcessPendingNotifications()
+	{
+		m_NotificationFlushScheduled = false;
+		if (!s_Instance)
+			return;
 		
-		float basePosX = 0;
-		float basePosY = 0;
-		float parentWidthPx = 0;
-		if (slidePanel)
-		{
-			float currentPosX;
-			slidePanel.GetPos(currentPosX, basePosY);
-			Widget slideParent = slidePanel.GetParent();
-			float parentHeightPx;
-			if (slideParent)
-				slideParent.GetScreenSize(parentWidthPx, parentHeightPx);
-			if (parentWidthPx <= 0)
-			{
-				slidePanel.GetScreenSize(parentWidthPx, parentHeightPx);
-			}
-			if (parentWidthPx <= 0)
-				parentWidthPx = 70.0;
-			float initialOffset = 70.0;
-			float initialOffsetNormalized = initialOffset / parentWidthPx;
-			slidePanel.SetPos(initialOffsetNormalized, basePosY);
-			slidePanel.Update();
-		}
-		
-		// Configurar texto de ação
-		MultilineTextWidget actionText = MultilineTextWidget.Cast(notificationCard.FindAnyWidget("action_text"));
-		if (actionText)
-		{
-			actionText.SetText(actionType);
-		}
-		
-		// Configurar nome/descrição do item (usar descrição detalhada)
-		MultilineTextWidget itemNameText = MultilineTextWidget.Cast(notificationCard.FindAnyWidget("action_item_name_text"));
-		if (!itemNameText)
-			itemNameText = MultilineTextWidget.Cast(notificationCard.FindAnyWidget("item_name_text"));
-		if (!itemNameText)
-			itemNameText = MultilineTextWidget.Cast(notificationCard.FindAnyWidget("description_text"));
-		
-		if (itemNameText)
-		{
-			itemNameText.SetText(description);
-		}
-		
-		// Configurar preview do item (usar className original)
-		ItemPreviewWidget itemPreview = ItemPreviewWidget.Cast(notificationCard.FindAnyWidget("action_item_preview"));
-		if (itemPreview && itemClassName != "")
-		{
-			EntityAI previewEntity = EntityAI.Cast(SpawnTemporaryObject(itemClassName));
-			if (previewEntity)
-			{
-				itemPreview.SetItem(previewEntity);
-				itemPreview.SetModelPosition(Vector(0, 0, 0.5));
-				itemPreview.SetView(previewEntity.GetViewIndex());
-				itemPreview.Show(true);
-				m_PreviewItems.Insert(previewEntity);
-			}
-		}
+		array<ref AskalNotificationData> pending = AskalNotificationHelper.GetPendingNotifications();
+		if (!pending || pending.Count() == 0)
+			return;
 		
-		// Configurar preço
-		MultilineTextWidget priceText = MultilineTextWidget.Cast(notificationCard.FindAnyWidget("action_price"));
-		if (priceText)
+		array<AskalNotificationData> purchases = new array<AskalNotificationData>();
+		array<AskalNotificationData> sales = new array<AskalNotificationData>();
+		foreach (AskalNotificationData notifData : pending)
 		{
-			string formattedPrice = FormatCurrencyValue(price);
-			string priceStr = formattedPrice;
-			if (isPurchase && price > 0)
-				priceStr = "-" + formattedPrice;
-			else if (!isPurchase && price > 0)
-				priceStr = "+" + formattedPrice;
-			
-			if (m_CurrentCurrencyShortName && m_CurrentCurrencyShortName != "")
-				priceStr = priceStr + " " + m_CurrentCurrencyShortName;
+			if (!notifData)
+				continue;
 			
-			priceText.SetText(priceStr);
+			if (notifData.IsPurchase)
+				purchases.Insert(notifData);
+			else
+				sales.Insert(notifData);
 		}
 		
-		// Adicionar à lista
-		m_NotificationCards.Insert(notificationCard);
-		float animationStartTime = GetGame().GetTickTime();
-		m_NotificationTimestamps.Insert(animationStartTime);
-		if (slidePanel)
-		{
-			m_NotificationSlidePanels.Insert(slidePanel);
-			m_NotificationAnimationStartTimes.Insert(animationStartTime);
-			m_NotificationBasePosY.Insert(basePosY);
-			m_NotificationSlideParentWidths.Insert(parentWidthPx);
-		}
+		AddNotificationGroup(purchases);
+		AddNotificationGroup(sales);
+		AskalNotificationHelper.ClearPendingNotifications();
+		
+		// Itens vendidos saem da listagem via INVENTORY_CHANGED; aqui só o resumo
+		if (sales.Count() > 0)
+			UpdateTransactionSummary();
 	}
 	
-	void AddNotification(string actionType, string itemClassName, int price, bool isPurchase = true)
+	protected void AddNotificationGroup(array<AskalNotificationData> group)
 	{
-		if (!m_NotificationCardHolder)
-		{
-			Print("[AskalStore] ⚠️ NotificationCardHolder não disponível!");
+		if (group.Count() == 0)
 			return;
-		}
-		
-		// Limpar notificações antigas
-		CleanupOldNotifications();
-		
-		// Limitar número máximo de notificações
-		if (m_NotificationCards.Count() >= MAX_NOTIFICATIONS)
-		{
-			RemoveOldestNotification();
-		}
 		
-		// Criar card de notificação
-		Widget notificationCard = GetGame().GetWorkspace().CreateWidgets("askal/market/gui/new_layouts/askal_store_notification_card.layout", m_NotificationCardHolder);
-		if (!notificationCard)
+		AskalNotificationData first = group[0];
+		if (group.Count() == 1)
 		{
-			Print("[AskalStore] ❌ Falha ao criar notification card!");
+			// Usar descrição detalhada se disponível, senão usar className
+			AddNotificationWithDescription(first.ActionType, GetNotificationText(first), first.ItemClassName, first.Price, first.IsPurchase);
 			return;
 		}
 		
-		Widget slidePanel = notificationCard.FindAnyWidget("notification_slide_panel");
-		Widget colorTarget = slidePanel;
-		if (!colorTarget)
-			colorTarget = notificationCard;
-		
-		// Configurar cor baseada no tipo (compra = verde, venda = laranja)
-		if (isPurchase)
-			colorTarget.SetColor(ARGB(200, 9, 116, 0)); // Verde para compra
-		else
-			colorTarget.SetColor(ARGB(200, 131, 67, 0)); // Laranja para venda
-		
-		float basePosX = 0;
-		float basePosY = 0;
-		float parentWidthPx = 0;
-		if (slidePanel)
-		{
-			float currentPosX;
-			slidePanel.GetPos(currentPosX, basePosY);
-			Widget slideParent = slidePanel.GetParent();
-			float parentHeightPx;
-			if (slideParent)
-				slideParent.GetScreenSize(parentWidthPx, parentHeightPx);
-			if (parentWidthPx <= 0)
-			{
-				slidePanel.GetScreenSize(parentWidthPx, parentHeightPx);
-			}
-			if (parentWidthPx <= 0)
-				parentWidthPx = 70.0;
-			float initialOffset = 70.0;
-			float initialOffsetNormalized = initialOffset / parentWidthPx;
-			slidePanel.SetPos(initialOffsetNormalized, basePosY);
-			slidePanel.Update();
-		}
-		
-		// Configurar texto de ação
-		MultilineTextWidget actionText = MultilineTextWidget.Cast(notificationCard.FindAnyWidget("action_text"));
-		if (actionText)
-		{
-			actionText.SetText(actionType);
-		}
-		
-		// Configurar nome/descrição do item (se o widget existir)
-		// itemClassName agora pode conter descrição detalhada (com attachments)
-		MultilineTextWidget itemNameText = MultilineTextWidget.Cast(notificationCard.FindAnyWidget("action_item_name_text"));
-		if (!itemNameText)
-			itemNameText = MultilineTextWidget.Cast(notificationCard.FindAnyWidget("item_name_text"));
-		if (!itemNameText)
-			itemNameText = MultilineTextWidget.Cast(notificationCard.FindAnyWidget("description_text"));
-		
-		if (itemNameText)
-		{
-			itemNameText.SetText(itemClassName);
-		}
-		
-		// Configurar preview do item
-		// Para preview, precisamos do className original (não a descrição)
-		// Se itemClassName for uma descrição, vamos tentar usar o className do notifData
-		string previewClassName = itemClassName;
-		
-		ItemPreviewWidget itemPreview = ItemPreviewWidget.Cast(notificationCard.FindAnyWidget("action_item_preview"));
-		if (itemPreview && previewClassName != "")
+		// Resumo: "3x AKM, 2x Mag_AKM_30Rnd, +4" com o total do lote
+		map<string, int> countsByText = new map<string, int>();
+		array<string> textOrder = new array<string>();
+		int totalPrice = 0;
+		foreach (AskalNotificationData entry : group)
 		{
-			// Tentar criar preview com o className (se for className válido)
-			// Se não funcionar, a descrição será exibida no texto mas sem preview
-			EntityAI previewEntity = EntityAI.Cast(SpawnTemporaryObject(previewClassName));
-			if (previewEntity)
-			{
-				itemPreview.SetItem(previewEntity);
-				itemPreview.SetModelPosition(Vector(0, 0, 0.5));
-				itemPreview.SetView(previewEntity.GetViewIndex());
-				itemPreview.Show(true);
-				m_PreviewItems.Insert(previewEntity);
-			}
-		}
-		
-		// Configurar preço
-		MultilineTextWidget priceText = MultilineTextWidget.Cast(notificationCard.FindAnyWidget("action_price"));
-		if (priceText)
-		{
-			string formattedPrice = FormatCurrencyValue(price);
-			string priceStr = formattedPrice;
-			if (isPurchase && price > 0)
-				priceStr = "-" + formattedPrice;
-			else if (!isPurchase && price > 0)
-				priceStr = "+" + formattedPrice;
-			
-			if (m_CurrentCurrencyShortName && m_CurrentCurrencyShortName != "")
-				priceStr = priceStr + " " + m_CurrentCurrencyShortName;
+			totalPrice += entry.Price;
 			
-			priceText.SetText(priceStr);
-		}
-		
-		// Adicionar à lista
-		m_NotificationCards.Insert(notificationCard);
-		float animationStartTime = GetGame().GetTickTime();
-		m_NotificationTimestamps.Insert(animationStartTime);
-		if (slidePanel)
-		{
-			m_NotificationSlidePanels.Insert(slidePanel);
-			m_NotificationAnimationStartTimes.Insert(animationStartTime);
-			m_NotificationBasePosY.Insert(basePosY);
-			m_NotificationSlideParentWidths.Insert(parentWidthPx);
-		}
-		else
-		{
-			m_NotificationSlidePanels.Insert(NULL);
-			m_NotificationAnimationStartTimes.Insert(-1);
-			m_NotificationBasePosY.Insert(0);
-			m_NotificationSlideParentWidths.Insert(0);
-		}
-		
-		// Atualizar holder
-		if (m_NotificationCardHolder)
-			m_NotificationCardHolder.Update();
-		
-		Print("[AskalStore] ✅ Notificação adicionada: " + actionType + " - " + itemClassName + " (" + price + ")");
-	}
-	
-	void CleanupOldNotifications()
-	{
-		if (!m_NotificationCards || !m_NotificationTimestamps)
-			return;
-		
-		float currentTime = GetGame().GetTickTime();
-		array<int> indicesToRemove = new array<int>();
-		
-		for (int i = m_NotificationTimestamps.Count() - 1; i >= 0; i--)
-		{
-			float age = currentTime - m_NotificationTimestamps.Get(i);
-			if (age > NOTIFICATION_LIFETIME)
+			string entryText = GetNotificationText(entry);
+			int entryCount;
+			if (countsByText.Find(entryText, entryCount))
 			{
-				indicesToRemove.Insert(i);
+				countsByText.Set(entryText, entryCount + 1);
+				continue;
 			}
+			countsByText.Insert(entryText, 1);
+			textOrder.Insert(entryText);
 		}
 		
-		foreach (int idx : indicesToRemove)
+		string summary = "";
+		int listed = Math.Min(textOrder.Count(), NOTIFICATION_SUMMARY_MAX_NAMES);
+		for (int nameIdx = 0; nameIdx < listed; nameIdx++)
 		{
-			RemoveNotificationByIndex(idx);
+			if (summary != "")
+				summary += ", ";
+			summary += countsByText.Get(textOrder[nameIdx]).ToString() + "x " + textOrder[nameIdx];
 		}
-	}
-	
-	void RemoveOldestNotification()
-	{
-		if (m_NotificationCards && m_NotificationCards.Count() > 0)
-		{
-			RemoveNotificationByIndex(0);
-		}
-	}
-	
-	void RemoveNotificationByIndex(int index)
-	{
-		if (!m_NotificationCards || !m_NotificationTimestamps)
-			return;
+		int unlisted = textOrder.Count() - listed;
+		if (unlisted > 0)
+			summary += ", +" + unlisted.ToString();
 		
-		if (index < 0 || index >= m_NotificationCards.Count())
-			return;
-		
-		Widget card = m_NotificationCards.Get(index);
-		if (card)
-		{
-			delete card;
-		}
-		
-		m_NotificationCards.Remove(index);
-		m_NotificationTimestamps.Remove(index);
-		
-		if (m_NotificationSlidePanels && index < m_NotificationSlidePanels.Count())
-			m_NotificationSlidePanels.Remove(index);
-		if (m_NotificationAnimationStartTimes && index < m_NotificationAnimationStartTimes.Count())
-			m_NotificationAnimationStartTimes.Remove(index);
-		if (m_NotificationBasePosY && index < m_NotificationBasePosY.Count())
-			m_NotificationBasePosY.Remove(index);
-		if (m_NotificationSlideParentWidths && index < m_NotificationSlideParentWidths.Count())
-			m_NotificationSlideParentWidths.Remove(index);
+		string actionType = first.ActionType + " (" + group.Count() + ")";
+		AddNotificationWithDescription(actionType, summary, first.ItemClassName, totalPrice, first.IsPurchase);
 	}
 	
-	void ClearAllNotifications()
+	protected string GetNotificationText(AskalNotificationData notifData)
 	{
-		if (!m_NotificationCards)
-			return;
-		
-		foreach (Widget card : m_NotificationCards)
-		{
-			if (card)
-				delete card;
-		}
-		
-		m_NotificationCards.Clear();
-		if (m_NotificationTimestamps)
-			m_NotificationTimestamps.Clear();
-		if (m_NotificationSlidePanels)
-			m_NotificationSlidePanels.Clear();
-		if (m_NotificationAnimationStartTimes)
-			m_NotificationAnimationStartTimes.Clear();
-		if (m_NotificationBasePosY)
-			m_NotificationBasePosY.Clear();
-		if (m_NotificationSlideParentWidths)
-			m_NotificationSlideParentWidths.Clear();
-
-		if (m_NotificationCardHolder)
-			m_NotificationCardHolder.Update();
-	}
-	
-	void ShowNotification(string message, string color = "#FFFFFF")
-	{
-		Print("[AskalStore] " + message);
-	}
-	
-	// Processar notificações pendentes do helper (3_Game)
-	void ProcessPendingNotifications()
-	{
-		if (!s_Instance)
-			return;
-		
-		array<ref AskalNotificationData> pending = AskalNotificationHelper.GetPendingNotifications();
-		if (!pending || pending.Count() == 0)
-			return;
-		
-		bool inventoryNeedsUpdate = false;
-		
-		// Processar todas as notificações pendentes
-		for (int i = pending.Count() - 1; i >= 0; i--)
-		{
-			AskalNotificationData notifData = pending.Get(i);
-			if (notifData)
-			{
-				// Usar descrição detalhada se disponível, senão usar className
-				string displayText = notifData.Description;
-				if (!displayText || displayText == "")
-					displayText = notifData.ItemClassName;
-				
-				// Passar descrição para exibição e className original para preview
-				AddNotificationWithDescription(notifData.ActionType, displayText, notifData.ItemClassName, notifData.Price, notifData.IsPurchase);
-				
-				// Se for uma venda, marcar para atualizar inventário
-				if (!notifData.IsPurchase)
-					inventoryNeedsUpdate = true;
-				
-				AskalNotificationHelper.RemoveNotification(i);
-			}
-		}
-		
-		// Atualizar inventário após vendas processadas
-		if (inventoryNeedsUpdate)
-		{
-			ScanPlayerInventory();
-			if (m_BatchSellEnabled || m_ShowingInventoryForSale)
-				RenderInventoryItemsForSale();
-			UpdateTransactionSummary();
-		}
+		if (notifData.Description && notifData.Description != "")
+			return notifData.Description;
+		return notifData.ItemClassName;
 	}
 	
 	
@@ -6003,6 +5759,7 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 			{
 				Print("[AskalStore] ⚠️ SetupItems é NULL do helper!");
 			}
+			InvalidateModeTables();
 			
 			// Resolve currency for trader
 			AskalCurrencyConfig resolvedCurrencyCfg = NULL;
@@ -6030,6 +5787,8 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 			}
 			
 			// Limpar filtro de pesquisa
+			CancelScheduledSearch();
+			ResetSearchResults();
 			m_SearchFilterText = "";
 			if (m_SearchInput)
 				m_SearchInput.SetText("");
@@ -6068,6 +5827,15 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 	{
 		super.OnShow();
 		
+		SubscribeClientEvents();
+		
+		// Eventos publicados antes da assinatura ficaram no helper
+		ProcessPendingNotifications();
+		SubscribeInventoryHealth(true);
+		ScheduleInventoryRefresh(true); // Cotações saem depois do trader pendente ser aplicado
+		if (GetGame().IsMultiplayer() && GetGame().IsClient() && !AskalDatabaseSync.IsClientSynced())
+			GetGame().GetCallQueue(CALL_CATEGORY_GUI).CallLater(RequestDatasetsIfNotSynced, SYNC_CHECK_DELAY_MS, false);
+		
 		// Verificar se há solicitação de abertura de menu do trader pendente
 		string pendingTraderMenu = AskalNotificationHelper.GetPendingTraderMenu();
 		if (pendingTraderMenu && pendingTraderMenu != "")
@@ -6096,6 +5864,7 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 				}
 				Print("[AskalStore] 📦 SetupItems copiado do helper (OnShow): " + m_TraderSetupItems.Count() + " entradas");
 			}
+			InvalidateModeTables();
 			
 			// Atualizar título do menu
 			if (m_HeaderTitleText)
@@ -6165,10 +5934,24 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 	{
 		super.OnHide();
 		
+		UnsubscribeClientEvents();
+		SubscribeInventoryHealth(false);
+		AskalSellQuotes.Clear();
+		
+		CancelCategoryLoad();
 		ClearItems();
 		ClearAllNotifications();
 		
+		// Entidades ociosas do pool de previews não sobrevivem ao menu fechado
+		if (m_PreviewPool)
+		{
+			Print("[AskalStore] Preview pool: " + m_PreviewPool.GetStatsSummary());
+			m_PreviewPool.Clear();
+		}
+		
 		// Limpar filtro de pesquisa
+		CancelScheduledSearch();
+		ResetSearchResults();
 		m_SearchFilterText = "";
 		if (m_SearchInput)
 			m_SearchInput.SetText("");
@@ -6177,6 +5960,7 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 		m_CurrentTraderName = "";
 		if (m_TraderSetupItems)
 			m_TraderSetupItems.Clear();
+		InvalidateModeTables();
 		
 		// Limpar instância estática
 		if (s_Instance == this)
@@ -6190,6 +5974,13 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 			m_HoverText = NULL;
 		}
 		
+		if (m_PerfPanel)
+		{
+			delete m_PerfPanel;
+			m_PerfPanel = NULL;
+			m_PerfText = NULL;
+		}
+		
 		// Restaurar HUD primeiro
 		Mission mis = GetGame().GetMission();
 		if (mis && mis.GetHud())
@@ -6224,12 +6015,201 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 	}
 	
 	// ========================================
-	// UPDATE (ROTAÇÃO DO PREVIEW + VERIFICAÇÃO DE SINCRONIZAÇÃO)
+	// EVENTOS DO CLIENTE (AskalEventBus)
 	// ========================================
 	
 	protected bool m_HasRequestedDatasets = false;
-	protected float m_LastSyncCheck = 0.0;
-	protected const float SYNC_CHECK_INTERVAL = 1.0; // Verificar a cada 1 segundo
+	protected const int SYNC_CHECK_DELAY_MS = 1000; // Backup: pedir datasets se nada chegou após 1 segundo
+	protected const int COOLDOWN_TICK_MS = 50;      // Atualização das barras de cooldown
+	protected bool m_CooldownTicking = false;
+	
+	protected void SubscribeClientEvents()
+	{
+		AskalEventBus.Get(AskalEventBus.CATALOG_SYNCED).Insert(OnCatalogSyncedEvent);
+		AskalEventBus.Get(AskalEventBus.VIRTUAL_STORE_CONFIG).Insert(OnVirtualStoreConfigEvent);
+		AskalEventBus.Get(AskalEventBus.INVENTORY_HEALTH).Insert(OnInventoryHealthEvent);
+		AskalEventBus.Get(AskalEventBus.NOTIFICATION_QUEUED).Insert(OnNotificationQueuedEvent);
+		AskalEventBus.Get(AskalEventBus.TRADE_RESPONSE).Insert(OnTradeResponseEvent);
+		AskalEventBus.Get(AskalEventBus.INVENTORY_CHANGED).Insert(OnInventoryChangedEvent);
+		AskalEventBus.Get(AskalEventBus.SELL_QUOTES).Insert(OnSellQuotesEvent);
+		AskalEventBus.Get(AskalEventBus.PERF_STATS).Insert(OnPerfStatsEvent);
+	}
+	
+	protected void UnsubscribeClientEvents()
+	{
+		AskalEventBus.Get(AskalEventBus.CATALOG_SYNCED).Remove(OnCatalogSyncedEvent);
+		AskalEventBus.Get(AskalEventBus.VIRTUAL_STORE_CONFIG).Remove(OnVirtualStoreConfigEvent);
+		AskalEventBus.Get(AskalEventBus.INVENTORY_HEALTH).Remove(OnInventoryHealthEvent);
+		AskalEventBus.Get(AskalEventBus.NOTIFICATION_QUEUED).Remove(OnNotificationQueuedEvent);
+		AskalEventBus.Get(AskalEventBus.TRADE_RESPONSE).Remove(OnTradeResponseEvent);
+		AskalEventBus.Get(AskalEventBus.INVENTORY_CHANGED).Remove(OnInventoryChangedEvent);
+		AskalEventBus.Get(AskalEventBus.SELL_QUOTES).Remove(OnSellQuotesEvent);
+		AskalEventBus.Get(AskalEventBus.PERF_STATS).Remove(OnPerfStatsEvent);
+		
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(RequestDatasetsIfNotSynced);
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(UpdateCooldownProgress);
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(CleanupOldNotifications);
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(RefreshInventoryView);
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(AskalPerfStats.Request);
+		m_CooldownTicking = false;
+	}
+	
+	// Dados do catálogo chegaram: carregar se o menu abriu antes da sincronização
+	protected void OnCatalogSyncedEvent(Param payload)
+	{
+		if (m_Datasets.Count() > 0)
+			return;
+		
+		Print("[AskalStore] ✅ Dados sincronizados! Recarregando datasets...");
+		InvalidateModeTables();
+		LoadDatasetsFromCore();
+		if (m_Datasets.Count() > 0)
+			LoadDataset(0);
+	}
+	
+	// VirtualStoreConfig chegou (ou mudou): aplicar e, se o menu estava esperando, carregar datasets
+	protected void OnVirtualStoreConfigEvent(Param payload)
+	{
+		bool wasWaiting = m_WaitingVirtualStoreConfig && (!m_CurrentTraderName || m_CurrentTraderName == "");
+		
+		EnsureVirtualStoreConfigApplied();
+		ScheduleInventoryRefresh(true);
+		
+		if (!wasWaiting)
+			return;
+		
+		Print("[AskalStore] ✅ Virtual Store Config recebido! Recarregando datasets com filtros do Virtual Store...");
+		LoadDatasetsFromCore();
+		if (m_Datasets.Count() > 0)
+		{
+			LoadDataset(0);
+			if (m_Categories.Count() > 0)
+				LoadCategory(0);
+		}
+	}
+	
+	// Deltas de health/quantidade chegam em rajadas pequenas: mesmo re-render agrupado
+	protected void OnInventoryHealthEvent(Param payload)
+	{
+		ScheduleInventoryRefresh(true);
+	}
+	
+	// Inventário mudou (item entrou/saiu/quantidade): re-render agrupado
+	protected void OnInventoryChangedEvent(Param payload)
+	{
+		ScheduleInventoryRefresh(true);
+	}
+	
+	// Cotações chegaram: só re-render (não pede de novo)
+	protected void OnSellQuotesEvent(Param payload)
+	{
+		ScheduleInventoryRefresh(false);
+	}
+	
+	// Estatísticas do console de performance chegaram
+	protected void OnPerfStatsEvent(Param payload)
+	{
+		if (!m_PerfPanel || !m_PerfPanel.IsVisible() || !m_PerfText)
+			return;
+		
+		// Sem permissão: para o polling e fecha o painel
+		if (AskalPerfStats.IsDenied())
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(AskalPerfStats.Request);
+			m_PerfPanel.Show(false);
+			array<string> deniedLines = AskalPerfStats.GetLines();
+			if (deniedLines.Count() > 0)
+				DisplayTransactionError(deniedLines.Get(0));
+			return;
+		}
+		
+		array<string> perfLines = AskalPerfStats.GetLines();
+		string perfText = "";
+		foreach (string perfLine : perfLines)
+		{
+			if (perfText != "")
+				perfText += "\n";
+			perfText += perfLine;
+		}
+		m_PerfText.SetText(perfText);
+	}
+	
+	// F8: mostra/oculta o painel; enquanto visível, pede estatísticas a cada PERF_REFRESH_MS
+	// (fecha e para de pedir quando o servidor nega o acesso)
+	protected void TogglePerfPanel()
+	{
+		if (!m_PerfPanel)
+			return;
+		
+		bool show = !m_PerfPanel.IsVisible();
+		if (show && AskalPerfStats.IsDenied() && GetGame().GetTime() - AskalPerfStats.GetDeniedAt() < PERF_DENIED_RETRY_MS)
+			return;
+		
+		m_PerfPanel.Show(show);
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(AskalPerfStats.Request);
+		if (!show)
+			return;
+		
+		if (m_PerfText)
+			m_PerfText.SetText("Aguardando servidor...");
+		AskalPerfStats.Request();
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).CallLater(AskalPerfStats.Request, PERF_REFRESH_MS, true);
+	}
+	
+	protected void ScheduleInventoryRefresh(bool requote)
+	{
+		if (requote)
+			m_QuotesDirty = true;
+		
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(RefreshInventoryView);
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).CallLater(RefreshInventoryView, INVENTORY_REFRESH_DEBOUNCE_MS, false);
+	}
+	
+	protected void RefreshInventoryView()
+	{
+		if (m_QuotesDirty)
+		{
+			m_QuotesDirty = false;
+			RequestSellQuotes();
+		}
+		
+		if (m_ShowingInventoryForSale || m_BatchSellEnabled)
+			RenderInventoryItemsForSale();
+		else if (m_ItemCardGrid)
+			m_ItemCardGrid.RebindVisible();
+		
+		UpdateTransactionSummary();
+	}
+	
+	// Espera a janela do lote: respostas de uma compra/venda em lote chegam em rajada
+	protected void OnNotificationQueuedEvent(Param payload)
+	{
+		if (m_NotificationFlushScheduled)
+			return;
+		
+		m_NotificationFlushScheduled = true;
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).CallLater(ProcessPendingNotifications, NOTIFICATION_BATCH_WINDOW_MS, false);
+	}
+	
+	protected void OnTradeResponseEvent(Param payload)
+	{
+		Param3<bool, string, bool> response = Param3<bool, string, bool>.Cast(payload);
+		if (!response || response.param1)
+			return;
+		
+		ShowNotification("❌ " + response.param2, "#FF4444");
+	}
+	
+	// Backup (padrão TraderX): se o cliente ainda não tem dados, pedir novamente uma vez
+	protected void RequestDatasetsIfNotSynced()
+	{
+		if (m_HasRequestedDatasets || AskalDatabaseSync.IsClientSynced())
+			return;
+		
+		Print("[AskalStore] 📤 Solicitando datasets ao servidor via RPC (backup)...");
+		GetRPCManager().SendRPC("AskalCoreModule", "RequestDatasets", NULL, true, NULL, NULL);
+		m_HasRequestedDatasets = true;
+	}
 	
 	// ========================================
 	// SISTEMA DE COOLDOWN E BOTÕES DE AÇÃO
@@ -6475,25 +6455,44 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 		}
 	}
 	
+	// Modo da classe para botões de compra/venda (tabela por abertura; calcula e memoriza se faltar)
+	// Com itemIndex, dataset/categoria do item entram na chave: a mesma classe pode estar
+	// em categorias com modos diferentes
 	protected int ResolveItemModeForClass(string className, int itemIndex = -1)
 	{
 		if (!className || className == "")
 			return 3;
 		
+		EnsureModeTables();
+		
+		string modeKey = NormalizeClassName(className);
+		if (itemIndex >= 0)
+		{
+			string indexDatasetId = "";
+			string indexCategoryId = "";
+			if (m_ItemDatasetIds && itemIndex < m_ItemDatasetIds.Count())
+				indexDatasetId = m_ItemDatasetIds.Get(itemIndex);
+			if (m_ItemCategoryIds && itemIndex < m_ItemCategoryIds.Count())
+				indexCategoryId = m_ItemCategoryIds.Get(itemIndex);
+			modeKey = modeKey + "|" + indexDatasetId + "|" + indexCategoryId;
+		}
+		
+		int mode;
+		if (m_ClassModes.Find(modeKey, mode))
+			return mode;
+		
+		mode = ComputeClassMode(className, itemIndex);
+		m_ClassModes.Set(modeKey, mode);
+		return mode;
+	}
+	
+	protected int ComputeClassMode(string className, int itemIndex)
+	{
 		// Declarar variáveis uma única vez no início da função
 		string datasetId = "";
 		string categoryId = "";
 		
 		// PRIORIDADE 1: Usar SetupItems do trader atual (se houver)
-		string setupItemsStatus = "NULL";
-		int setupItemsCount = 0;
-		if (m_TraderSetupItems != NULL)
-		{
-			setupItemsStatus = "NOT NULL";
-			setupItemsCount = m_TraderSetupItems.Count();
-		}
-		Print("[AskalStore] 🔍 ResolveItemModeForClass: className=" + className + " | itemIndex=" + itemIndex + " | m_TraderSetupItems=" + setupItemsStatus + " | Count=" + setupItemsCount);
-		
 		if (m_TraderSetupItems && m_TraderSetupItems.Count() > 0)
 		{
 			// Tentar obter dataset e categoria do item
@@ -6509,41 +6508,32 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 			if (datasetId == "" || categoryId == "")
 				ResolveDatasetAndCategoryForClass(className, datasetId, categoryId);
 			
-			Print("[AskalStore] 🔍 ResolveItemModeForClass: className=" + className + " | datasetId=" + datasetId + " | categoryId=" + categoryId);
-			
 			// Usar GetItemMode() que respeita a hierarquia correta
 			int traderMode = GetItemMode(datasetId, categoryId, className);
-			Print("[AskalStore] 🔍 ResolveItemModeForClass: GetItemMode retornou " + traderMode + " para " + className);
 			
 			// IMPORTANTE: traderMode pode ser 0 (Disabled), que também é >= 0
 			// Se encontrou configuração (incluindo modo 0), retornar
 			if (traderMode >= 0)
 			{
-				Print("[AskalStore] 🔍 ResolveItemModeForClass: Retornando modo " + traderMode + " para " + className);
 				return traderMode;
 			}
 			
 			// Se não encontrou no trader, retornar -1 (disabled) para itens não configurados
 			// Mas se "ALL" está definido, já foi considerado em GetItemMode()
-			Print("[AskalStore] 🔍 ResolveItemModeForClass: GetItemMode retornou -1, retornando -1 para " + className);
 			return -1;
 		}
-		else
-		{
-			Print("[AskalStore] 🔍 ResolveItemModeForClass: m_TraderSetupItems está vazio ou NULL, usando fallback para " + className);
-		}
 		
 		// FALLBACK: Sistema antigo de VirtualStore (se não há trader configurado)
 		if (!m_VirtualStoreSetupModes || m_VirtualStoreSetupModes.Count() == 0)
 			return 3;
 		
-		int mode;
-		if (TryGetModeFromKey(className, mode))
-			return mode;
+		int setupMode;
+		if (TryGetModeFromKey(className, setupMode))
+			return setupMode;
 		
 		string normalized = NormalizeClassName(className);
-		if (normalized != className && TryGetModeFromKey(normalized, mode))
-			return mode;
+		if (normalized != className && TryGetModeFromKey(normalized, setupMode))
+			return setupMode;
 		if (itemIndex >= 0)
 		{
 			if (m_ItemDatasetIds && itemIndex < m_ItemDatasetIds.Count())
@@ -6555,11 +6545,11 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 		if (datasetId == "" || categoryId == "")
 			ResolveDatasetAndCategoryForClass(className, datasetId, categoryId);
 		
-		if (TryGetModeFromKey(categoryId, mode))
-			return mode;
+		if (TryGetModeFromKey(categoryId, setupMode))
+			return setupMode;
 		
-		if (TryGetModeFromKey(datasetId, mode))
-			return mode;
+		if (TryGetModeFromKey(datasetId, setupMode))
+			return setupMode;
 		
 		return 3;
 	}
@@ -6567,138 +6557,19 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 	override void Update(float timeslice)
 	{
 		super.Update(timeslice);
-
-
-		// Fazer isso ANTES de qualquer outra coisa para garantir resposta imediata
-		if (!m_CurrentTraderName || m_CurrentTraderName == "")
-		{
-			// Se estamos esperando o config e ele chegou, aplicar imediatamente
-			if (m_WaitingVirtualStoreConfig && AskalVirtualStoreSettings.IsConfigSynced())
-			{
-				AskalVirtualStoreConfig virtualStoreConfig = AskalVirtualStoreSettings.GetConfig();
-				if (virtualStoreConfig)
-				{
-					Print("[AskalStore] ✅ Virtual Store Config recebido! Aplicando imediatamente...");
-					
-					// Preparar arrays para ApplyVirtualStoreConfig
-					ref array<string> setupKeys = new array<string>();
-					ref array<int> setupValues = new array<int>();
-					
-					if (virtualStoreConfig.SetupItems)
-					{
-						for (int i = 0; i < virtualStoreConfig.SetupItems.Count(); i++)
-						{
-							string key = virtualStoreConfig.SetupItems.GetKey(i);
-							int mode = virtualStoreConfig.SetupItems.GetElement(i);
-							setupKeys.Insert(key);
-							setupValues.Insert(mode);
-						}
-					}
-					
-					ApplyVirtualStoreConfig(virtualStoreConfig.GetPrimaryCurrency(), virtualStoreConfig.BuyCoefficient, virtualStoreConfig.SellCoefficient, setupKeys, setupValues);
-					
-					// Se ainda não temos datasets carregados, carregar agora
-					if (m_Datasets.Count() == 0)
-					{
-						Print("[AskalStore] 🔄 Carregando datasets pela primeira vez com filtros do Virtual Store...");
-						LoadDatasetsFromCore();
-						
-						// Se temos datasets agora, carregar o primeiro
-						if (m_Datasets.Count() > 0)
-						{
-							LoadDataset(0);
-							if (m_Categories.Count() > 0)
-								LoadCategory(0);
-						}
-					}
-					else
-					{
-						// Já temos datasets, apenas recarregar com os novos filtros
-						Print("[AskalStore] 🔄 Recarregando datasets com filtros do Virtual Store...");
-						LoadDatasetsFromCore();
-						
-						// Se temos datasets agora, carregar o primeiro
-						if (m_Datasets.Count() > 0)
-						{
-							LoadDataset(0);
-							if (m_Categories.Count() > 0)
-								LoadCategory(0);
-						}
-					}
-				}
-			}
-		}
-		
-		EnsureVirtualStoreConfigApplied();
-		UpdateCooldownProgress();
 		
-		// Limpar notificações antigas automaticamente
-		CleanupOldNotifications();
-		
-		// Verificar notificações pendentes do helper (3_Game)
-		ProcessPendingNotifications();
-		
-		// Verificar health pendente do helper (3_Game)
-		ProcessPendingHealth();
+		// Config, sincronização, health e notificações chegam pelo AskalEventBus;
+		// cooldowns e expiração de notificações usam timers. Aqui ficam só animações e o grid
+		if (m_Notifications && m_Notifications.IsAnimating())
+			m_Notifications.Animate();
 		
-		// Verificar se há solicitação de abertura de menu do trader
-		string pendingTraderMenu = AskalNotificationHelper.GetPendingTraderMenu();
-		if (pendingTraderMenu && pendingTraderMenu != "")
-		{
-			// Se o menu já está aberto (esta instância), apenas log
-			if (s_Instance && s_Instance == this)
-			{
-				Print("[AskalStore] ✅ Menu já está aberto para trader: " + pendingTraderMenu);
-			}
-			else
-			{
-				// Criar nova instância e mostrar via UIManager
-				AskalStoreMenu newMenu = new AskalStoreMenu();
-				if (newMenu)
-				{
-					GetGame().GetUIManager().ShowScriptedMenu(newMenu, NULL);
-					Print("[AskalStore] ✅ Menu do trader aberto: " + pendingTraderMenu);
-				}
-			}
-			AskalNotificationHelper.ClearPendingTraderMenu();
-		}
+		// Grid virtualizado: religa cards quando o scroll muda a janela visível
+		if (m_ItemCardGrid)
+			m_ItemCardGrid.Refresh();
 		
-		AnimateNotificationSlides();
-		
-		// Verificar sincronização de dados (padrão TraderX)
-		// Se é cliente multiplayer e ainda não tem dados, verificar periodicamente
-		if (GetGame().IsMultiplayer() && GetGame().IsClient())
-		{
-			m_LastSyncCheck += timeslice;
-			if (m_LastSyncCheck >= SYNC_CHECK_INTERVAL)
-			{
-				m_LastSyncCheck = 0.0;
-				
-				// Backup: Se não solicitou ainda e ainda não está sincronizado, solicitar novamente
-				if (!m_HasRequestedDatasets && !AskalDatabaseSync.IsClientSynced())
-				{
-					Print("[AskalStore] 📤 [Update] Solicitando datasets ao servidor via RPC (backup)...");
-					
-					// Solicitar datasets (sem parâmetros - servidor envia tudo)
-					GetRPCManager().SendRPC("AskalCoreModule", "RequestDatasets", NULL, true, NULL, NULL);
-					
-					m_HasRequestedDatasets = true;
-					Print("[AskalStore] ✅ [Update] RPC RequestDatasets enviado!");
-				}
-				// Se os dados chegaram e ainda não carregamos
-				else if (AskalDatabaseSync.IsClientSynced() && m_Datasets.Count() == 0)
-				{
-					Print("[AskalStore] ✅ Dados sincronizados! Recarregando datasets...");
-					LoadDatasetsFromCore();
-					
-					// Se temos datasets agora, carregar o primeiro
-					if (m_Datasets.Count() > 0)
-					{
-						LoadDataset(0);
-					}
-				}
-			}
-		}
+		// Cria previews pendentes dos cards visíveis (orçamento por frame)
+		if (m_PreviewPool && m_PreviewPool.HasPending())
+			m_PreviewPool.ProcessPending();
 		
 		// Rotação automática do preview
 		if (m_SelectedItemPreview)
@@ -7048,53 +6919,6 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 		}
 	}
 
-	void AnimateNotificationSlides()
-	{
-		if (!m_NotificationSlidePanels || !m_NotificationAnimationStartTimes)
-			return;
-		
-		float currentTime = GetGame().GetTickTime();
-		for (int i = 0; i < m_NotificationSlidePanels.Count(); i++)
-		{
-			Widget slidePanel = m_NotificationSlidePanels.Get(i);
-			if (!slidePanel)
-				continue;
-			
-			float startTime = 0;
-			if (i < m_NotificationAnimationStartTimes.Count())
-				startTime = m_NotificationAnimationStartTimes.Get(i);
-			
-			if (startTime < 0)
-				continue;
-			
-			float basePosY = 0;
-			if (m_NotificationBasePosY && i < m_NotificationBasePosY.Count())
-				basePosY = m_NotificationBasePosY.Get(i);
-			
-			float parentWidthPx = 70.0;
-			if (m_NotificationSlideParentWidths && i < m_NotificationSlideParentWidths.Count())
-				parentWidthPx = m_NotificationSlideParentWidths.Get(i);
-			if (parentWidthPx <= 0)
-				parentWidthPx = 70.0;
-			
-			float elapsed = currentTime - startTime;
-			if (elapsed >= NOTIFICATION_ANIMATION_DURATION)
-			{
-				slidePanel.SetPos(0, basePosY);
-				slidePanel.Update();
-				m_NotificationAnimationStartTimes.Set(i, -1);
-				continue;
-			}
-			
-			float t = elapsed / NOTIFICATION_ANIMATION_DURATION;
-			float eased = 1.0 - Math.Pow(1.0 - t, 3.0); // ease-out cubic
-			float currentOffsetPx = Math.Lerp(70.0, 0.0, eased);
-			float offsetNormalized = currentOffsetPx / parentWidthPx;
-			slidePanel.SetPos(offsetNormalized, basePosY);
-			slidePanel.Update();
-		}
-	}
-	
 	// ========================================
 	// MÉTODOS AUXILIARES - SISTEMA DE CONTEÚDO
 	// ========================================
@@ -7260,114 +7084,43 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 	// SISTEMA DE INVENTÁRIO
 	// ========================================
 	
-	/// Escaneia o inventário do player e armazena os itens por className
-	protected void ScanPlayerInventory()
+	/// Liga o AskalInventoryModel ao player (enumeração completa só na primeira vez)
+	protected void SyncInventoryModel()
 	{
-		Print("[AskalStore] 🔍 Escaneando inventário do player...");
-		
-		m_PlayerInventoryItems.Clear();
-		m_InventoryScanned = true;
-		
-		PlayerBase player = PlayerBase.Cast(GetGame().GetPlayer());
-		if (!player)
+		if (!AskalInventoryModel.GetInstance().EnsureAttached())
 		{
 			Print("[AskalStore] ❌ Player não encontrado!");
 			return;
 		}
-		
-		// Scan all inventory items (INCLUINDO itens dentro de containers - busca recursiva)
-		array<EntityAI> inventoryItems = new array<EntityAI>();
-		player.GetInventory().EnumerateInventory(InventoryTraversalType.PREORDER, inventoryItems);
-		
-		Print("[AskalStore] 📦 Total de itens no inventário: " + inventoryItems.Count());
-		
-		int totalUniqueTypes = 0;
-		foreach (EntityAI item : inventoryItems)
-		{
-			if (!item)
-				continue;
-			
-			// Itens com cargo serão bloqueados na venda, mas devem aparecer na listagem
-			string className = item.GetType();
-			string normalizedClass = NormalizeClassName(className);
-			
-			// Add to map (usando className normalizado)
-			if (!m_PlayerInventoryItems.Contains(normalizedClass))
-			{
-				m_PlayerInventoryItems.Insert(normalizedClass, new array<EntityAI>());
-				totalUniqueTypes++;
-			}
-			
-			m_PlayerInventoryItems.Get(normalizedClass).Insert(item);
-		}
-		
-		Print("[AskalStore] ✅ Inventário escaneado: " + totalUniqueTypes + " tipos de itens únicos");
-		
-		// Solicitar health dos itens do servidor (se multiplayer)
-		if (GetGame().IsMultiplayer() && GetGame().IsClient())
-		{
-			RequestInventoryHealth();
-		}
-		
-		// Processar health pendente do helper (3_Game)
-		ProcessPendingHealth();
 	}
 	
-	/// Solicita health dos itens do inventário ao servidor
-	protected void RequestInventoryHealth()
+	/// Pede ao servidor o preço de venda de cada item negociável do inventário
+	protected void RequestSellQuotes()
 	{
 		if (!GetGame().IsClient())
 			return;
 		
-		Print("[AskalStore] 📤 Solicitando health dos itens do inventário ao servidor...");
-		GetRPCManager().SendRPC("AskalCoreModule", "RequestInventoryHealth", NULL, true, NULL, NULL);
+		string traderName = m_CurrentTraderName;
+		if (!traderName || traderName == "")
+			traderName = "Trader_Default";
+		
+		GetRPCManager().SendRPC("AskalSellModule", "QuoteInventory", new Param2<string, string>(traderName, m_ActiveCurrencyId), true, NULL, NULL);
 	}
 	
-	/// Processa health pendente do helper (3_Game)
-	protected void ProcessPendingHealth()
+	/// Assina (abertura) ou cancela (fechamento) o envio de health/quantidade por entidade
+	protected void SubscribeInventoryHealth(bool subscribe)
 	{
-		if (!m_ItemHealthMap)
+		if (!GetGame().IsMultiplayer() || !GetGame().IsClient())
 			return;
 		
-		array<ref Param2<string, float>> healthArray = AskalNotificationHelper.GetInventoryHealth();
-		if (!healthArray || healthArray.Count() == 0)
+		if (subscribe == m_HealthSubscribed)
 			return;
 		
-		Print("[AskalStore] 📥 Processando health de " + healthArray.Count() + " itens do helper");
-		
-		// Limpar map anterior
-		m_ItemHealthMap.Clear();
-		
-		// Armazenar health no map (normalizado para lowercase)
-		for (int i = 0; i < healthArray.Count(); i++)
-		{
-			Param2<string, float> healthData = healthArray.Get(i);
-			if (!healthData)
-				continue;
-			
-			string className = healthData.param1;
-			float healthPercent = healthData.param2;
-			
-			if (!className || className == "")
-				continue;
-			
-			// Normalizar className para lowercase
-			string normalizedClass = NormalizeClassName(className);
-			
-			// Armazenar no map
-			m_ItemHealthMap.Insert(normalizedClass, healthPercent);
-		}
-		
-		Print("[AskalStore] ✅ Health processado e armazenado para " + m_ItemHealthMap.Count() + " itens");
-		
-		// Limpar health do helper após processar
-		AskalNotificationHelper.ClearInventoryHealth();
+		m_HealthSubscribed = subscribe;
+		if (!subscribe)
+			AskalHealthSyncCache.Clear();
 		
-		// Re-renderizar se estiver mostrando inventário
-		if (m_ShowingInventoryForSale || m_BatchSellEnabled)
-		{
-			RenderInventoryItemsForSale();
-		}
+		GetRPCManager().SendRPC("AskalCoreModule", "SubscribeInventoryHealth", new Param1<bool>(subscribe), true, NULL, NULL);
 	}
 	
 	/// Normaliza className para lowercase
@@ -7384,25 +7137,13 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 	/// Verifica se um item está no inventário do player
 	protected bool IsItemInInventory(string className)
 	{
-		if (!m_InventoryScanned)
-			return false;
-		
-		string normalizedClass = NormalizeClassName(className);
-		return m_PlayerInventoryItems.Contains(normalizedClass);
+		return AskalInventoryModel.GetInstance().Contains(className);
 	}
 	
 	/// Retorna o primeiro item encontrado no inventário com o className especificado
 	protected EntityAI GetFirstItemInInventory(string className)
 	{
-		if (!IsItemInInventory(className))
-			return null;
-		
-		string normalizedClass = NormalizeClassName(className);
-		array<EntityAI> items = m_PlayerInventoryItems.Get(normalizedClass);
-		if (items && items.Count() > 0)
-			return items.Get(0);
-		
-		return null;
+		return AskalInventoryModel.GetInstance().GetFirst(className);
 	}
 	
 	// ========================================
@@ -7421,6 +7162,13 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 			return true;
 		}
 		
+		// F8: painel de performance (admin)
+		if (key == KeyCode.KC_F8)
+		{
+			TogglePerfPanel();
+			return true;
+		}
+		
 		// Se o campo de pesquisa está focado, não processar outros atalhos (exceto ESC)
 		// Verificar se o campo de pesquisa está visível e pode estar focado
 		if (m_SearchInput && m_SearchInput.IsVisible())
@@ -7428,7 +7176,8 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 			// Quando há texto sendo digitado, assumir que pesquisa está ativa
 			// Outros atalhos não funcionam quando pesquisa está ativa (exceto ESC)
 			// ESC já foi tratado acima, então outros atalhos retornam false
-			if (m_SearchFilterText != "" && key != KeyCode.KC_ESCAPE)
+			// (texto do campo, não o filtro: o filtro só é aplicado após o debounce)
+			if (m_SearchInput.GetText() != "" && key != KeyCode.KC_ESCAPE)
 			{
 				return false;
 			}
@@ -7546,13 +7295,22 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 			}
 		}
 		
+		if (!m_CooldownTicking)
+		{
+			m_CooldownTicking = true;
+			GetGame().GetCallQueue(CALL_CATEGORY_GUI).CallLater(UpdateCooldownProgress, COOLDOWN_TICK_MS, true);
+		}
+		
 		Print("[AskalStore] ⏱️ Cooldown iniciado: " + m_CooldownDuration + "s");
 	}
 	
 	protected void UpdateCooldownProgress()
 	{
 		if (!m_ButtonCooldownStartTimes || m_ButtonCooldownStartTimes.Count() == 0)
+		{
+			StopCooldownTimer();
 			return;
+		}
 		
 		float currentTime = GetGame().GetTickTime();
 		
@@ -7585,6 +7343,18 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 				m_ButtonCooldownStartTimes.Remove(button);
 			}
 		}
+		
+		if (m_ButtonCooldownStartTimes.Count() == 0)
+			StopCooldownTimer();
+	}
+	
+	protected void StopCooldownTimer()
+	{
+		if (!m_CooldownTicking)
+			return;
+		
+		m_CooldownTicking = false;
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(UpdateCooldownProgress);
 	}
 	
 	protected void ResetAllCooldowns()
@@ -7607,6 +7377,7 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 		}
 		
 		m_ButtonCooldownStartTimes.Clear();
+		StopCooldownTimer();
 	}
 	
 	protected bool ProcessBatchSell(ButtonWidget sourceButton = null)
@@ -7617,38 +7388,67 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 			return ProcessSingleSell(sourceButton);
 		}
 		
-		int successCount = 0;
-		int totalItems = m_BatchSellSelectedEntities.Count();
+		PlayerBase player = PlayerBase.Cast(GetGame().GetPlayer());
+		if (!player || !player.GetIdentity())
+		{
+			DisplayTransactionError("Player não encontrado para realizar a venda");
+			return false;
+		}
+		
+		PlayerIdentity identity = player.GetIdentity();
+		string steamId = identity.GetPlainId();
+		if (!steamId || steamId == "")
+			steamId = identity.GetId();
+		
+		string currencyId = m_ActiveCurrencyId;
+		if (!currencyId || currencyId == "")
+			currencyId = "ASK_Coin";
 		
-		for (int idx = 0; idx < totalItems; idx++)
+		string traderName = m_CurrentTraderName;
+		if (!traderName || traderName == "")
+			traderName = "Trader_Default";
+		
+		// Um RPC para o lote inteiro: o servidor cobra uma ação no rate limit, não uma por item
+		array<string> classNames = new array<string>();
+		array<int> networkIds = new array<int>();
+		int skippedForCargo = 0;
+		for (int idx = 0; idx < m_BatchSellSelectedEntities.Count(); idx++)
 		{
 			EntityAI item = m_BatchSellSelectedEntities.Get(idx);
 			if (!item)
-			{
 				continue;
-			}
 			
-			if (SendSellRequest(item))
-			{
-				successCount++;
-			}
-			else
+			if (AskalInventoryModel.GetInstance().HasCargo(item))
 			{
+				skippedForCargo++;
+				continue;
 			}
+			
+			int networkIdLow;
+			int networkIdHigh;
+			item.GetNetworkID(networkIdLow, networkIdHigh);
+			classNames.Insert(item.GetType());
+			networkIds.Insert(networkIdLow);
+			networkIds.Insert(networkIdHigh);
 		}
 		
+		int successCount = classNames.Count();
 		if (successCount == 0)
 		{
-			DisplayTransactionError("Nenhum item válido para venda em lote");
+			if (skippedForCargo > 0)
+				DisplayTransactionError("[AVISO] Item ocupado: esvazie o inventario do item antes de vende-lo");
+			else
+				DisplayTransactionError("Nenhum item válido para venda em lote");
 			return false;
 		}
 		
+		Param6<string, string, int, string, ref array<string>, ref array<int>> batchParams = new Param6<string, string, int, string, ref array<string>, ref array<int>>(steamId, currencyId, 1, traderName, classNames, networkIds);
+		GetRPCManager().SendRPC("AskalSellModule", "SellBatchRequest", batchParams, true, identity, NULL);
 		
 		Print("[AskalStore] 📤 Venda em lote solicitada para " + successCount + " itens");
 		
 		ClearBatchSelections(true);
 		m_SelectedInventoryItem = null;
-		ScanPlayerInventory();
 		RenderInventoryItemsForSale();
 		UpdateTransactionSummary();
 		DisplayTransactionMessage("Impossível Vender");
@@ -7664,10 +7464,7 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 			// Notificação visual já é adicionada por SellItemResponse em askalcoremodule.c
 			// Não precisamos adicionar aqui para evitar duplicação
 			
-			// Atualizar inventário após venda bem-sucedida
-			ScanPlayerInventory();
-			if (m_BatchSellEnabled || m_ShowingInventoryForSale)
-				RenderInventoryItemsForSale();
+			// Listagem é atualizada pelo AskalInventoryModel quando o item sair do inventário
 			UpdateTransactionSummary();
 		}
 		else
@@ -7687,21 +7484,39 @@ protected string BuildPriceBreakdown(AskalItemData itemData)
 	}
 	
 	
-	// Obter health de um item (retorna 100% se não encontrado)
-	protected float GetItemHealth(string className)
+	// Health da entidade (assinatura do servidor; offline lê direto); 100% se desconhecida
+	protected float GetEntityHealth(EntityAI item)
 	{
-		if (!m_ItemHealthMap || !className || className == "")
+		if (!item)
 			return 100.0;
 		
-		string normalizedClass = NormalizeClassName(className);
-		if (m_ItemHealthMap.Contains(normalizedClass))
-		{
-			return m_ItemHealthMap.Get(normalizedClass);
-		}
+		if (!GetGame().IsMultiplayer())
+			return Math.Clamp(item.GetHealth01() * 100.0, 0, 100);
+		
+		AskalEntityCondition condition = AskalHealthSyncCache.Get(item);
+		if (condition)
+			return condition.HealthPercent;
 		
-		// Fallback: 100% se não encontrado
+		// Fallback: 100% até o servidor enviar
 		return 100.0;
 	}
+	
+	// Quantidade da entidade em % do máximo (-1 = sem quantidade ou desconhecida)
+	protected float GetEntityQuantity(EntityAI item)
+	{
+		if (!item)
+			return -1;
+		
+		AskalEntityCondition condition = AskalHealthSyncCache.Get(item);
+		if (condition)
+			return condition.QuantityPercent;
+		
+		ItemBase itemBase = ItemBase.Cast(item);
+		if (!itemBase || !itemBase.HasQuantity() || Magazine.Cast(item) || itemBase.GetQuantityMax() <= 0)
+			return -1;
+		
+		return Math.Clamp(itemBase.GetQuantity() / itemBase.GetQuantityMax() * 100.0, 0, 100);
+	}
 }
 
 
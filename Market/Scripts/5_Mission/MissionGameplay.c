@@ -24,6 +24,8 @@ modded class MissionGameplay extends MissionBase
 			Print("[AskalMarket] ✅ RPC RequestMarketConfig enviado");
 		}
 		
+		AskalEventBus.Get(AskalEventBus.TRADER_MENU_REQUESTED).Insert(OnTraderMenuRequested);
+		
 		Print("[AskalMarket] ========================================");
 	}
 	
@@ -97,8 +99,16 @@ modded class MissionGameplay extends MissionBase
 			// Toggle menu
 			ToggleToolsMenu();
 		}
-		
-		// Verificar se há solicitação de abertura de menu do trader pendente
+	}
+	
+	// Abre o menu do trader quando o servidor solicita (evento do AskalEventBus)
+	protected void OnTraderMenuRequested(Param payload)
+	{
+		ProcessPendingTraderMenu();
+	}
+	
+	protected void ProcessPendingTraderMenu()
+	{
 		string pendingTraderMenu = AskalNotificationHelper.GetPendingTraderMenu();
 		if (pendingTraderMenu && pendingTraderMenu != "")
 		{
@@ -161,6 +171,8 @@ modded class MissionGameplay extends MissionBase
 	{
 		super.OnMissionFinish();
 		
+		AskalEventBus.Get(AskalEventBus.TRADER_MENU_REQUESTED).Remove(OnTraderMenuRequested);
+		
 		if (m_ToolsMenu)
 	{
 			m_ToolsMenu.Close();